@@ -0,0 +1,34 @@
+#[================================================================================================[
+Copyright (c) 2024 by Vector Informatik. All rights reserved.
+
+This software is copyright protected and proprietary to Vector Informatik.
+Vector Informatik grants to you only those rights as set out in the license conditions.
+All other rights remain with Vector Informatik.
+
+File description:
+-----------------
+This is a CMake setup file for critical build variables used by the benchmark build.
+
+#]================================================================================================]
+
+# Setup the cmake variable SDK_DIR.
+# This variable shall be set to the root of the Platform SDK which is created
+# when building the Microsar Adaptive Platform
+set (SDK_DIR "${CMAKE_CURRENT_LIST_DIR}/../../SDK")
+
+# Setup the cmake variable CMAKE_TOOLCHAIN_FILE.
+# This variable shall be set to the file path of the toolchain definition cmake file.
+set (CMAKE_TOOLCHAIN_FILE "${SDK_DIR}/CMake/Toolchain/gcc11_linux_x86_64.cmake")
+
+# Verifiy the paths which has been setup above.
+
+# The path to the pre-built software development package based on the BSW Package
+if(NOT EXISTS "${SDK_DIR}")
+    message(FATAL_ERROR "Platform SDK is missing, please make sure that a correct value is set for the SDK_DIR variable.")
+endif()
+message(STATUS "BENCHMARK LOG: Configured SDK_DIR = ${SDK_DIR}")
+
+if(NOT EXISTS "${CMAKE_TOOLCHAIN_FILE}")
+    message(FATAL_ERROR "The TOOLCHAIN file doesn't exist, please make sure that a correct value is set for the CMAKE_TOOLCHAIN_FILE variable.")
+endif()
+message(STATUS "BENCHMARK LOG: The following TOOLCHAIN file is configured for this project: ${CMAKE_TOOLCHAIN_FILE}")
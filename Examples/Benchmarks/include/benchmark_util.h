@@ -0,0 +1,136 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file    benchmark_util.h
+ *              \brief    Timing helpers shared by all benchmark executables.
+ *
+ *            \details    Every measurement runs a warm-up phase and then reports the best of several repetitions to
+ *                        reduce the influence of scheduling noise.
+ *
+ *********************************************************************************************************************/
+#ifndef INCLUDE_BENCHMARK_UTIL_H
+#define INCLUDE_BENCHMARK_UTIL_H
+
+/*!********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+namespace benchmark {
+
+/*!
+ * \brief Number of measured repetitions of one benchmark case.
+ */
+constexpr std::uint32_t kRepetitions{5U};
+
+/*!
+ * \brief Prevents the compiler from optimizing away a computed value.
+ * \param[in] value Value that shall be considered used.
+ */
+template <typename T>
+inline void DoNotOptimize(T const& value) noexcept {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*!
+ * \brief   Measures the time of one operation.
+ * \details The operation is executed iterations times per repetition after one warm-up repetition.
+ * \param[in] iterations Number of operations per repetition.
+ * \param[in] operation  Operation to measure, called with the iteration index.
+ * \return  Best observed time per operation in nanoseconds.
+ */
+template <typename Operation>
+double MeasureNsPerOp(std::uint64_t iterations, Operation&& operation) noexcept {
+  double best{std::numeric_limits<double>::max()};
+  for (std::uint32_t repetition{0U}; repetition <= kRepetitions; ++repetition) {
+    std::chrono::steady_clock::time_point const start{std::chrono::steady_clock::now()};
+    for (std::uint64_t i{0U}; i < iterations; ++i) {
+      operation(i);
+    }
+    std::chrono::steady_clock::time_point const end{std::chrono::steady_clock::now()};
+    double const ns{static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())};
+    // The first repetition only warms up caches and branch predictors.
+    if (repetition != 0U) {
+      best = std::min(best, ns / static_cast<double>(iterations));
+    }
+  }
+  return best;
+}
+
+/*!
+ * \brief Prints one result line.
+ * \param[in] group  Benchmark group.
+ * \param[in] name   Name of the measured case.
+ * \param[in] ns     Time per operation in nanoseconds.
+ */
+inline void Report(char const* group, char const* name, double ns) noexcept {
+  std::printf("%-28s %-44s %12.1f ns/op\n", group, name, ns);
+}
+
+/*!
+ * \brief Prints one throughput result line.
+ * \param[in] group  Benchmark group.
+ * \param[in] name   Name of the measured case.
+ * \param[in] bytes  Number of bytes processed per operation.
+ * \param[in] ns     Time per operation in nanoseconds.
+ */
+inline void ReportThroughput(char const* group, char const* name, std::uint64_t bytes, double ns) noexcept {
+  std::printf("%-28s %-44s %12.1f ns/op %10.1f MiB/s\n", group, name, ns,
+              (static_cast<double>(bytes) / (1024.0 * 1024.0)) / (ns * 1e-9));
+}
+
+/*!
+ * \brief Prints one latency percentile and event rate result line.
+ * \param[in] group  Benchmark group.
+ * \param[in] name   Name of the measured case.
+ * \param[in] latency_ns Latency percentile in nanoseconds.
+ * \param[in] events_per_second Processed events per second.
+ */
+inline void ReportLatencyAndRate(char const* group, char const* name, double latency_ns,
+                                 double events_per_second) noexcept {
+  std::printf("%-28s %-44s %12.1f ns    %10.0f events/s\n", group, name, latency_ns, events_per_second);
+}
+
+/*!
+ * \brief Prints the hit and miss counters of a cache or pool.
+ * \param[in] group  Benchmark group.
+ * \param[in] name   Name of the measured case.
+ * \param[in] hits   Number of requests served.
+ * \param[in] misses Number of requests not served.
+ */
+inline void ReportHitsAndMisses(char const* group, char const* name, std::uint64_t hits,
+                                std::uint64_t misses) noexcept {
+  std::printf("%-28s %-44s %12llu hits  %10llu misses\n", group, name, static_cast<unsigned long long>(hits),
+              static_cast<unsigned long long>(misses));
+}
+
+/*!
+ * \brief Prints the outcome of one functional check that accompanies the measurements.
+ * \param[in] group  Benchmark group.
+ * \param[in] name   Name of the checked behavior.
+ * \param[in] passed Whether the check passed.
+ * \return passed.
+ */
+inline bool ReportCheck(char const* group, char const* name, bool passed) noexcept {
+  std::printf("%-28s %-44s %12s\n", group, name, passed ? "ok" : "FAILED");
+  return passed;
+}
+
+}  // namespace benchmark
+
+#endif  // INCLUDE_BENCHMARK_UTIL_H
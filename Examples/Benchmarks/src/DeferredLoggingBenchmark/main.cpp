@@ -0,0 +1,224 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares the producer cost of LogStream logging and deferred logging.
+ *
+ *            \details   Every case logs the same message ("Received", a counter, "bytes"). For the enabled cases the
+ *                       time of the log calls is measured in batches that fit into the record buffer of the thread;
+ *                       draining the deferred records through the sinks happens between the batches and is not part
+ *                       of the result. The LogStream numbers depend on the sinks of the logging configuration.
+ *                       Afterwards the benchmark checks that records carry the call time by default, that destroying a
+ *                       DeferredLogger formats its pending records, and that a DeferredLogDrainer formats records on
+ *                       the thread of its reactor.
+ *
+ *********************************************************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "amsr/log/internal/deferred/deferred_logger.h"
+#include "amsr/log/logging.h"
+#include "amsr/timer/timer_manager.h"
+#include "ara/core/initialization.h"
+#include "benchmark_util.h"
+#include "osabstraction/io/reactor1/reactor1.h"
+
+namespace {
+
+/*!
+ * \brief Type alias for the deferred logging front-end.
+ */
+using DeferredLogger = amsr::log::internal::deferred::DeferredLogger;
+
+/*!
+ * \brief Type alias for a deferred logging call site.
+ */
+using LogSite = amsr::log::internal::deferred::LogSite;
+
+/*!
+ * \brief Number of log calls per batch. The records of one batch fit into the record buffer of a thread.
+ */
+constexpr std::uint64_t kBatchSize{512U};
+
+/*!
+ * \brief Number of batches per repetition.
+ */
+constexpr std::uint64_t kBatches{200U};
+
+/*!
+ * \brief Call site of the enabled deferred log calls.
+ */
+constexpr LogSite kEnabledSite{amsr::log::LogLevel::kWarn, __FILE__, __LINE__};
+
+/*!
+ * \brief Number of records logged by each check.
+ */
+constexpr std::uint32_t kCheckRecords{16U};
+
+/*!
+ * \brief Time the reactor of the drainer check runs.
+ */
+constexpr std::chrono::milliseconds kDrainerRunTime{50};
+
+/*!
+ * \brief Call site of the disabled deferred log calls.
+ */
+constexpr LogSite kDisabledSite{amsr::log::LogLevel::kVerbose, __FILE__, __LINE__};
+
+/*!
+ * \brief   Measures log calls in batches and drains the deferred records between the batches.
+ * \param[in] log_call Log call, called with the iteration index.
+ * \return  Best observed time per log call in nanoseconds.
+ */
+template <typename LogCall>
+double MeasureBatched(LogCall&& log_call) noexcept {
+  double best{std::numeric_limits<double>::max()};
+  for (std::uint32_t repetition{0U}; repetition <= benchmark::kRepetitions; ++repetition) {
+    std::chrono::nanoseconds total{0};
+    for (std::uint64_t batch{0U}; batch < kBatches; ++batch) {
+      std::chrono::steady_clock::time_point const start{std::chrono::steady_clock::now()};
+      for (std::uint64_t i{0U}; i < kBatchSize; ++i) {
+        log_call(i);
+      }
+      total += std::chrono::steady_clock::now() - start;
+      static_cast<void>(amsr::log::internal::deferred::DrainDeferredLogs());
+    }
+    // The first repetition only warms up caches and registers the record buffer of the thread.
+    if (repetition != 0U) {
+      best = std::min(best, static_cast<double>(total.count()) / static_cast<double>(kBatches * kBatchSize));
+    }
+  }
+  return best;
+}
+
+/*!
+ * \brief Checks that records carry the time of the log call unless the front-end opts out.
+ * \param[in] logger The logger to log to.
+ * \return True if the check passed.
+ */
+bool CheckCallTime(amsr::log::Logger& logger) noexcept {
+  static_cast<void>(amsr::log::internal::deferred::DrainDeferredLogs());
+  DeferredLogger captured{logger};
+  DeferredLogger not_captured{logger, amsr::log::internal::deferred::CallTime::kNotCaptured};
+  captured.Log(kEnabledSite, "call time captured");
+  not_captured.Log(kEnabledSite, "call time not captured");
+  std::vector<amsr::log::internal::DltTime> time_stamps{};
+  static_cast<void>(amsr::log::internal::deferred::RecordBufferRegistry::Instance().ConsumeAll(
+      [&time_stamps](amsr::core::Span<std::uint8_t const> record) {
+        amsr::log::Optional<amsr::log::internal::deferred::RecordHeader> const header{
+            amsr::log::internal::deferred::ReadHeader(record)};
+        if (header.has_value()) {
+          time_stamps.push_back(header->time_stamp);
+        }
+      }));
+  return benchmark::ReportCheck("deferred log record", "call time captured by default",
+                                (time_stamps.size() == 2U) && (time_stamps[0] != 0U) && (time_stamps[1] == 0U));
+}
+
+/*!
+ * \brief Checks that destroying a DeferredLogger formats the records logged through it.
+ * \param[in] logger The logger to log to.
+ * \return True if the check passed.
+ */
+bool CheckDestructionDrains(amsr::log::Logger& logger) noexcept {
+  {
+    DeferredLogger scoped{logger};
+    for (std::uint32_t i{0U}; i < kCheckRecords; ++i) {
+      scoped.Log(kEnabledSite, "Scoped record", i);
+    }
+  }
+  return benchmark::ReportCheck("deferred log record", "formatted when DeferredLogger is destroyed",
+                                amsr::log::internal::deferred::DrainDeferredLogs() == 0U);
+}
+
+/*!
+ * \brief Checks that a DeferredLogDrainer formats the records on the thread that runs its reactor.
+ * \param[in] deferred The front-end to log through.
+ * \return True if the check passed.
+ */
+bool CheckDrainer(DeferredLogger& deferred) noexcept {
+  bool passed{false};
+  ::amsr::core::Result<osabstraction::io::reactor1::Reactor1::ConstructionToken> token{
+      osabstraction::io::reactor1::Reactor1::Preconstruct(1U)};
+  if (token.HasValue()) {
+    osabstraction::io::reactor1::Reactor1 reactor{std::move(token.Value())};
+    amsr::timer::TimerManager timer_manager{&reactor};
+    amsr::log::internal::deferred::DeferredLogDrainer const drainer{&timer_manager, std::chrono::milliseconds{1}};
+    for (std::uint32_t i{0U}; i < kCheckRecords; ++i) {
+      deferred.Log(kEnabledSite, "Drained record", i);
+    }
+    std::chrono::steady_clock::time_point const end{std::chrono::steady_clock::now() + kDrainerRunTime};
+    while (std::chrono::steady_clock::now() < end) {
+      static_cast<void>(reactor.HandleEvents(timer_manager.GetNextExpiry()));
+      timer_manager.HandleTimerExpiry();
+    }
+    passed = amsr::log::internal::deferred::DrainDeferredLogs() == 0U;
+  }
+  return benchmark::ReportCheck("deferred log record", "formatted by DeferredLogDrainer", passed);
+}
+
+/*!
+ * \brief Measures all cases and runs the checks.
+ * \param[in] logger The logger to log to.
+ * \return True if all checks passed.
+ */
+bool RunAll(amsr::log::Logger& logger) noexcept {
+  DeferredLogger deferred{logger};
+  DeferredLogger deferred_without_time{logger, amsr::log::internal::deferred::CallTime::kNotCaptured};
+
+  benchmark::Report("disabled log call", "LogStream",
+                    benchmark::MeasureNsPerOp(kBatches * kBatchSize, [&logger](std::uint64_t i) {
+                      logger.LogVerbose([i](amsr::log::LogStream& s) { s << "Received" << i << "bytes"; });
+                    }));
+  benchmark::Report("disabled log call", "DeferredLogger",
+                    benchmark::MeasureNsPerOp(kBatches * kBatchSize, [&deferred](std::uint64_t i) {
+                      deferred.Log(kDisabledSite, "Received", i, "bytes");
+                    }));
+  benchmark::Report("enabled log call", "LogStream", MeasureBatched([&logger](std::uint64_t i) {
+                      logger.LogWarn([i](amsr::log::LogStream& s) { s << "Received" << i << "bytes"; });
+                    }));
+  benchmark::Report("enabled log call", "DeferredLogger", MeasureBatched([&deferred](std::uint64_t i) {
+                      deferred.Log(kEnabledSite, "Received", i, "bytes");
+                    }));
+  benchmark::Report("enabled log call", "DeferredLogger, call time not captured",
+                    MeasureBatched([&deferred_without_time](std::uint64_t i) {
+                      deferred_without_time.Log(kEnabledSite, "Received", i, "bytes");
+                    }));
+
+  bool const call_time_passed{CheckCallTime(logger)};
+  bool const destruction_passed{CheckDestructionDrains(logger)};
+  bool const drainer_passed{CheckDrainer(deferred)};
+  return call_time_passed && destruction_passed && drainer_passed;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the deferred logging benchmark.
+ * \return 0 on success, 1 if the initialization or a check failed.
+ */
+int main() {
+  int exit_code{1};
+  if (ara::core::Initialize().HasValue()) {
+    amsr::log::Logger& logger{amsr::log::CreateLogger("BNCH", "Logging benchmark", amsr::log::LogLevel::kWarn)};
+    bool const passed{RunAll(logger)};
+    static_cast<void>(ara::core::Deinitialize());
+    exit_code = passed ? 0 : 1;
+  }
+  return exit_code;
+}
@@ -0,0 +1,210 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Measures Future::then() continuations run by the InlineFutureExecutor and checks re-entrance.
+ *
+ *            \details   The callbacks run in the context that completes the Promise, or in the context of then() if the
+ *                       Future is already ready. Both paths are measured. The checks cover a callback that calls then()
+ *                       again from within the inline execution, for both paths, and then() racing with set_value() from
+ *                       another thread. A check that does not finish within kCheckTimeout is reported as failed.
+ *
+ *********************************************************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <thread>
+#include "amsr/socal/internal/methods/inline_future_executor.h"
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+#include "benchmark_util.h"
+
+namespace {
+
+/*!
+ * \brief Executor running the callbacks inline.
+ */
+using InlineFutureExecutor = amsr::socal::internal::methods::InlineFutureExecutor;
+
+/*!
+ * \brief Promise type of the measured continuations.
+ */
+using Promise = ara::core::Promise<std::uint32_t>;
+
+/*!
+ * \brief Future type of the measured continuations.
+ */
+using Future = ara::core::Future<std::uint32_t>;
+
+/*!
+ * \brief Number of continuations per repetition.
+ */
+constexpr std::uint64_t kContinuations{100000U};
+
+/*!
+ * \brief Number of then() and set_value() races of the race check.
+ */
+constexpr std::uint32_t kRaces{20000U};
+
+/*!
+ * \brief Time after which a check is considered deadlocked.
+ */
+constexpr std::chrono::seconds kCheckTimeout{10};
+
+/*!
+ * \brief Returns a Future of the given Promise whose continuations run inline.
+ * \param[in] promise   The Promise.
+ * \param[in] executor  The inline executor.
+ * \return The Future.
+ */
+Future GetInlineFuture(Promise& promise, std::shared_ptr<InlineFutureExecutor> const& executor) {
+  Future future{promise.get_future()};
+  static_cast<void>(future.SetExecutionContext(executor));
+  return future;
+}
+
+/*!
+ * \brief Runs a check on a separate thread and fails it if it does not finish in time.
+ * \param[in] check  The check.
+ * \return The result of the check, false if it did not finish within kCheckTimeout.
+ */
+template <typename Check>
+bool RunWithTimeout(Check check) {
+  std::packaged_task<bool()> task{check};
+  std::future<bool> result{task.get_future()};
+  std::thread thread{std::move(task)};
+  bool const finished{result.wait_for(kCheckTimeout) == std::future_status::ready};
+  if (!finished) {
+    // The check thread is blocked for good, so it can neither be joined nor detached safely.
+    static_cast<void>(benchmark::ReportCheck("Future continuation", "check finished in time", false));
+    static_cast<void>(std::fflush(stdout));
+    std::_Exit(1);
+  }
+  thread.join();
+  return result.get();
+}
+
+/*!
+ * \brief Calls then() from within a callback that runs inline in set_value().
+ * \details The callback calls then() on a ready Future, so the inner callback runs inline as well.
+ * \return True if both callbacks ran with the value of their Promise.
+ */
+bool CheckThenFromCallbackInSetValue() {
+  std::shared_ptr<InlineFutureExecutor> const executor{std::make_shared<InlineFutureExecutor>()};
+  Promise promise{};
+  Promise ready_promise{};
+  ready_promise.set_value(7U);
+  Future ready_future{GetInlineFuture(ready_promise, executor)};
+  std::uint32_t outer_value{0U};
+  std::uint32_t nested_value{0U};
+  ara::core::Future<void> const outer{GetInlineFuture(promise, executor).then(
+      [&ready_future, &outer_value, &nested_value](Future future) {
+        outer_value = future.GetResult().Value();
+        static_cast<void>(
+            ready_future.then([&nested_value](Future again) { nested_value = again.GetResult().Value(); }));
+      })};
+  promise.set_value(41U);
+  return outer.is_ready() && (outer_value == 41U) && (nested_value == 7U);
+}
+
+/*!
+ * \brief Calls then() on a ready Future and, from within the inline callback, then() on the Future passed to it.
+ * \return True if both callbacks ran, the inner one with the value of the Promise.
+ */
+bool CheckThenFromCallbackOnReadyFuture() {
+  std::shared_ptr<InlineFutureExecutor> const executor{std::make_shared<InlineFutureExecutor>()};
+  Promise promise{};
+  promise.set_value(5U);
+  bool outer_called{false};
+  std::uint32_t nested_value{0U};
+  ara::core::Future<void> const outer{
+      GetInlineFuture(promise, executor).then([&outer_called, &nested_value](Future ready_future) {
+        outer_called = true;
+        static_cast<void>(
+            ready_future.then([&nested_value](Future again) { nested_value = again.GetResult().Value(); }));
+      })};
+  return outer.is_ready() && outer_called && (nested_value == 5U);
+}
+
+/*!
+ * \brief Calls then() on the application thread while a reactor thread completes the Promise.
+ * \return True if every callback ran exactly once.
+ */
+bool CheckThenRacingSetValue() {
+  std::shared_ptr<InlineFutureExecutor> const executor{std::make_shared<InlineFutureExecutor>()};
+  std::uint32_t completed{0U};
+  for (std::uint32_t race{0U}; race < kRaces; ++race) {
+    std::atomic<std::uint32_t> calls{0U};
+    Promise promise{};
+    Future future{GetInlineFuture(promise, executor)};
+    std::atomic<bool> start{false};
+    std::thread reactor{[&promise, &start, race]() {
+      while (!start.load()) {
+      }
+      promise.set_value(race);
+    }};
+    start.store(true);
+    ara::core::Future<void> const continuation{future.then([&calls, race](Future ready_future) {
+      if (ready_future.GetResult().Value() == race) {
+        calls.fetch_add(1U);
+      }
+    })};
+    reactor.join();
+    if ((calls.load() == 1U) && continuation.is_ready()) {
+      ++completed;
+    }
+  }
+  return completed == kRaces;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the future continuation benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  std::shared_ptr<InlineFutureExecutor> const executor{std::make_shared<InlineFutureExecutor>()};
+  std::uint64_t checksum{0U};
+  benchmark::Report("Future continuation", "inline, then() before set_value()",
+                    benchmark::MeasureNsPerOp(kContinuations, [&executor, &checksum](std::uint64_t iteration) {
+                      Promise promise{};
+                      ara::core::Future<void> const continuation{GetInlineFuture(promise, executor).then(
+                          [&checksum](Future ready_future) { checksum += ready_future.GetResult().Value(); })};
+                      promise.set_value(static_cast<std::uint32_t>(iteration));
+                    }));
+  benchmark::Report("Future continuation", "inline, then() on ready Future",
+                    benchmark::MeasureNsPerOp(kContinuations, [&executor, &checksum](std::uint64_t iteration) {
+                      Promise promise{};
+                      promise.set_value(static_cast<std::uint32_t>(iteration));
+                      ara::core::Future<void> const continuation{GetInlineFuture(promise, executor).then(
+                          [&checksum](Future ready_future) { checksum += ready_future.GetResult().Value(); })};
+                    }));
+  benchmark::DoNotOptimize(checksum);
+
+  bool passed{benchmark::ReportCheck("Future continuation", "then() from callback in set_value()",
+                                     RunWithTimeout(CheckThenFromCallbackInSetValue))};
+  passed = benchmark::ReportCheck("Future continuation", "then() from callback on ready Future",
+                                  RunWithTimeout(CheckThenFromCallbackOnReadyFuture)) &&
+           passed;
+  passed = benchmark::ReportCheck("Future continuation", "then() racing set_value() runs once",
+                                  RunWithTimeout(CheckThenRacingSetValue)) &&
+           passed;
+  return passed ? 0 : 1;
+}
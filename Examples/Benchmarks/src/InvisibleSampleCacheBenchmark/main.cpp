@@ -0,0 +1,165 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Measures the IPC invisible sample cache and checks it against resubscription.
+ *
+ *            \details   The measured case enqueues one notification and drains it with GetSamples(), as the Reactor
+ *                       and ReadSamples() do for every event. The check runs a reactor thread that keeps enqueueing
+ *                       while the application thread subscribes and unsubscribes with changing cache sizes. Both
+ *                       threads follow the locking of ProxyEventXfBackend: the reactor thread only enqueues under the
+ *                       subscriber lock while a subscriber is set, Subscribe() resizes the cache under that lock
+ *                       before it sets the subscriber and Unsubscribe() clears the cache after it has reset the
+ *                       subscriber under that lock.
+ *
+ *********************************************************************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include "amsr/shared_ptr.h"
+#include "benchmark_util.h"
+#include "ipc_binding_core/internal/events/invisible_sample_cache.h"
+
+namespace {
+
+/*!
+ * \brief IPC protocol namespace.
+ */
+namespace ipc_protocol = amsr::ipc_binding_core::internal::ipc_protocol;
+
+/*!
+ * \brief Type of the benchmarked cache.
+ */
+using InvisibleSampleCache = amsr::ipc_binding_core::internal::events::InvisibleSampleCache;
+
+/*!
+ * \brief Number of enqueue and drain round trips per repetition.
+ */
+constexpr std::uint64_t kRoundTrips{200000U};
+
+/*!
+ * \brief Number of subscribe and unsubscribe cycles of the resubscription check.
+ */
+constexpr std::uint32_t kSubscriptionCycles{2000U};
+
+/*!
+ * \brief Cache size of the first subscription of the resubscription check.
+ * \details Later subscriptions use 1 to kMaxCacheSize elements. The application cache reserves its storage once, so
+ *          no later subscription may request more than the first one.
+ */
+constexpr std::size_t kMaxCacheSize{8U};
+
+/*!
+ * \brief Number of GetSamples() calls per subscription cycle of the resubscription check.
+ */
+constexpr std::uint32_t kReadsPerCycle{8U};
+
+/*!
+ * \brief Creates a notification tagged with a subscription generation and a sequence number.
+ * \param[in] generation  Subscription generation, stored as instance ID.
+ * \param[in] sequence    Sequence number, stored as session ID.
+ * \return The notification.
+ */
+ipc_protocol::NotificationMessage MakeNotification(std::uint32_t generation, std::uint32_t sequence) noexcept {
+  ipc_protocol::NotificationMessageHeader const header{ipc_protocol::ServiceId{1U}, ipc_protocol::InstanceId{generation},
+                                                       ipc_protocol::MajorVersion{1U}, ipc_protocol::EventId{1U},
+                                                       ipc_protocol::SessionId{sequence}};
+  return ipc_protocol::NotificationMessage{header, ipc_protocol::IpcPacketShared{}};
+}
+
+/*!
+ * \brief Measures one enqueue and drain round trip.
+ * \return Time per round trip in nanoseconds.
+ */
+double MeasureRoundTrip() noexcept {
+  InvisibleSampleCache cache{};
+  cache.Resize(16U);
+  return benchmark::MeasureNsPerOp(kRoundTrips, [&cache](std::uint64_t iteration) {
+    benchmark::DoNotOptimize(cache.Enqueue(MakeNotification(1U, static_cast<std::uint32_t>(iteration))));
+    InvisibleSampleCache::SampleCacheContainer& samples{cache.GetSamples(1U)};
+    benchmark::DoNotOptimize(samples.front().GetMessageHeader().session_id_.value);
+    samples.pop_front();
+  });
+}
+
+/*!
+ * \brief Enqueues from a reactor thread while the application thread resubscribes.
+ * \return True if every read sample belongs to the current subscription and no read exceeds the cache size.
+ */
+bool CheckEnqueueDuringResubscribe() {
+  InvisibleSampleCache cache{};
+  std::mutex subscriber_lock{};
+  bool subscribed{false};
+  std::uint32_t generation{0U};
+  std::atomic<bool> stop{false};
+
+  std::thread reactor{[&cache, &subscriber_lock, &subscribed, &generation, &stop]() {
+    std::uint32_t sequence{0U};
+    while (!stop.load()) {
+      {
+        std::lock_guard<std::mutex> const guard{subscriber_lock};
+        if (subscribed) {
+          static_cast<void>(cache.Enqueue(MakeNotification(generation, sequence)));
+          ++sequence;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }};
+
+  bool passed{true};
+  std::uint64_t samples_read{0U};
+  for (std::uint32_t cycle{1U}; cycle <= kSubscriptionCycles; ++cycle) {
+    std::size_t const cache_size{kMaxCacheSize - ((cycle - 1U) % kMaxCacheSize)};
+    {
+      std::lock_guard<std::mutex> const guard{subscriber_lock};
+      cache.Resize(cache_size);
+      generation = cycle;
+      subscribed = true;
+    }
+    for (std::uint32_t read{0U}; read < kReadsPerCycle; ++read) {
+      InvisibleSampleCache::SampleCacheContainer& samples{cache.GetSamples(cache_size)};
+      passed = passed && (samples.size() <= cache_size);
+      while (!samples.empty()) {
+        passed = passed && (samples.front().GetMessageHeader().instance_id_.value == cycle);
+        samples.pop_front();
+        ++samples_read;
+      }
+      std::this_thread::yield();
+    }
+    {
+      std::lock_guard<std::mutex> const guard{subscriber_lock};
+      subscribed = false;
+    }
+    cache.Clear();
+  }
+  stop.store(true);
+  reactor.join();
+  return passed && (samples_read != 0U);
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the invisible sample cache benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  benchmark::Report("Invisible sample cache", "enqueue and drain one sample", MeasureRoundTrip());
+  bool const passed{benchmark::ReportCheck("Invisible sample cache", "enqueue during resubscribe",
+                                           CheckEnqueueDuringResubscribe())};
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares IPC packet creation from the default resource and from the IPC packet pool.
+ *
+ *            \details   One operation creates a packet of the given size and releases it, as the skeleton and proxy
+ *                       xf layers do for every event and method call. The pool is configured with smaller size classes
+ *                       than the default, and its hit and miss counters are reported per case. The checks cover
+ *                       packets larger than the largest size class, an exhausted size class and the configuration
+ *                       after first use.
+ *
+ *********************************************************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include "benchmark_util.h"
+#include "ipc_binding_core/internal/ipc_protocol/ipc_packet.h"
+#include "ipc_binding_core/internal/ipc_protocol/ipc_packet_pool.h"
+
+namespace {
+
+/*!
+ * \brief IPC protocol namespace.
+ */
+namespace ipc_protocol = amsr::ipc_binding_core::internal::ipc_protocol;
+
+/*!
+ * \brief Size class configuration of the pool.
+ */
+constexpr std::array<ipc_protocol::IpcPacketPool::SizeClassConfig, 3U> kSizeClasses{
+    {{128U, 256U}, {2048U, 64U}, {16384U, 8U}}};
+
+/*!
+ * \brief Packet sizes to measure, the last one is larger than the largest size class.
+ */
+constexpr std::array<ipc_protocol::PacketBuffer::size_type, 4U> kPacketSizes{{64U, 1024U, 8192U, 65536U}};
+
+/*!
+ * \brief Number of packets per repetition.
+ */
+constexpr std::uint64_t kPackets{100000U};
+
+/*!
+ * \brief Returns the pool statistics.
+ */
+ipc_protocol::IpcPacketPool::Statistics GetStatistics() noexcept {
+  return ipc_protocol::GetIpcPacketPool().GetStatistics();
+}
+
+/*!
+ * \brief Measures packet creation and release for one packet size.
+ * \param[in] size  Packet size in bytes.
+ * \return True if the pool served every allocation it has a size class for.
+ */
+bool MeasurePacketSize(ipc_protocol::PacketBuffer::size_type size) {
+  char name[64];
+  static_cast<void>(std::snprintf(name, sizeof(name), "default resource, %6zu B", static_cast<std::size_t>(size)));
+  benchmark::Report("IPC packet create+release", name, benchmark::MeasureNsPerOp(kPackets, [size](std::uint64_t) {
+                      ipc_protocol::IpcPacketShared const packet{ipc_protocol::IpcPacketSharedConstruct(size)};
+                      benchmark::DoNotOptimize(packet->data());
+                    }));
+
+  ipc_protocol::IpcPacketPool::Statistics const before{GetStatistics()};
+  static_cast<void>(std::snprintf(name, sizeof(name), "IPC packet pool,  %6zu B", static_cast<std::size_t>(size)));
+  benchmark::Report("IPC packet create+release", name, benchmark::MeasureNsPerOp(kPackets, [size](std::uint64_t) {
+                      ipc_protocol::IpcPacketShared const packet{ipc_protocol::IpcPacketSharedConstructFromPool(size)};
+                      benchmark::DoNotOptimize(packet->data());
+                    }));
+  ipc_protocol::IpcPacketPool::Statistics const after{GetStatistics()};
+  std::uint64_t const hits{after.hit_count - before.hit_count};
+  std::uint64_t const misses{after.miss_count - before.miss_count};
+  benchmark::ReportHitsAndMisses("IPC packet create+release", name, hits, misses);
+
+  // Every packet allocates its shared state and its payload. Only payloads larger than the largest size class miss.
+  bool const payload_fits{size <= kSizeClasses.back().block_size};
+  return payload_fits ? (misses == 0U) : (hits == misses);
+}
+
+/*!
+ * \brief Holds one packet more than the largest size class has blocks.
+ * \return True if exactly the surplus packet misses and a released block is reused.
+ */
+bool CheckExhaustedSizeClass() {
+  ipc_protocol::PacketBuffer::size_type const size{kSizeClasses.back().block_size};
+  std::array<ipc_protocol::IpcPacketShared, kSizeClasses.back().block_count + 1U> packets{};
+
+  ipc_protocol::IpcPacketPool::Statistics const before{GetStatistics()};
+  for (ipc_protocol::IpcPacketShared& packet : packets) {
+    packet = ipc_protocol::IpcPacketSharedConstructFromPool(size);
+  }
+  ipc_protocol::IpcPacketPool::Statistics const held{GetStatistics()};
+  for (ipc_protocol::IpcPacketShared& packet : packets) {
+    packet.Reset();
+  }
+  packets.front() = ipc_protocol::IpcPacketSharedConstructFromPool(size);
+  ipc_protocol::IpcPacketPool::Statistics const reused{GetStatistics()};
+
+  return ((held.miss_count - before.miss_count) == 1U) && (reused.miss_count == held.miss_count);
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the IPC packet pool benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool passed{benchmark::ReportCheck(
+      "IPC packet pool", "configure before first use",
+      ipc_protocol::ConfigureIpcPacketPool(
+          ::ara::core::Span<ipc_protocol::IpcPacketPool::SizeClassConfig const>{kSizeClasses.data(),
+                                                                               kSizeClasses.size()}))};
+
+  bool sizes_passed{true};
+  for (ipc_protocol::PacketBuffer::size_type const size : kPacketSizes) {
+    sizes_passed = MeasurePacketSize(size) && sizes_passed;
+  }
+  passed = benchmark::ReportCheck("IPC packet pool", "misses only above the largest size class", sizes_passed) &&
+           passed;
+  passed = benchmark::ReportCheck("IPC packet pool", "exhausted size class", CheckExhaustedSizeClass()) && passed;
+  passed = benchmark::ReportCheck("IPC packet pool", "configure after first use rejected",
+                                  !ipc_protocol::ConfigureIpcPacketPool(
+                                      ::ara::core::Span<ipc_protocol::IpcPacketPool::SizeClassConfig const>{})) &&
+           passed;
+
+  ipc_protocol::IpcPacketPool::Statistics const total{GetStatistics()};
+  benchmark::ReportHitsAndMisses("IPC packet pool", "total", total.hit_count, total.miss_count);
+  return passed ? 0 : 1;
+}
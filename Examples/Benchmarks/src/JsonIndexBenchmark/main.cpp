@@ -0,0 +1,544 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares JSON reading with the scalar character scan and with the structural index.
+ *
+ *            \details   The document is an indented array of service objects, similar to a large someipd-posix.json.
+ *                       The index is built with every backend the CPU supports. The scan cases tokenize the document
+ *                       through the stream operations used by the JSON readers, once character by character and once
+ *                       with the IndexedInputStream, including building its index. The parse cases parse the complete
+ *                       document with a parser that accepts every event, through FromBuffer() and FromIndexedBuffer().
+ *                       The checks compare every backend with the scalar index and the indexed scan with the character
+ *                       scan, also for a document that ends within an index block.
+ *
+ *********************************************************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include "amsr/json/reader.h"
+#include "amsr/json/reader/internal/indexed_input_stream.h"
+#include "amsr/json/reader/internal/structural_index.h"
+#include "benchmark_util.h"
+
+namespace {
+
+/*!
+ * \brief Structural index of the JSON reader.
+ */
+using StructuralIndex = amsr::json::internal::StructuralIndex;
+
+/*!
+ * \brief Implementations of the structural index.
+ */
+using StructuralIndexBackend = amsr::json::internal::StructuralIndexBackend;
+
+/*!
+ * \brief Number of parses, scans and index builds per repetition.
+ */
+constexpr std::uint64_t kParses{20U};
+
+/*!
+ * \brief JSON whitespace, skipped before every token.
+ */
+constexpr char kWhitespace[]{" \t\n\r"};
+
+/*!
+ * \brief Characters ending the characters of a string.
+ */
+constexpr char kStringDelimiters[]{"\"\\"};
+
+/*!
+ * \brief Characters ending a number or a literal.
+ */
+constexpr char kValueDelimiters[]{"{}[]:, \t\n\r\""};
+
+/*!
+ * \brief Backends of the structural index and their names.
+ */
+constexpr std::array<std::pair<StructuralIndexBackend, char const*>, 3U> kBackends{
+    {{StructuralIndexBackend::kScalar, "scalar"},
+     {StructuralIndexBackend::kSse2, "sse2"},
+     {StructuralIndexBackend::kAvx2, "avx2"}}};
+
+/*!
+ * \brief Tokens found by a scan.
+ */
+struct ScanResult {
+  /*!
+   * \brief Number of strings.
+   */
+  std::uint64_t strings;
+
+  /*!
+   * \brief Number of characters within strings, without the quotes.
+   */
+  std::uint64_t string_characters;
+
+  /*!
+   * \brief Number of structural characters, numbers and literals.
+   */
+  std::uint64_t other_tokens;
+
+  /*!
+   * \brief Compares two scan results.
+   * \param[in] other The other result.
+   * \return True if both results are equal.
+   */
+  bool operator==(ScanResult const& other) const noexcept {
+    return (strings == other.strings) && (string_characters == other.string_characters) &&
+           (other_tokens == other.other_tokens);
+  }
+};
+
+/*!
+ * \brief Scalar reference of the stream operations used by the scan, testing one character at a time.
+ */
+class CharacterScanner final {
+ public:
+  /*!
+   * \brief Constructor.
+   * \param[in] document The document, must outlive the scanner.
+   */
+  explicit CharacterScanner(std::string const& document) noexcept : document_{document} {}
+
+  /*!
+   * \brief Moves to the first character not contained in the set.
+   * \param[in] set The set.
+   */
+  void FindNot(amsr::core::StringView set) noexcept {
+    while ((position_ < document_.size()) && (set.find(document_[position_]) != amsr::core::StringView::npos)) {
+      ++position_;
+    }
+  }
+
+  /*!
+   * \brief Moves to the first character contained in the set.
+   * \param[in] set The set.
+   * \return The number of characters skipped.
+   */
+  std::uint64_t Find(amsr::core::StringView set) noexcept {
+    std::size_t const start{position_};
+    while ((position_ < document_.size()) && (set.find(document_[position_]) == amsr::core::StringView::npos)) {
+      ++position_;
+    }
+    return position_ - start;
+  }
+
+  /*!
+   * \brief Takes one character.
+   * \return The character, or -1 at the end of the document.
+   */
+  std::int64_t Get() noexcept {
+    std::int64_t result{-1};
+    if (position_ < document_.size()) {
+      result = static_cast<unsigned char>(document_[position_]);
+      ++position_;
+    }
+    return result;
+  }
+
+ private:
+  /*!
+   * \brief The document.
+   */
+  std::string const& document_;
+
+  /*!
+   * \brief Current position.
+   */
+  std::size_t position_{0U};
+};
+
+/*!
+ * \brief Stream operations used by the scan, performed through the InputStream interface of an IndexedInputStream.
+ */
+class IndexedScanner final {
+ public:
+  /*!
+   * \brief Constructor, builds the index of the document.
+   * \param[in] document The document, must outlive the scanner.
+   */
+  explicit IndexedScanner(std::string const& document) noexcept
+      : stream_{amsr::core::Span<char const>{document.data(), document.size()}} {}
+
+  /*!
+   * \brief Moves to the first character not contained in the set.
+   * \param[in] set The set.
+   */
+  void FindNot(amsr::core::StringView set) noexcept { static_cast<void>(Stream().FindNot(set)); }
+
+  /*!
+   * \brief Moves to the first character contained in the set.
+   * \param[in] set The set.
+   * \return The number of characters skipped.
+   */
+  std::uint64_t Find(amsr::core::StringView set) noexcept {
+    std::uint64_t skipped{0U};
+    static_cast<void>(
+        Stream().ReadUntil(set, [&skipped](amsr::core::StringView characters) { skipped = characters.size(); }));
+    return skipped;
+  }
+
+  /*!
+   * \brief Takes one character.
+   * \return The character, or -1 at the end of the document.
+   */
+  std::int64_t Get() noexcept { return Stream().Get().ValueOr(-1); }
+
+ private:
+  /*!
+   * \brief Returns the stream through its interface, as the JSON readers use it.
+   * \return The stream.
+   */
+  amsr::stream::InputStream& Stream() noexcept { return stream_; }
+
+  /*!
+   * \brief The indexed stream.
+   */
+  amsr::json::internal::IndexedInputStream stream_;
+};
+
+/*!
+ * \brief Tokenizes the document with the stream operations of the JSON readers.
+ * \tparam Scanner CharacterScanner or IndexedScanner.
+ * \param[in] scanner The scanner.
+ * \return The tokens found.
+ */
+template <typename Scanner>
+ScanResult Scan(Scanner& scanner) noexcept {
+  ScanResult result{0U, 0U, 0U};
+  scanner.FindNot(kWhitespace);
+  std::int64_t character{scanner.Get()};
+  while (character >= 0) {
+    if (character == '"') {
+      ++result.strings;
+      do {
+        result.string_characters += scanner.Find(kStringDelimiters);
+        character = scanner.Get();
+        if (character == '\\') {
+          result.string_characters += 2U;
+          static_cast<void>(scanner.Get());
+        }
+      } while ((character >= 0) && (character != '"'));
+    } else if (StructuralIndex::Classify(static_cast<char>(character)) ==
+               amsr::json::internal::CharClass::kStructural) {
+      ++result.other_tokens;
+    } else {
+      ++result.other_tokens;
+      static_cast<void>(scanner.Find(kValueDelimiters));
+    }
+    scanner.FindNot(kWhitespace);
+    character = scanner.Get();
+  }
+  return result;
+}
+
+/*!
+ * \brief Parser that accepts every value and counts the events.
+ */
+class CountingParser final : public amsr::json::v2::Parser {
+ public:
+  /*!
+   * \brief Constructor.
+   * \param[in] document The JSON document to parse.
+   */
+  explicit CountingParser(amsr::json::JsonData& document) noexcept : amsr::json::v2::Parser{document} {}
+
+  /*!
+   * \brief Counts a null value.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnNull() noexcept final { return Count(); }
+
+  /*!
+   * \brief Counts a boolean value.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnBool(bool) noexcept final { return Count(); }
+
+  /*!
+   * \brief Counts a number.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnNumber(amsr::json::JsonNumber) noexcept final { return Count(); }
+
+  /*!
+   * \brief Counts a string.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnString(amsr::json::StringView) noexcept final { return Count(); }
+
+  /*!
+   * \brief Counts a key.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnKey(amsr::json::StringView) noexcept final { return Count(); }
+
+  /*!
+   * \brief Counts the start of an object.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnStartObject() noexcept final { return Enter(); }
+
+  /*!
+   * \brief Counts the end of an object.
+   * \return kFinished at the end of the document, kRunning otherwise.
+   */
+  amsr::json::ParserResult OnEndObject(std::size_t) noexcept final { return Leave(); }
+
+  /*!
+   * \brief Counts the start of an array.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult OnStartArray() noexcept final { return Enter(); }
+
+  /*!
+   * \brief Counts the end of an array.
+   * \return kFinished at the end of the document, kRunning otherwise.
+   */
+  amsr::json::ParserResult OnEndArray(std::size_t) noexcept final { return Leave(); }
+
+  /*!
+   * \brief Returns the number of events.
+   * \return The number of events.
+   */
+  std::uint64_t GetEvents() const noexcept { return events_; }
+
+ private:
+  /*!
+   * \brief Counts an event.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult Count() noexcept {
+    ++events_;
+    return amsr::json::ParserResult{amsr::json::ParserState::kRunning};
+  }
+
+  /*!
+   * \brief Counts the start of a container.
+   * \return kRunning.
+   */
+  amsr::json::ParserResult Enter() noexcept {
+    ++depth_;
+    return Count();
+  }
+
+  /*!
+   * \brief Counts the end of a container.
+   * \return kFinished if the outermost container ends, kRunning otherwise.
+   */
+  amsr::json::ParserResult Leave() noexcept {
+    ++events_;
+    --depth_;
+    return amsr::json::ParserResult{(depth_ == 0U) ? amsr::json::ParserState::kFinished
+                                                   : amsr::json::ParserState::kRunning};
+  }
+
+  /*!
+   * \brief Number of events.
+   */
+  std::uint64_t events_{0U};
+
+  /*!
+   * \brief Current nesting depth.
+   */
+  std::uint32_t depth_{0U};
+};
+
+/*!
+ * \brief Shape of a generated document.
+ */
+struct DocumentShape {
+  /*!
+   * \brief Number of service objects.
+   */
+  std::uint32_t services;
+
+  /*!
+   * \brief Length of the certificate string of each service object, 0 for none.
+   */
+  std::size_t certificate_length;
+
+  /*!
+   * \brief Name of the shape in the report.
+   */
+  char const* name;
+};
+
+/*!
+ * \brief Shapes of the measured documents: short tokens only, and with a long string per object.
+ */
+constexpr std::array<DocumentShape, 3U> kShapes{{{16U, 0U, "16 services"},
+                                                {1024U, 0U, "1024 services"},
+                                                {1024U, 2048U, "1024 services, 2 KiB strings"}}};
+
+/*!
+ * \brief Creates an indented array of service objects.
+ * \param[in] shape The shape of the document.
+ * \return The JSON document.
+ */
+std::string MakeDocument(DocumentShape const& shape) {
+  std::string document{"[\n"};
+  for (std::uint32_t service{0U}; service < shape.services; ++service) {
+    document += (service == 0U) ? "" : ",\n";
+    document += "    {\n        \"service_id\": " + std::to_string(service) +
+                ",\n        \"major_version\": 1,\n        \"minor_version\": 0,\n"
+                "        \"short_name\": \"ServiceInterface" +
+                std::to_string(service) +
+                "\",\n        \"description\": \"Service \\\"" + std::to_string(service) +
+                "\\\" of the\\tbenchmark\",\n" +
+                ((shape.certificate_length == 0U)
+                     ? std::string{}
+                     : "        \"certificate\": \"" + std::string(shape.certificate_length, 'A') + "\",\n") +
+                "        \"events\": [\n"
+                "            {\"id\": 32769, \"field\": false, \"proto\": \"udp\", \"name\": \"Notification\"},\n"
+                "            {\"id\": 32770, \"field\": true, \"proto\": \"tcp\", \"name\": \"FieldNotifier\"}\n"
+                "        ],\n        \"methods\": [\n"
+                "            {\"id\": 1, \"proto\": \"tcp\", \"name\": \"Request\"},\n"
+                "            {\"id\": 2, \"proto\": \"udp\", \"name\": \"FireAndForget\"}\n"
+                "        ]\n    }";
+  }
+  document += "\n]\n";
+  return document;
+}
+
+/*!
+ * \brief Parses the document with the given JSON data factory.
+ * \tparam Factory Type of the factory, returning a Result<JsonData> for a buffer.
+ * \param[in] document The JSON document.
+ * \param[in] factory  The factory.
+ * \return The number of events, 0 on error.
+ */
+template <typename Factory>
+std::uint64_t Parse(std::string const& document, Factory factory) noexcept {
+  std::uint64_t events{0U};
+  amsr::json::Result<amsr::json::JsonData> data{factory(amsr::json::StringView{document.data(), document.size()})};
+  if (data.HasValue()) {
+    CountingParser parser{data.Value()};
+    if (parser.Parse().HasValue()) {
+      events = parser.GetEvents();
+    }
+  }
+  return events;
+}
+
+/*!
+ * \brief Compares the index of every supported backend with the scalar index.
+ * \param[in] document The document.
+ * \return True if all indexes are equal.
+ */
+bool CheckBackends(std::string const& document) noexcept {
+  amsr::core::Span<char const> const span{document.data(), document.size()};
+  StructuralIndex reference{};
+  reference.Build(span, StructuralIndexBackend::kScalar);
+  bool equal{true};
+  for (std::pair<StructuralIndexBackend, char const*> const& backend : kBackends) {
+    if (StructuralIndex::IsBackendSupported(backend.first)) {
+      StructuralIndex index{};
+      index.Build(span, backend.first);
+      equal = equal && (index.GetNumberOfBlocks() == reference.GetNumberOfBlocks());
+      for (std::size_t block{0U}; equal && (block < reference.GetNumberOfBlocks()); ++block) {
+        for (StructuralIndex::ClassSet const classes : {1U, 2U, 4U}) {
+          equal = equal && (index.GetMask(block, classes) == reference.GetMask(block, classes));
+        }
+      }
+    }
+  }
+  return equal;
+}
+
+/*!
+ * \brief Compares the indexed scan with the character scan.
+ * \param[in] document The document.
+ * \return True if both scans find the same tokens.
+ */
+bool CheckScan(std::string const& document) noexcept {
+  CharacterScanner character_scanner{document};
+  IndexedScanner indexed_scanner{document};
+  ScanResult const expected{Scan(character_scanner)};
+  return (expected.strings > 0U) && (Scan(indexed_scanner) == expected);
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the JSON structural index benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool passed{true};
+  for (DocumentShape const& shape : kShapes) {
+    char name[96];
+    std::string const document{MakeDocument(shape)};
+    amsr::core::Span<char const> const span{document.data(), document.size()};
+
+    for (std::pair<StructuralIndexBackend, char const*> const& backend : kBackends) {
+      if (StructuralIndex::IsBackendSupported(backend.first)) {
+        StructuralIndex index{};
+        static_cast<void>(std::snprintf(name, sizeof(name), "%s, %s", backend.second, shape.name));
+        benchmark::ReportThroughput("JSON index build", name, document.size(),
+                                    benchmark::MeasureNsPerOp(kParses, [&index, &span, &backend](std::uint64_t) {
+                                      index.Build(span, backend.first);
+                                      benchmark::DoNotOptimize(index.GetMask(0U, 7U));
+                                    }));
+      }
+    }
+
+    static_cast<void>(std::snprintf(name, sizeof(name), "character scan, %s", shape.name));
+    benchmark::ReportThroughput("JSON scan", name, document.size(),
+                                benchmark::MeasureNsPerOp(kParses, [&document](std::uint64_t) {
+                                  CharacterScanner scanner{document};
+                                  benchmark::DoNotOptimize(Scan(scanner).other_tokens);
+                                }));
+    static_cast<void>(std::snprintf(name, sizeof(name), "indexed stream, %s", shape.name));
+    benchmark::ReportThroughput("JSON scan", name, document.size(),
+                                benchmark::MeasureNsPerOp(kParses, [&document](std::uint64_t) {
+                                  IndexedScanner scanner{document};
+                                  benchmark::DoNotOptimize(Scan(scanner).other_tokens);
+                                }));
+
+    // Cut the document within a string, so the last index block is partial and padded.
+    std::string const truncated{document.substr(0U, document.size() - 37U)};
+    static_cast<void>(std::snprintf(name, sizeof(name), "backends match scalar, %s", shape.name));
+    passed = benchmark::ReportCheck("JSON index", name, CheckBackends(document) && CheckBackends(truncated)) && passed;
+    static_cast<void>(std::snprintf(name, sizeof(name), "indexed scan matches, %s", shape.name));
+    passed = benchmark::ReportCheck("JSON index", name, CheckScan(document) && CheckScan(truncated)) && passed;
+  }
+
+  for (DocumentShape const& shape : kShapes) {
+    char name[96];
+    std::string const document{MakeDocument(shape)};
+
+    static_cast<void>(std::snprintf(name, sizeof(name), "scalar buffer, %s", shape.name));
+    benchmark::ReportThroughput("JSON parse", name, document.size(),
+                                benchmark::MeasureNsPerOp(kParses, [&document](std::uint64_t) {
+                                  benchmark::DoNotOptimize(Parse(document, [](amsr::json::StringView buffer) {
+                                    return amsr::json::JsonData::FromBuffer(buffer);
+                                  }));
+                                }));
+
+    static_cast<void>(std::snprintf(name, sizeof(name), "structural index, %s", shape.name));
+    benchmark::ReportThroughput("JSON parse", name, document.size(),
+                                benchmark::MeasureNsPerOp(kParses, [&document](std::uint64_t) {
+                                  benchmark::DoNotOptimize(Parse(document, [](amsr::json::StringView buffer) {
+                                    return amsr::json::JsonData::FromIndexedBuffer(buffer);
+                                  }));
+                                }));
+  }
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares producer contention on the log MPSC queue with the mutex and the lock-free strategy.
+ *
+ *            \details   1 to 32 producer threads push a fixed number of values into one queue while a single consumer
+ *                       thread pops them. A producer whose Push() fails because the queue is full yields and pushes
+ *                       the value again, so every value arrives. Every run checks that the consumer received all
+ *                       values, and that the lock-free queue counts exactly the failed pushes as dropped.
+ *
+ *********************************************************************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "amsr/log/internal/mpsc/mpsc.h"
+#include "benchmark_util.h"
+
+namespace {
+
+/*!
+ * \brief Synchronization strategy namespace.
+ */
+namespace sync = amsr::log::internal::sync;
+
+/*!
+ * \brief Number of values pushed per run, split evenly across the producers.
+ */
+constexpr std::uint64_t kValuesPerRun{131072U};
+
+/*!
+ * \brief Capacity of the queue.
+ */
+constexpr std::uint32_t kQueueCapacity{1024U};
+
+/*!
+ * \brief Producer counts to measure.
+ */
+constexpr std::uint32_t kProducerCounts[]{1U, 2U, 4U, 8U, 16U, 32U};
+
+/*!
+ * \brief Outcome of one run.
+ */
+struct RunResult {
+  /*! \brief Values popped by the consumer. */
+  std::uint64_t consumed;
+  /*! \brief Push() calls that failed because the queue was full. */
+  std::uint64_t failed_pushes;
+  /*! \brief Drops counted by the queue, equal to failed_pushes if the queue does not count drops itself. */
+  std::uint64_t counted_drops;
+};
+
+/*!
+ * \brief Returns the drops counted by a lock-free queue.
+ */
+template <sync::Strategy kStrategy, std::enable_if_t<kStrategy == sync::Strategy::kLockFree, std::uint8_t> = 0>
+std::uint64_t CountedDrops(amsr::log::internal::mpsc::Consumer<std::uint64_t, kStrategy> const& consumer,
+                           std::uint64_t) noexcept {
+  return consumer.GetDroppedCount();
+}
+
+/*!
+ * \brief Returns the failed pushes seen by the producers for queues that do not count drops.
+ */
+template <sync::Strategy kStrategy, std::enable_if_t<kStrategy != sync::Strategy::kLockFree, std::uint8_t> = 0>
+std::uint64_t CountedDrops(amsr::log::internal::mpsc::Consumer<std::uint64_t, kStrategy> const&,
+                           std::uint64_t failed_pushes) noexcept {
+  return failed_pushes;
+}
+
+/*!
+ * \brief Pushes kValuesPerRun values from the given number of producers into a new queue and drains it.
+ * \param[in] producers Number of producer threads.
+ * \return The outcome of the run.
+ */
+template <sync::Strategy kStrategy>
+RunResult Run(std::uint32_t producers) {
+  auto queue = amsr::log::internal::mpsc::MakeMPSC<std::uint64_t, kStrategy>(kQueueCapacity);
+  std::atomic<bool> start{false};
+  std::atomic<std::uint32_t> running{producers};
+  std::atomic<std::uint64_t> failed_pushes{0U};
+  std::uint64_t consumed{0U};
+
+  std::thread consumer{[&queue, &running, &consumed]() {
+    bool done{false};
+    while (!done) {
+      // Read the producer count before popping, so no value pushed before the last producer finished is missed.
+      done = running.load() == 0U;
+      while (queue.second.Pop().has_value()) {
+        ++consumed;
+      }
+    }
+  }};
+
+  std::vector<std::thread> threads{};
+  for (std::uint32_t producer{0U}; producer < producers; ++producer) {
+    threads.emplace_back([&queue, &start, &running, &failed_pushes, producers]() {
+      amsr::log::internal::mpsc::Producer<std::uint64_t, kStrategy> const local{queue.first};
+      std::uint64_t local_failures{0U};
+      while (!start.load()) {
+        std::this_thread::yield();
+      }
+      for (std::uint64_t value{0U}; value < (kValuesPerRun / producers); ++value) {
+        std::uint64_t pushed{value};
+        while (!local.Push(std::move(pushed)).HasValue()) {
+          ++local_failures;
+          std::this_thread::yield();
+        }
+      }
+      failed_pushes.fetch_add(local_failures);
+      running.fetch_sub(1U);
+    });
+  }
+  start.store(true);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  consumer.join();
+
+  std::uint64_t const total_failures{failed_pushes.load()};
+  return RunResult{consumed, total_failures, CountedDrops<kStrategy>(queue.second, total_failures)};
+}
+
+/*!
+ * \brief Measures all producer counts for one strategy.
+ * \param[in] strategy_name Name of the strategy for the report.
+ * \return True if all checks passed.
+ */
+template <sync::Strategy kStrategy>
+bool MeasureStrategy(char const* strategy_name) {
+  bool passed{true};
+  for (std::uint32_t const producers : kProducerCounts) {
+    RunResult last{};
+    double const ns{benchmark::MeasureNsPerOp(1U, [&last, producers](std::uint64_t) {
+                      last = Run<kStrategy>(producers);
+                    }) /
+                    static_cast<double>(kValuesPerRun)};
+    char name[64];
+    static_cast<void>(std::snprintf(name, sizeof(name), "%s, %2u producers", strategy_name, producers));
+    benchmark::Report("MPSC queue push", name, ns);
+    static_cast<void>(
+        std::snprintf(name, sizeof(name), "%s, %2u producers, all values received", strategy_name, producers));
+    passed = benchmark::ReportCheck("MPSC queue push", name,
+                                    (last.consumed == kValuesPerRun) && (last.counted_drops == last.failed_pushes)) &&
+             passed;
+  }
+  return passed;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry Point of the process.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool const mutex_passed{MeasureStrategy<sync::Strategy::kMutex>("mutex")};
+  bool const lock_free_passed{MeasureStrategy<sync::Strategy::kLockFree>("lock-free")};
+  return (mutex_passed && lock_free_passed) ? 0 : 1;
+}
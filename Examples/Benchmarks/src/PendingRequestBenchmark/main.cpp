@@ -0,0 +1,117 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares the request round trip of the PendingRequestMap slot table and its overflow map.
+ *
+ *            \details   One round trip stores a request, takes its promise out as the response handler does, sets the
+ *                       value and destroys the future. Each in-flight count runs against a map with the default 256
+ *                       slots, a map whose slot table is sized for the in-flight count, and the overflow map. The
+ *                       overflow map case keeps session ID 0 in the single slot of the slot table, so every further
+ *                       request goes through the mutex protected map. With 10000 requests in flight the default slot
+ *                       table holds at most 256 of them and the rest go to the overflow map.
+ *
+ *********************************************************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "benchmark_util.h"
+#include "ipc_binding_core/internal/methods/pending_request_map.h"
+
+namespace {
+
+/*!
+ * \brief Type of the benchmarked map.
+ */
+using PendingRequestMap = amsr::ipc_binding_core::internal::methods::PendingRequestMap<std::uint32_t>;
+
+/*!
+ * \brief Type of the session ID.
+ */
+using SessionId = PendingRequestMap::SessionId;
+
+/*!
+ * \brief Number of round trips per repetition.
+ */
+constexpr std::uint64_t kRoundTrips{200000U};
+
+/*!
+ * \brief Numbers of requests in flight to measure.
+ */
+constexpr std::size_t kInFlightCounts[]{1U, 100U, 10000U};
+
+/*!
+ * \brief Slot capacity that holds the largest number of requests in flight.
+ */
+constexpr std::size_t kLargeSlotCapacity{16384U};
+
+/*!
+ * \brief Measures round trips of batches of in-flight requests.
+ * \param[in] map           The map to use.
+ * \param[in] in_flight     Number of requests that are stored before their responses arrive.
+ * \param[in] first_id      First session ID to use.
+ * \param[out] all_matched  Set to false if a future did not return the value of its own response.
+ * \return Time per request in nanoseconds.
+ */
+double MeasureRoundTrip(PendingRequestMap& map, std::size_t in_flight, SessionId::type first_id,
+                        bool& all_matched) noexcept {
+  std::vector<amsr::core::Optional<amsr::core::Future<std::uint32_t>>> futures(in_flight);
+  SessionId::type session{first_id};
+  auto const round_trip = [&map, &futures, &session, &all_matched, first_id](std::uint64_t) {
+    SessionId::type const batch_start{session};
+    for (amsr::core::Optional<amsr::core::Future<std::uint32_t>>& future : futures) {
+      future = map.StoreRequest(SessionId{session});
+      session = (session == SessionId::type{0xFFFFFFF0U}) ? first_id : (session + 1U);
+    }
+    SessionId::type response{batch_start};
+    for (amsr::core::Optional<amsr::core::Future<std::uint32_t>>& future : futures) {
+      amsr::core::Optional<PendingRequestMap::Promise> promise{map.MoveOutRequest(SessionId{response})};
+      promise->set_value(response);
+      all_matched = (future->get() == response) && all_matched;
+      future.reset();
+      response = (response == SessionId::type{0xFFFFFFF0U}) ? first_id : (response + 1U);
+    }
+  };
+  return benchmark::MeasureNsPerOp(kRoundTrips / in_flight, round_trip) / static_cast<double>(in_flight);
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the pending request benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool all_matched{true};
+  for (std::size_t const in_flight : kInFlightCounts) {
+    char name[64];
+    amsr::SharedPtr<PendingRequestMap> const default_map{amsr::MakeShared<PendingRequestMap>().Value()};
+    static_cast<void>(std::snprintf(name, sizeof(name), "%5zu slots, %5zu in flight",
+                                    PendingRequestMap::kDefaultSlotCapacity, in_flight));
+    benchmark::Report("request round trip", name, MeasureRoundTrip(*default_map, in_flight, 1U, all_matched));
+
+    amsr::SharedPtr<PendingRequestMap> const large_map{
+        amsr::MakeShared<PendingRequestMap>(kLargeSlotCapacity).Value()};
+    static_cast<void>(
+        std::snprintf(name, sizeof(name), "%5zu slots, %5zu in flight", kLargeSlotCapacity, in_flight));
+    benchmark::Report("request round trip", name, MeasureRoundTrip(*large_map, in_flight, 1U, all_matched));
+
+    amsr::SharedPtr<PendingRequestMap> const overflow_map{amsr::MakeShared<PendingRequestMap>(std::size_t{1}).Value()};
+    amsr::core::Optional<amsr::core::Future<std::uint32_t>> const blocker{overflow_map->StoreRequest(SessionId{0U})};
+    static_cast<void>(std::snprintf(name, sizeof(name), "overflow map, %5zu in flight", in_flight));
+    benchmark::Report("request round trip", name, MeasureRoundTrip(*overflow_map, in_flight, 1U, all_matched));
+  }
+  return benchmark::ReportCheck("request round trip", "every response reaches its own future", all_matched) ? 0 : 1;
+}
@@ -0,0 +1,379 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares GetNewSamples() and GetNewSamplesBatch() of a polling mode proxy event.
+ *
+ *            \details   The IPC case runs a proxy event on a ProxyEventXfBackend, which overrides ReadSamplesBatch().
+ *                       One operation hands kSamplesPerRead notifications to the backend as the reactor does and reads
+ *                       them back with either API. The E2E case runs a proxy event on a backend that only implements
+ *                       ReadSamples(), so GetNewSamplesBatch() uses the default ReadSamplesBatch(), and assigns a
+ *                       different E2E check status to consecutive samples. The checks compare the values and E2E check
+ *                       status seen by both APIs.
+ *
+ *********************************************************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "amsr/socal/internal/events/proxy_event_backend_interface.h"
+#include "amsr/socal/r20_11/events/proxy_event.h"
+#include "amsr/socal/r20_11/events/proxy_event_polling_mode.h"
+#include "ara/com/instance_identifier.h"
+#include "benchmark_util.h"
+#include "ipc_binding_core/internal/ipc_protocol/ipc_packet.h"
+#include "ipc_binding_core/internal/ipc_protocol/message.h"
+#include "ipc_binding_core/internal/packet_router/proxy_router_interface.h"
+#include "ipc_binding_transformation_layer/internal/events/proxy_event_xf_backend.h"
+#include "ipc_binding_transformation_layer/internal/events/visible_sample_cache.h"
+#include "ipc_binding_xf_common/internal/trace/trace_event_sink_interface.h"
+#include "someip-protocol/internal/byteorder.h"
+#include "someip-protocol/internal/deserialization/reader.h"
+
+namespace {
+
+/*!
+ * \brief IPC binding core namespace.
+ */
+namespace ipc_binding = amsr::ipc_binding_core::internal;
+
+/*!
+ * \brief IPC protocol namespace.
+ */
+namespace ipc_protocol = amsr::ipc_binding_core::internal::ipc_protocol;
+
+/*!
+ * \brief Type of the event samples.
+ */
+using Sample = std::uint32_t;
+
+/*!
+ * \brief Polling mode proxy event.
+ */
+using ProxyEvent = amsr::socal::r20_11::events::ProxyEvent<Sample, amsr::socal::internal::events::TimeStampDisabled,
+                                                           amsr::socal::internal::configuration::RuntimeProcessingMode::kPolling>;
+
+/*!
+ * \brief Type of the backend interface of the proxy event.
+ */
+using ProxyEventBackendInterface = amsr::socal::internal::events::ProxyEventBackendInterface<Sample>;
+
+/*!
+ * \brief E2E check status type.
+ */
+using ProfileCheckStatus = ara::com::e2e::ProfileCheckStatus;
+
+/*!
+ * \brief Number of samples handed to the backend and read back per operation.
+ */
+constexpr std::size_t kSamplesPerRead{64U};
+
+/*!
+ * \brief Number of operations per repetition.
+ */
+constexpr std::uint64_t kReads{5000U};
+
+/*!
+ * \brief Length of the IPC headers in front of the serialized sample.
+ */
+constexpr std::size_t kHeaderLength{ipc_protocol::kProtocolMessageHeaderLength +
+                                    ipc_protocol::kNotificationMessageHeaderLength};
+
+/*!
+ * \brief Deserializes one big endian 32 bit sample.
+ */
+struct SampleDeserializer {
+  /*!
+   * \brief Deserializes a sample.
+   * \param[in,out] reader  Reader on the sample payload.
+   * \param[out]    sample  Deserialized sample.
+   * \return True if the payload holds a sample.
+   */
+  static bool Deserialize(amsr::someip_protocol::internal::deserialization::Reader& reader, Sample& sample) noexcept {
+    bool const valid{reader.VerifySize(sizeof(Sample))};
+    if (valid) {
+      reader.ReadPrimitive<Sample, amsr::someip_protocol::internal::BigEndian>(sample);
+    }
+    return valid;
+  }
+};
+
+/*!
+ * \brief IPC backend under test.
+ */
+using IpcBackend = amsr::ipc_binding_transformation_layer::internal::ProxyEventXfBackend<Sample, SampleDeserializer>;
+
+/*!
+ * \brief Proxy router without a connection. The backend only registers and releases itself.
+ */
+class NoConnectionProxyRouter final : public ipc_binding::ProxyRouterInterface {
+ public:
+  auto GetConnectionProxy() const noexcept
+      -> amsr::SharedPtr<amsr::ipc_binding_core::internal::connection_manager::ConnectionProxyInterface> final {
+    return {};
+  }
+  auto SetRouterConnector(amsr::WeakPtr<ipc_binding::ProxyRouterConnectorInterface> const&) noexcept
+      -> void final {}
+  auto AddEventXf(ipc_protocol::EventId, ipc_binding::ProxyEventBackendInterface&) noexcept -> void final {}
+  auto AddMethodXf(ipc_protocol::MethodId, ipc_binding::ProxyMethodBackendInterface&) noexcept -> void final {}
+  auto AddFireAndForgetMethodXf(ipc_protocol::MethodId, ipc_binding::ProxyFireAndForgetMethodBackendInterface&) noexcept
+      -> void final {}
+  auto GetEventXf(ipc_protocol::EventId) noexcept -> ipc_binding::ProxyEventBackendInterface* final { return nullptr; }
+  auto GetMethodXf(ipc_protocol::MethodId) noexcept -> ipc_binding::ProxyMethodBackendInterface* final {
+    return nullptr;
+  }
+  auto ReleaseEventXf(ipc_protocol::EventId) noexcept -> void final {}
+  auto ReleaseMethodXf(ipc_protocol::MethodId) noexcept -> void final {}
+  auto ReleaseFireAndForgetMethodXf(ipc_protocol::MethodId) noexcept -> void final {}
+  auto OnConnected(amsr::WeakPtr<ipc_binding::ProxyRouterConnectorInterface> const&) noexcept -> void final {}
+  auto OnDisconnected() noexcept -> void final {}
+  auto OnServiceInstanceUp() noexcept -> void final {}
+  auto OnServiceInstanceDown() noexcept -> void final {}
+};
+
+/*!
+ * \brief Trace sink that drops all trace points.
+ */
+class NoTraceSink final : public amsr::ipc_binding_xf_common::internal::trace::TraceEventSinkInterface {
+ public:
+  auto TraceSend(ProvidedServiceInstanceId const&, NotificationMessage) const noexcept -> void final {}
+  auto TraceSendAllocate(ProvidedServiceInstanceId const&, NotificationMessage) const noexcept -> void final {}
+  auto TraceReadSample(ProvidedServiceInstanceId const&, ClientId, NotificationMessage) const noexcept -> void final {}
+};
+
+/*!
+ * \brief Backend that only implements ReadSamples() and assigns consecutive E2E check status to its samples.
+ */
+class E2EBackend final : public ProxyEventBackendInterface {
+ public:
+  /*!
+   * \brief E2E check status assigned to consecutive samples.
+   */
+  static constexpr std::array<ProfileCheckStatus, 4U> kCheckStatus{
+      {ProfileCheckStatus::Ok, ProfileCheckStatus::Repeated, ProfileCheckStatus::WrongSequence,
+       ProfileCheckStatus::NotAvailable}};
+
+  /*!
+   * \brief Queues samples with the values first_value, first_value + 1, ...
+   * \param[in] first_value  Value of the first sample.
+   * \param[in] count        Number of samples.
+   */
+  void Push(Sample first_value, std::size_t count) {
+    for (std::size_t index{0U}; index < count; ++index) {
+      pending_.push_back(first_value + static_cast<Sample>(index));
+    }
+  }
+
+  void Subscribe(amsr::socal::internal::events::EventSubscriberInterface*, std::size_t const cache_size) noexcept final {
+    cache_ = std::make_shared<Cache>(cache_size);
+  }
+  void Unsubscribe(amsr::socal::internal::events::EventSubscriberInterface*) noexcept final { cache_.reset(); }
+  ReadSamplesResult ReadSamples(std::size_t const max_samples,
+                                CallableReadSamplesResult const& callable_sample_result) noexcept final {
+    std::size_t read_samples{0U};
+    while ((read_samples < max_samples) && (next_ < pending_.size())) {
+      typename Cache::CacheEntryType slot{cache_->GetNextFreeSample()};
+      if (slot == nullptr) {
+        break;
+      }
+      **slot = pending_[next_];
+      callable_sample_result(SampleData{std::move(slot), cache_, kCheckStatus[next_ % kCheckStatus.size()], {}});
+      ++next_;
+      ++read_samples;
+    }
+    return ReadSamplesResult::FromValue(read_samples);
+  }
+  ::ara::com::e2e::Result const GetE2EResult() const noexcept final {
+    return ::amsr::e2e::Result{::ara::com::E2E_state_machine::E2EState::NoData,
+                               ::ara::com::E2E_state_machine::E2ECheckStatus::NotAvailable};
+  }
+  std::size_t GetFreeSampleCount() const noexcept final { return cache_->GetFreeSampleCount(); }
+  ::ara::com::SubscriptionState GetSubscriptionState() const noexcept final {
+    return ::ara::com::SubscriptionState::kSubscribed;
+  }
+  void RegisterReceiveHandler(CallableEventNotification) noexcept final {}
+  void DeregisterReceiveHandler() noexcept final {}
+  void RegisterSubscriptionStateChangeHandler(CallableSubscriptionStateUpdate) noexcept final {}
+  void DeregisterSubscriptionStateChangeHandler() noexcept final {}
+
+  /*!
+   * \brief Returns the E2E check status the backend assigned to the sample with the given index.
+   * \param[in] index  Index of the sample in the order of Push() calls.
+   * \return The E2E check status.
+   */
+  static ProfileCheckStatus ExpectedCheckStatus(std::size_t index) noexcept {
+    return kCheckStatus[index % kCheckStatus.size()];
+  }
+
+ private:
+  /*!
+   * \brief Sample cache type.
+   */
+  using Cache = amsr::ipc_binding_transformation_layer::internal::events::VisibleSampleCache<Sample>;
+
+  /*!
+   * \brief Sample cache.
+   */
+  std::shared_ptr<Cache> cache_{};
+
+  /*!
+   * \brief Queued sample values.
+   */
+  std::vector<Sample> pending_{};
+
+  /*!
+   * \brief Index of the next sample to read.
+   */
+  std::size_t next_{0U};
+};
+
+constexpr std::array<ProfileCheckStatus, 4U> E2EBackend::kCheckStatus;
+
+/*!
+ * \brief Hands kSamplesPerRead notifications with consecutive values to an IPC backend.
+ * \param[in] backend      The backend.
+ * \param[in] first_value  Value of the first sample.
+ */
+void Notify(IpcBackend& backend, Sample first_value) {
+  for (std::size_t index{0U}; index < kSamplesPerRead; ++index) {
+    ipc_protocol::PacketBuffer::size_type const packet_size{kHeaderLength + sizeof(Sample)};
+    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstruct(packet_size)};
+    Sample const value{first_value + static_cast<Sample>(index)};
+    for (std::size_t byte{0U}; byte < sizeof(Sample); ++byte) {
+      (*packet)[kHeaderLength + byte] = static_cast<std::uint8_t>(value >> (8U * (sizeof(Sample) - 1U - byte)));
+    }
+    ipc_protocol::NotificationMessageHeader const header{ipc_protocol::ServiceId{1U}, ipc_protocol::InstanceId{1U},
+                                                         ipc_protocol::MajorVersion{1U}, ipc_protocol::EventId{1U},
+                                                         ipc_protocol::SessionId{value}};
+    backend.OnNotificationReceived(ipc_protocol::NotificationMessage{header, std::move(packet)});
+  }
+}
+
+/*!
+ * \brief Reads all samples with GetNewSamples().
+ * \param[in] event  The proxy event.
+ * \param[out] values  The read values, appended.
+ * \param[out] status  The E2E check status of the read samples, appended.
+ */
+void ReadSingle(ProxyEvent& event, std::vector<Sample>& values, std::vector<ProfileCheckStatus>& status) {
+  static_cast<void>(event.GetNewSamples([&values, &status](ProxyEvent::SamplePtr sample) {
+    values.push_back(*sample);
+    status.push_back(sample.GetProfileCheckStatus());
+  }));
+}
+
+/*!
+ * \brief Reads all samples with GetNewSamplesBatch().
+ * \param[in] event  The proxy event.
+ * \param[out] values  The read values, appended.
+ * \param[out] status  The E2E check status of the read samples, appended.
+ */
+void ReadBatch(ProxyEvent& event, std::vector<Sample>& values, std::vector<ProfileCheckStatus>& status) {
+  static_cast<void>(event.GetNewSamplesBatch(
+      [&values, &status](ProxyEvent::SampleBatchView samples, ProxyEvent::E2ECheckStatusBatchView check_status) {
+        for (std::size_t index{0U}; index < samples.size(); ++index) {
+          values.push_back(*samples[index]);
+          status.push_back(check_status[index]);
+        }
+      }));
+}
+
+/*!
+ * \brief Measures and checks both read APIs on the IPC backend.
+ * \return True if both APIs read the same values in the same order.
+ */
+bool MeasureIpcBackend() {
+  NoConnectionProxyRouter router{};
+  IpcBackend backend{ipc_binding::ProvidedServiceInstanceId{
+                         ipc_protocol::ServiceId{1U}, ipc_protocol::InstanceId{1U}, ipc_protocol::MajorVersion{1U},
+                         ipc_protocol::MinorVersion{0U}},
+                     ipc_protocol::EventId{1U}, ipc_protocol::ClientId{1U}, std::make_unique<NoTraceSink>(), router};
+  ProxyEvent event{&backend, "BatchService", "BatchEvent", ara::com::InstanceIdentifier{"IpcBinding:1"}};
+  static_cast<void>(event.Subscribe(kSamplesPerRead));
+
+  std::uint64_t checksum{0U};
+  benchmark::Report("IPC proxy event read", "GetNewSamples, per sample, 64 per read",
+                    benchmark::MeasureNsPerOp(kReads, [&backend, &event, &checksum](std::uint64_t) {
+                      Notify(backend, 0U);
+                      static_cast<void>(event.GetNewSamples(
+                          [&checksum](ProxyEvent::SamplePtr sample) { checksum += *sample; }));
+                    }) / static_cast<double>(kSamplesPerRead));
+  benchmark::Report("IPC proxy event read", "GetNewSamplesBatch, per sample, 64 per read",
+                    benchmark::MeasureNsPerOp(kReads, [&backend, &event, &checksum](std::uint64_t) {
+                      Notify(backend, 0U);
+                      static_cast<void>(event.GetNewSamplesBatch(
+                          [&checksum](ProxyEvent::SampleBatchView samples, ProxyEvent::E2ECheckStatusBatchView) {
+                            for (Sample const* const sample : samples) {
+                              checksum += *sample;
+                            }
+                          }));
+                    }) / static_cast<double>(kSamplesPerRead));
+  benchmark::DoNotOptimize(checksum);
+
+  std::vector<Sample> single_values{};
+  std::vector<Sample> batch_values{};
+  std::vector<ProfileCheckStatus> single_status{};
+  std::vector<ProfileCheckStatus> batch_status{};
+  Notify(backend, 1000U);
+  ReadSingle(event, single_values, single_status);
+  Notify(backend, 1000U);
+  ReadBatch(event, batch_values, batch_status);
+  event.Unsubscribe();
+  return (single_values.size() == kSamplesPerRead) && (single_values == batch_values) &&
+         (single_status == batch_status);
+}
+
+/*!
+ * \brief Checks that GetNewSamplesBatch() passes the E2E check status of every sample to the callable.
+ * \return True if both APIs see the E2E check status assigned by the backend.
+ */
+bool CheckE2ECheckStatus() {
+  E2EBackend backend{};
+  ProxyEvent event{&backend, "BatchService", "BatchEvent", ara::com::InstanceIdentifier{"IpcBinding:1"}};
+  static_cast<void>(event.Subscribe(kSamplesPerRead));
+
+  std::vector<Sample> single_values{};
+  std::vector<Sample> batch_values{};
+  std::vector<ProfileCheckStatus> single_status{};
+  std::vector<ProfileCheckStatus> batch_status{};
+  backend.Push(0U, kSamplesPerRead);
+  ReadSingle(event, single_values, single_status);
+  backend.Push(0U, kSamplesPerRead);
+  ReadBatch(event, batch_values, batch_status);
+  event.Unsubscribe();
+
+  bool passed{(single_values == batch_values) && (batch_status.size() == kSamplesPerRead)};
+  for (std::size_t index{0U}; passed && (index < kSamplesPerRead); ++index) {
+    passed = (single_status[index] == E2EBackend::ExpectedCheckStatus(index)) &&
+             (batch_status[index] == E2EBackend::ExpectedCheckStatus(kSamplesPerRead + index));
+  }
+  return passed;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the proxy event batch benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool passed{benchmark::ReportCheck("IPC proxy event read", "batch reads the same samples", MeasureIpcBackend())};
+  passed = benchmark::ReportCheck("E2E proxy event read", "batch passes E2E check status", CheckE2ECheckStatus()) &&
+           passed;
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares the epoll based Reactor1 with IoUringReactor1.
+ *
+ *            \details   Measured cases:
+ *                       - dispatch: one HandleEvents() iteration with N ready IO sources. Reports the best mean time
+ *                         per iteration, the 99th percentile of the single iteration latencies and the dispatched
+ *                         callbacks per second.
+ *                       - re-arm churn: every callback changes the monitored events of another ready source several
+ *                         times. This fills the io_uring submission queue from within HandleEvents().
+ *
+ *********************************************************************************************************************/
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "benchmark_util.h"
+#include "osabstraction/io/reactor1/io_uring_reactor1.h"
+#include "osabstraction/io/reactor1/reactor1.h"
+
+namespace {
+
+/*!
+ * \brief Numbers of simultaneously ready IO sources.
+ */
+constexpr std::uint16_t kSourceCounts[]{1U, 16U, 256U};
+
+/*!
+ * \brief Number of monitored event changes per callback invocation in the re-arm churn case.
+ */
+constexpr std::uint32_t kChurnPerCallback{64U};
+
+/*!
+ * \brief Number of single HandleEvents() iterations timed for the latency percentile and the event rate.
+ */
+constexpr std::size_t kLatencySamples{20000U};
+
+/*!
+ * \brief Result of the dispatch case.
+ */
+struct DispatchResult {
+  /*!
+   * \brief Best mean time of one HandleEvents() iteration in nanoseconds.
+   */
+  double ns_per_iteration;
+  /*!
+   * \brief 99th percentile of the single HandleEvents() iteration latencies in nanoseconds.
+   */
+  double p99_ns;
+  /*!
+   * \brief Dispatched callbacks per second over all timed iterations.
+   */
+  double events_per_second;
+};
+
+/*!
+ * \brief Readable eventfds that stay readable because they are never drained.
+ */
+class ReadySources final {
+ public:
+  explicit ReadySources(std::uint16_t count) {
+    for (std::uint16_t i{0U}; i < count; ++i) {
+      int const fd{::eventfd(1U, EFD_CLOEXEC | EFD_NONBLOCK)};
+      fds_.push_back(fd);
+    }
+  }
+  ~ReadySources() {
+    for (int const fd : fds_) {
+      static_cast<void>(::close(fd));
+    }
+  }
+  ReadySources(ReadySources const&) = delete;
+  ReadySources& operator=(ReadySources const&) = delete;
+
+  std::vector<int> const& Fds() const noexcept { return fds_; }
+
+ private:
+  std::vector<int> fds_{};
+};
+
+/*!
+ * \brief Times single HandleEvents() iterations and derives the 99th percentile latency and the event rate.
+ * \param[in] reactor Reactor with registered ready sources.
+ * \param[in] callbacks Counter incremented by every dispatched callback.
+ * \param[out] result Receives the percentile and the rate.
+ */
+void MeasureLatencyAndRate(osabstraction::io::reactor1::Reactor1Interface& reactor, std::uint64_t const& callbacks,
+                           DispatchResult& result) {
+  std::vector<std::int64_t> latencies(kLatencySamples);
+  std::uint64_t const callbacks_before{callbacks};
+  std::int64_t total_ns{0};
+  for (std::int64_t& latency : latencies) {
+    std::chrono::steady_clock::time_point const start{std::chrono::steady_clock::now()};
+    static_cast<void>(reactor.HandleEvents(std::chrono::nanoseconds::zero()));
+    latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    total_ns += latency;
+  }
+  std::vector<std::int64_t>::iterator const p99{latencies.begin() +
+                                                static_cast<std::ptrdiff_t>((latencies.size() * 99U) / 100U)};
+  std::nth_element(latencies.begin(), p99, latencies.end());
+  result.p99_ns = static_cast<double>(*p99);
+  result.events_per_second = (static_cast<double>(callbacks - callbacks_before) * 1e9) / static_cast<double>(total_ns);
+}
+
+/*!
+ * \brief Measures HandleEvents() iterations with count ready sources.
+ */
+DispatchResult MeasureDispatch(osabstraction::io::reactor1::Reactor1Interface& reactor, std::uint16_t count) {
+  using osabstraction::io::reactor1::CallbackHandle;
+  using osabstraction::io::reactor1::EventTypes;
+  ReadySources const sources{count};
+  std::vector<CallbackHandle> handles{};
+  std::uint64_t callbacks{0U};
+  for (int const fd : sources.Fds()) {
+    handles.push_back(reactor
+                          .Register(fd, EventTypes{}.SetReadEvent(true),
+                                    [&callbacks](CallbackHandle, EventTypes) { ++callbacks; })
+                          .Value());
+  }
+  DispatchResult result{};
+  result.ns_per_iteration = benchmark::MeasureNsPerOp(2000U, [&reactor](std::uint64_t) {
+    static_cast<void>(reactor.HandleEvents(std::chrono::nanoseconds::zero()));
+  });
+  MeasureLatencyAndRate(reactor, callbacks, result);
+  for (CallbackHandle const handle : handles) {
+    static_cast<void>(
+        reactor.Unregister(handle, osabstraction::io::reactor1::CloseOnUnregister::kDoNotCloseHandle));
+  }
+  // Drain the poll remove completions of the io_uring reactor.
+  static_cast<void>(reactor.HandleEvents(std::chrono::nanoseconds::zero()));
+  return result;
+}
+
+/*!
+ * \brief   Measures one HandleEvents() iteration in which every callback toggles the monitored events of the next
+ *          ready source.
+ * \details The next source is still armed, so every change queues a poll remove and a poll add request.
+ */
+double MeasureRearmChurn(osabstraction::io::reactor1::Reactor1Interface& reactor, std::uint16_t count) {
+  using osabstraction::io::reactor1::CallbackHandle;
+  using osabstraction::io::reactor1::EventTypes;
+  ReadySources const sources{count};
+  std::vector<CallbackHandle> handles(sources.Fds().size(), osabstraction::io::reactor1::kInvalidCallbackHandle);
+  for (std::size_t index{0U}; index < handles.size(); ++index) {
+    handles[index] = reactor
+                         .Register(sources.Fds()[index], EventTypes{}.SetReadEvent(true),
+                                   [&reactor, &handles, index](CallbackHandle, EventTypes) {
+                                     CallbackHandle const next{handles[(index + 1U) % handles.size()]};
+                                     for (std::uint32_t i{0U}; i < kChurnPerCallback; ++i) {
+                                       static_cast<void>(reactor.SetMonitoredEvents(
+                                           next, EventTypes{}.SetReadEvent(true).SetErrorEvent((i % 2U) == 0U)));
+                                     }
+                                     static_cast<void>(
+                                         reactor.SetMonitoredEvents(next, EventTypes{}.SetReadEvent(true)));
+                                   })
+                         .Value();
+  }
+  double const ns{benchmark::MeasureNsPerOp(200U, [&reactor](std::uint64_t) {
+    static_cast<void>(reactor.HandleEvents(std::chrono::nanoseconds::zero()));
+  })};
+  for (CallbackHandle const handle : handles) {
+    static_cast<void>(
+        reactor.Unregister(handle, osabstraction::io::reactor1::CloseOnUnregister::kDoNotCloseHandle));
+  }
+  static_cast<void>(reactor.HandleEvents(std::chrono::nanoseconds::zero()));
+  return ns;
+}
+
+/*!
+ * \brief Runs all cases for one reactor implementation.
+ */
+void RunAll(char const* group, osabstraction::io::reactor1::Reactor1Interface& reactor) {
+  char name[64];
+  for (std::uint16_t const count : kSourceCounts) {
+    DispatchResult const result{MeasureDispatch(reactor, count)};
+    static_cast<void>(std::snprintf(name, sizeof(name), "dispatch %u ready sources", count));
+    benchmark::Report(group, name, result.ns_per_iteration);
+    static_cast<void>(std::snprintf(name, sizeof(name), "dispatch %u ready sources p99", count));
+    benchmark::ReportLatencyAndRate(group, name, result.p99_ns, result.events_per_second);
+  }
+  for (std::uint16_t const count : kSourceCounts) {
+    static_cast<void>(std::snprintf(name, sizeof(name), "re-arm churn %u sources x %u", count, kChurnPerCallback));
+    benchmark::Report(group, name, MeasureRearmChurn(reactor, count));
+  }
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry Point of the process.
+ * \return Zero when successfully executed.
+ */
+int main() {
+  constexpr std::uint16_t kNumCallbacks{512U};
+
+  {
+    osabstraction::io::reactor1::Reactor1 reactor{
+        osabstraction::io::reactor1::Reactor1::Preconstruct(kNumCallbacks).Value()};
+    RunAll("Reactor1 (epoll)", reactor);
+  }
+
+  ::amsr::core::Result<osabstraction::io::reactor1::IoUringReactor1::ConstructionToken> token{
+      osabstraction::io::reactor1::IoUringReactor1::Preconstruct(kNumCallbacks)};
+  if (token.HasValue()) {
+    osabstraction::io::reactor1::IoUringReactor1 reactor{std::move(token).Value()};
+    RunAll("IoUringReactor1", reactor);
+  } else {
+    std::printf("IoUringReactor1 not available: %s\n", token.Error().UserMessage().data());
+  }
+  return 0;
+}
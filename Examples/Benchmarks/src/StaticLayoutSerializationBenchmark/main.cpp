@@ -0,0 +1,567 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares the regular SOME/IP serialization of a static size struct with the fused static
+ *                       layout serialization.
+ *
+ *            \details   The struct routines below are written like the ones generated for a modeled struct. The
+ *                       regular path checks the buffer size and advances the writer or reader for every member. The
+ *                       fused path checks the size once and converts the big endian float array in one block. Both
+ *                       paths are measured with and without a length field in front of the struct. Like generated
+ *                       code, the struct routines are declared before the serializer templates that call them.
+ *                       For both length field sizes the checks verify that the fused path writes the same bytes as
+ *                       the regular path, that both paths read back the sample from the bytes of either path, that
+ *                       both paths reject every truncated buffer and too small length values, and that the fused
+ *                       serialization aborts on a too small buffer like the regular one.
+ *
+ *********************************************************************************************************************/
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "ara/core/array.h"
+#include "benchmark_util.h"
+#include "someip-protocol/internal/deserialization/deser_forward.h"
+#include "someip-protocol/internal/deserialization/reader.h"
+#include "someip-protocol/internal/serialization/infinity_size_t.h"
+#include "someip-protocol/internal/serialization/ser_forward.h"
+#include "someip-protocol/internal/serialization/writer.h"
+
+namespace {
+
+namespace someip_protocol = ::amsr::someip_protocol::internal;
+
+/*!
+ * \brief Sensor sample as an example of a modeled struct with static size.
+ */
+struct SensorSample {
+  /*!
+   * \brief Time stamp of the sample.
+   */
+  std::uint64_t timestamp{};
+  /*!
+   * \brief Status of the sensor.
+   */
+  std::uint16_t status{};
+  /*!
+   * \brief Measured values.
+   */
+  ara::core::Array<float, 64U> values{};
+  /*!
+   * \brief Calibration offsets.
+   */
+  ara::core::Array<std::int16_t, 16U> offsets{};
+  /*!
+   * \brief Quality indicator.
+   */
+  std::uint8_t quality{};
+};
+
+/*!
+ * \brief Static size of SensorSample on the wire.
+ */
+constexpr std::size_t kSensorSampleSize{8U + 2U + (64U * 4U) + (16U * 2U) + 1U};
+
+/*!
+ * \brief Length field configuration without length field.
+ */
+using NoLengthField = someip_protocol::LengthSize<0U, someip_protocol::BigEndian>;
+
+/*!
+ * \brief Length field configuration with a 32 bit length field.
+ */
+using LengthField = someip_protocol::LengthSize<4U, someip_protocol::BigEndian>;
+
+/*!
+ * \brief Transformation properties for serialization.
+ */
+using SerTpPack = someip_protocol::TpPack<
+    someip_protocol::BigEndian, someip_protocol::SizeOfArrayLengthField<0U>, someip_protocol::SizeOfVectorLengthField<4U>,
+    someip_protocol::SizeOfMapLengthField<4U>, someip_protocol::SizeOfStringLengthField<4U>,
+    someip_protocol::SizeOfStructLengthField<0U>, someip_protocol::SizeOfUnionLengthField<4U>,
+    someip_protocol::SizeOfUnionTypeSelectorField<4U>, someip_protocol::StringBomActive,
+    someip_protocol::StringNullTerminationActive, someip_protocol::serialization::DynamicLengthFieldSizeInactive,
+    someip_protocol::Utf8Encoding>;
+
+/*!
+ * \brief Transformation properties for deserialization.
+ */
+using DeserTpPack = someip_protocol::TpPack<
+    someip_protocol::BigEndian, someip_protocol::SizeOfArrayLengthField<0U>, someip_protocol::SizeOfVectorLengthField<4U>,
+    someip_protocol::SizeOfMapLengthField<4U>, someip_protocol::SizeOfStringLengthField<4U>,
+    someip_protocol::SizeOfStructLengthField<0U>, someip_protocol::SizeOfUnionLengthField<4U>,
+    someip_protocol::SizeOfUnionTypeSelectorField<4U>, someip_protocol::StringBomActive,
+    someip_protocol::StringNullTerminationActive, someip_protocol::Utf8Encoding>;
+
+}  // namespace
+
+namespace amsr {
+namespace someip_protocol {
+namespace internal {
+namespace serialization {
+
+class StaticLayoutWriter;
+
+template <typename TpPack>
+void SomeIpProtocolSerialize(Writer& w, SensorSample const& s) noexcept;
+template <typename TpPack>
+void SerializeStaticLayout(StaticLayoutWriter& w, SensorSample const& s) noexcept;
+template <typename TpPack>
+constexpr bool IsStaticSize(SizeToken<SensorSample>) noexcept;
+template <typename TpPack>
+constexpr bool IsStaticLayout(SizeToken<SensorSample>) noexcept;
+template <typename TpPack>
+constexpr InfSizeT GetMaximumBufferSize(SensorSample const&) noexcept;
+template <typename TpPack>
+constexpr std::size_t GetRequiredBufferSize(SensorSample const&) noexcept;
+
+}  // namespace serialization
+
+namespace deserialization {
+
+class StaticLayoutReader;
+
+template <typename TpPack>
+Result SomeIpProtocolDeserialize(Reader& r, SensorSample& s) noexcept;
+template <typename TpPack>
+Result DeserializeStaticLayout(StaticLayoutReader& r, SensorSample& s) noexcept;
+template <typename TpPack>
+constexpr std::size_t SomeIpProtocolGetStaticSize(SizeToken<SensorSample>) noexcept;
+
+}  // namespace deserialization
+}  // namespace internal
+}  // namespace someip_protocol
+}  // namespace amsr
+
+#include "someip-protocol/internal/deserialization/deser_static_layout.h"
+#include "someip-protocol/internal/deserialization/deser_wrapper.h"
+#include "someip-protocol/internal/serialization/ser_static_layout.h"
+#include "someip-protocol/internal/serialization/ser_wrapper.h"
+
+namespace amsr {
+namespace someip_protocol {
+namespace internal {
+namespace serialization {
+
+/*!
+ * \brief Serializes SensorSample member by member.
+ * \tparam TpPack Transformation properties.
+ * \param[in,out] w Writer holding the buffer.
+ * \param[in] s Struct to serialize.
+ */
+template <typename TpPack>
+void SomeIpProtocolSerialize(Writer& w, SensorSample const& s) noexcept {
+  SomeIpProtocolSerialize<TpPack, BigEndian>(w, s.timestamp);
+  SomeIpProtocolSerialize<TpPack, BigEndian>(w, s.status);
+  SomeIpProtocolSerialize<TpPack, LengthSize<0U, BigEndian>, BigEndian>(w, s.values);
+  SomeIpProtocolSerialize<TpPack, LengthSize<0U, BigEndian>, BigEndian>(w, s.offsets);
+  SomeIpProtocolSerialize<TpPack, BigEndian>(w, s.quality);
+}
+
+/*!
+ * \brief Serializes SensorSample into a region already checked for its static size.
+ * \tparam TpPack Transformation properties.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] s Struct to serialize.
+ */
+template <typename TpPack>
+void SerializeStaticLayout(StaticLayoutWriter& w, SensorSample const& s) noexcept {
+  SerializeStaticLayout<TpPack, BigEndian>(w, s.timestamp);
+  SerializeStaticLayout<TpPack, BigEndian>(w, s.status);
+  SerializeStaticLayout<TpPack, LengthSize<0U, BigEndian>, BigEndian>(w, s.values);
+  SerializeStaticLayout<TpPack, LengthSize<0U, BigEndian>, BigEndian>(w, s.offsets);
+  SerializeStaticLayout<TpPack, BigEndian>(w, s.quality);
+}
+
+/*!
+ * \brief SensorSample has a static size.
+ * \tparam TpPack Transformation properties.
+ * \return Always true.
+ */
+template <typename TpPack>
+constexpr bool IsStaticSize(SizeToken<SensorSample>) noexcept {
+  return true;
+}
+
+/*!
+ * \brief SensorSample has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \return Always true.
+ */
+template <typename TpPack>
+constexpr bool IsStaticLayout(SizeToken<SensorSample>) noexcept {
+  return true;
+}
+
+/*!
+ * \brief Maximum buffer size of SensorSample.
+ * \tparam TpPack Transformation properties.
+ * \return The static size.
+ */
+template <typename TpPack>
+constexpr InfSizeT GetMaximumBufferSize(SensorSample const&) noexcept {
+  return InfSizeT{kSensorSampleSize};
+}
+
+/*!
+ * \brief Required buffer size of SensorSample.
+ * \tparam TpPack Transformation properties.
+ * \return The static size.
+ */
+template <typename TpPack>
+constexpr std::size_t GetRequiredBufferSize(SensorSample const&) noexcept {
+  return kSensorSampleSize;
+}
+
+}  // namespace serialization
+
+namespace deserialization {
+
+/*!
+ * \brief Deserializes SensorSample member by member.
+ * \tparam TpPack Transformation properties.
+ * \param[in,out] r Reader holding the serialized data.
+ * \param[out] s Struct to deserialize into.
+ * \return true if deserialization was successful, false otherwise.
+ */
+template <typename TpPack>
+Result SomeIpProtocolDeserialize(Reader& r, SensorSample& s) noexcept {
+  return SomeIpProtocolDeserialize<TpPack, BigEndian>(r, s.timestamp) &&
+         SomeIpProtocolDeserialize<TpPack, BigEndian>(r, s.status) &&
+         SomeIpProtocolDeserialize<TpPack, LengthSize<0U, BigEndian>, BigEndian>(r, s.values) &&
+         SomeIpProtocolDeserialize<TpPack, LengthSize<0U, BigEndian>, BigEndian>(r, s.offsets) &&
+         SomeIpProtocolDeserialize<TpPack, BigEndian>(r, s.quality);
+}
+
+/*!
+ * \brief Deserializes SensorSample from a region already verified for its static size.
+ * \tparam TpPack Transformation properties.
+ * \param[in,out] r Reader for the verified region.
+ * \param[out] s Struct to deserialize into.
+ * \return true if deserialization was successful, false otherwise.
+ */
+template <typename TpPack>
+Result DeserializeStaticLayout(StaticLayoutReader& r, SensorSample& s) noexcept {
+  return DeserializeStaticLayout<TpPack, BigEndian>(r, s.timestamp) &&
+         DeserializeStaticLayout<TpPack, BigEndian>(r, s.status) &&
+         DeserializeStaticLayout<TpPack, LengthSize<0U, BigEndian>, BigEndian>(r, s.values) &&
+         DeserializeStaticLayout<TpPack, LengthSize<0U, BigEndian>, BigEndian>(r, s.offsets) &&
+         DeserializeStaticLayout<TpPack, BigEndian>(r, s.quality);
+}
+
+/*!
+ * \brief Static size of SensorSample.
+ * \tparam TpPack Transformation properties.
+ * \return The static size.
+ */
+template <typename TpPack>
+constexpr std::size_t SomeIpProtocolGetStaticSize(SizeToken<SensorSample>) noexcept {
+  return kSensorSampleSize;
+}
+
+}  // namespace deserialization
+}  // namespace internal
+}  // namespace someip_protocol
+}  // namespace amsr
+
+namespace {
+
+/*!
+ * \brief Number of serializations or deserializations per repetition.
+ */
+constexpr std::uint64_t kIterations{200000U};
+
+/*!
+ * \brief Creates a sample with distinct values in every member.
+ * \return The sample.
+ */
+SensorSample MakeSample() noexcept {
+  SensorSample sample{};
+  sample.timestamp = 0x0123456789ABCDEFULL;
+  sample.status = 0x5AA5U;
+  for (std::size_t index{0U}; index < sample.values.size(); ++index) {
+    sample.values[index] = static_cast<float>(index) * 0.25F;
+  }
+  for (std::size_t index{0U}; index < sample.offsets.size(); ++index) {
+    sample.offsets[index] = static_cast<std::int16_t>(index) - 8;
+  }
+  sample.quality = 3U;
+  return sample;
+}
+
+/*!
+ * \brief Compares two samples member by member.
+ * \param[in] lhs First sample.
+ * \param[in] rhs Second sample.
+ * \return True if all members are equal.
+ */
+bool IsEqual(SensorSample const& lhs, SensorSample const& rhs) noexcept {
+  return (lhs.timestamp == rhs.timestamp) && (lhs.status == rhs.status) && (lhs.values == rhs.values) &&
+         (lhs.offsets == rhs.offsets) && (lhs.quality == rhs.quality);
+}
+
+/*!
+ * \brief Serializes a sample into a buffer of its exact size.
+ * \tparam Head Length field configuration of the sample.
+ * \param[in] sample The sample.
+ * \param[in] fused Whether the fused static layout serialization is used.
+ * \return The serialized bytes.
+ */
+template <typename Head>
+std::vector<std::uint8_t> Serialize(SensorSample const& sample, bool fused) noexcept {
+  std::vector<std::uint8_t> buffer(Head::value + kSensorSampleSize, 0xEEU);
+  someip_protocol::serialization::Writer writer{
+      someip_protocol::serialization::BufferView{buffer.data(), buffer.size()}};
+  if (fused) {
+    someip_protocol::serialization::SomeIpProtocolSerializeStaticLayout<SerTpPack, Head>(writer, sample);
+  } else {
+    someip_protocol::serialization::SomeIpProtocolSerialize<SerTpPack, Head>(writer, sample);
+  }
+  return buffer;
+}
+
+/*!
+ * \brief Deserializes a sample.
+ * \tparam Head Length field configuration of the sample.
+ * \param[in] buffer The serialized bytes.
+ * \param[in] size Number of bytes of the buffer passed to the reader.
+ * \param[in] fused Whether the fused static layout deserialization is used.
+ * \param[out] sample The sample.
+ * \param[out] remaining Number of bytes left in the reader.
+ * \return The result of the deserialization.
+ */
+template <typename Head>
+bool Deserialize(std::vector<std::uint8_t> const& buffer, std::size_t size, bool fused, SensorSample& sample,
+                 std::size_t& remaining) noexcept {
+  someip_protocol::deserialization::Reader reader{someip_protocol::deserialization::BufferView{buffer.data(), size}};
+  bool result{false};
+  if (fused) {
+    result = someip_protocol::deserialization::SomeIpProtocolDeserializeStaticLayout<DeserTpPack, Head>(reader, sample);
+  } else {
+    result = reader.VerifySize(someip_protocol::deserialization::SomeIpProtocolGetStaticSize<DeserTpPack, Head>(
+                 someip_protocol::deserialization::SizeToken<SensorSample>{})) &&
+             someip_protocol::deserialization::SomeIpProtocolDeserialize<DeserTpPack, Head>(reader, sample);
+  }
+  remaining = reader.Size();
+  return result;
+}
+
+/*!
+ * \brief Checks that the fused serialization writes the same bytes as the regular serialization.
+ * \tparam Head Length field configuration of the sample.
+ * \return True if the bytes are equal.
+ */
+template <typename Head>
+bool CheckSameBytes() noexcept {
+  SensorSample const sample{MakeSample()};
+  return Serialize<Head>(sample, true) == Serialize<Head>(sample, false);
+}
+
+/*!
+ * \brief Checks that both deserialization paths read back the sample from the bytes of both serialization paths.
+ * \tparam Head Length field configuration of the sample.
+ * \return True if every combination returns the sample and consumes all bytes.
+ */
+template <typename Head>
+bool CheckRoundTrip() noexcept {
+  SensorSample const expected{MakeSample()};
+  bool passed{true};
+  for (bool const fused_serialize : {false, true}) {
+    std::vector<std::uint8_t> const buffer{Serialize<Head>(expected, fused_serialize)};
+    for (bool const fused_deserialize : {false, true}) {
+      SensorSample sample{};
+      std::size_t remaining{buffer.size()};
+      passed = Deserialize<Head>(buffer, buffer.size(), fused_deserialize, sample, remaining) &&
+               IsEqual(sample, expected) && (remaining == 0U) && passed;
+    }
+  }
+  return passed;
+}
+
+/*!
+ * \brief Checks that both deserialization paths reject every truncated buffer.
+ * \tparam Head Length field configuration of the sample.
+ * \return True if every truncated buffer is rejected by both paths.
+ */
+template <typename Head>
+bool CheckShortBuffer() noexcept {
+  std::vector<std::uint8_t> const buffer{Serialize<Head>(MakeSample(), false)};
+  bool passed{true};
+  for (std::size_t size{0U}; size < buffer.size(); ++size) {
+    for (bool const fused : {false, true}) {
+      SensorSample sample{};
+      std::size_t remaining{0U};
+      passed = (!Deserialize<Head>(buffer, size, fused, sample, remaining)) && passed;
+    }
+  }
+  return passed;
+}
+
+/*!
+ * \brief Checks the handling of length values other than the static size by both deserialization paths.
+ * \details A smaller length value is rejected. A larger length value is accepted and the bytes after the struct
+ *          are skipped.
+ * \return True if both paths behave as described.
+ */
+bool CheckLengthValues() noexcept {
+  SensorSample const expected{MakeSample()};
+  std::vector<std::uint8_t> const serialized{Serialize<LengthField>(expected, false)};
+  bool passed{true};
+  for (std::uint32_t const length : {static_cast<std::uint32_t>(kSensorSampleSize - 1U),
+                                     static_cast<std::uint32_t>(kSensorSampleSize + 8U)}) {
+    std::vector<std::uint8_t> buffer{serialized};
+    buffer.resize(LengthField::value + length, 0U);
+    buffer[0U] = static_cast<std::uint8_t>(length >> 24U);
+    buffer[1U] = static_cast<std::uint8_t>(length >> 16U);
+    buffer[2U] = static_cast<std::uint8_t>(length >> 8U);
+    buffer[3U] = static_cast<std::uint8_t>(length);
+    bool const accepted{length >= kSensorSampleSize};
+    for (bool const fused : {false, true}) {
+      SensorSample sample{};
+      std::size_t remaining{buffer.size()};
+      bool const result{Deserialize<LengthField>(buffer, buffer.size(), fused, sample, remaining)};
+      passed = (result == accepted) && ((!accepted) || (IsEqual(sample, expected) && (remaining == 0U))) && passed;
+    }
+  }
+  return passed;
+}
+
+/*!
+ * \brief Checks that the fused serialization aborts on a buffer one byte too small, like the regular one.
+ * \details Both serializations run in a child process, as the violation terminates the process.
+ * \tparam Head Length field configuration of the sample.
+ * \return True if both serializations terminated the child process abnormally.
+ */
+template <typename Head>
+bool CheckSerializeAbortsOnShortBuffer() noexcept {
+  bool passed{true};
+  for (bool const fused : {false, true}) {
+    static_cast<void>(std::fflush(stdout));
+    pid_t const child{::fork()};
+    if (child == 0) {
+      SensorSample const sample{MakeSample()};
+      std::vector<std::uint8_t> buffer(Head::value + kSensorSampleSize - 1U);
+      someip_protocol::serialization::Writer writer{
+          someip_protocol::serialization::BufferView{buffer.data(), buffer.size()}};
+      if (fused) {
+        someip_protocol::serialization::SomeIpProtocolSerializeStaticLayout<SerTpPack, Head>(writer, sample);
+      } else {
+        someip_protocol::serialization::SomeIpProtocolSerialize<SerTpPack, Head>(writer, sample);
+      }
+      std::_Exit(0);
+    }
+    int status{0};
+    passed = (child > 0) && (::waitpid(child, &status, 0) == child) &&
+             (!(WIFEXITED(status) && (WEXITSTATUS(status) == 0))) && passed;
+  }
+  return passed;
+}
+
+/*!
+ * \brief Measures the serialization of a sample.
+ * \tparam Head Length field configuration of the sample.
+ * \tparam Fused Whether the fused static layout serialization is used.
+ * \return Time per serialization in nanoseconds.
+ */
+template <typename Head, bool Fused>
+double MeasureSerialize() noexcept {
+  SensorSample const sample{MakeSample()};
+  std::vector<std::uint8_t> buffer(Head::value + kSensorSampleSize);
+  return benchmark::MeasureNsPerOp(kIterations, [&sample, &buffer](std::uint64_t) {
+    someip_protocol::serialization::Writer writer{
+        someip_protocol::serialization::BufferView{buffer.data(), buffer.size()}};
+    if (Fused) {
+      someip_protocol::serialization::SomeIpProtocolSerializeStaticLayout<SerTpPack, Head>(writer, sample);
+    } else {
+      someip_protocol::serialization::SomeIpProtocolSerialize<SerTpPack, Head>(writer, sample);
+    }
+    benchmark::DoNotOptimize(buffer.data()[buffer.size() - 1U]);
+  });
+}
+
+/*!
+ * \brief Measures the deserialization of a sample.
+ * \tparam Head Length field configuration of the sample.
+ * \tparam Fused Whether the fused static layout deserialization is used.
+ * \return Time per deserialization in nanoseconds.
+ */
+template <typename Head, bool Fused>
+double MeasureDeserialize() noexcept {
+  std::vector<std::uint8_t> buffer(Head::value + kSensorSampleSize);
+  someip_protocol::serialization::Writer writer{
+      someip_protocol::serialization::BufferView{buffer.data(), buffer.size()}};
+  someip_protocol::serialization::SomeIpProtocolSerialize<SerTpPack, Head>(writer, MakeSample());
+  SensorSample sample{};
+  return benchmark::MeasureNsPerOp(kIterations, [&sample, &buffer](std::uint64_t) {
+    someip_protocol::deserialization::Reader reader{
+        someip_protocol::deserialization::BufferView{buffer.data(), buffer.size()}};
+    bool result{false};
+    if (Fused) {
+      result = someip_protocol::deserialization::SomeIpProtocolDeserializeStaticLayout<DeserTpPack, Head>(reader, sample);
+    } else {
+      result = reader.VerifySize(someip_protocol::deserialization::SomeIpProtocolGetStaticSize<DeserTpPack, Head>(
+                   someip_protocol::deserialization::SizeToken<SensorSample>{})) &&
+               someip_protocol::deserialization::SomeIpProtocolDeserialize<DeserTpPack, Head>(reader, sample);
+    }
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(sample.quality);
+  });
+}
+
+/*!
+ * \brief Measures and reports all cases and checks for one length field configuration.
+ * \tparam Head Length field configuration of the sample.
+ * \param[in] variant Description of the length field configuration.
+ * \return True if all checks passed.
+ */
+template <typename Head>
+bool Run(char const* variant) noexcept {
+  std::uint64_t const bytes{Head::value + kSensorSampleSize};
+  char name[64];
+  static_cast<void>(std::snprintf(name, sizeof(name), "regular, %s", variant));
+  benchmark::ReportThroughput("serialize", name, bytes, MeasureSerialize<Head, false>());
+  static_cast<void>(std::snprintf(name, sizeof(name), "static layout, %s", variant));
+  benchmark::ReportThroughput("serialize", name, bytes, MeasureSerialize<Head, true>());
+  static_cast<void>(std::snprintf(name, sizeof(name), "regular, %s", variant));
+  benchmark::ReportThroughput("deserialize", name, bytes, MeasureDeserialize<Head, false>());
+  static_cast<void>(std::snprintf(name, sizeof(name), "static layout, %s", variant));
+  benchmark::ReportThroughput("deserialize", name, bytes, MeasureDeserialize<Head, true>());
+
+  static_cast<void>(std::snprintf(name, sizeof(name), "same bytes, %s", variant));
+  bool passed{benchmark::ReportCheck("static layout", name, CheckSameBytes<Head>())};
+  static_cast<void>(std::snprintf(name, sizeof(name), "round trip, %s", variant));
+  passed = benchmark::ReportCheck("static layout", name, CheckRoundTrip<Head>()) && passed;
+  static_cast<void>(std::snprintf(name, sizeof(name), "short buffer rejected, %s", variant));
+  passed = benchmark::ReportCheck("static layout", name, CheckShortBuffer<Head>()) && passed;
+  static_cast<void>(std::snprintf(name, sizeof(name), "aborts on short buffer, %s", variant));
+  passed = benchmark::ReportCheck("static layout", name, CheckSerializeAbortsOnShortBuffer<Head>()) && passed;
+  return passed;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry point of the static layout serialization benchmark.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool passed{Run<NoLengthField>("no length field")};
+  passed = Run<LengthField>("32 bit length field") && passed;
+  passed = benchmark::ReportCheck("static layout", "length values, 32 bit length field", CheckLengthValues()) && passed;
+  return passed ? 0 : 1;
+}
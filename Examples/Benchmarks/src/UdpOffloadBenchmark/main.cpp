@@ -0,0 +1,214 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *                Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *
+ *               \file   main.cpp
+ *              \brief   Compares UDP burst transmission with and without generic segmentation / receive offload.
+ *
+ *            \details   A burst of equally sized datagrams is sent over the loopback interface to one receiver and
+ *                       drained again. Measured send variants: one SendToSync() per datagram, SendToSyncBulk()
+ *                       (sendmmsg) and SendToSyncSegmented() (UDP GSO). The receiver drains with ReceiveFromSync() or,
+ *                       with SockOptUdpGro enabled, with ReceiveFromSyncCoalesced(). Before measuring, the UDP GSO
+ *                       size limits of SendToSyncSegmented() are checked.
+ *
+ *********************************************************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "amsr/net/ip/udp.h"
+#include "benchmark_util.h"
+
+namespace {
+
+/*!
+ * \brief Payload size of one datagram.
+ */
+constexpr std::size_t kDatagramSize{1200U};
+
+/*!
+ * \brief Number of datagrams per burst.
+ */
+constexpr std::size_t kBurstSize{32U};
+
+/*!
+ * \brief Number of measured bursts per repetition.
+ */
+constexpr std::uint64_t kBursts{2000U};
+
+/*!
+ * \brief Loopback sender and receiver socket pair.
+ */
+struct SocketPair {
+  amsr::net::ip::Udp::Socket sender{};
+  amsr::net::ip::Udp::Socket receiver{};
+  amsr::net::ip::Udp::Endpoint destination{amsr::net::ip::Udp::V4()};
+};
+
+/*!
+ * \brief Opens and binds a loopback socket pair.
+ * \param[in] enable_gro Enables UDP GRO on the receiver.
+ * \return true if the sockets are usable.
+ */
+bool OpenSocketPair(SocketPair& pair, bool enable_gro) {
+  amsr::net::ip::Udp::Endpoint const any_port{
+      amsr::net::ip::Udp::Endpoint::MakeEndpoint("127.0.0.1", amsr::net::ip::Port{0U}).Value()};
+  bool ok{pair.sender.Open(amsr::net::ip::Udp::V4()).HasValue() && pair.sender.Bind(any_port).HasValue() &&
+          pair.receiver.Open(amsr::net::ip::Udp::V4()).HasValue() && pair.receiver.Bind(any_port).HasValue()};
+  if (ok && enable_gro) {
+    ok = pair.receiver.SetOption(amsr::net::ip::Udp::Socket::SockOptUdpGro{true}).HasValue();
+  }
+  if (ok) {
+    ::amsr::core::Result<amsr::net::ip::Udp::Endpoint> const local{pair.receiver.GetLocalEndpoint()};
+    ok = local.HasValue();
+    if (ok) {
+      pair.destination = local.Value();
+    }
+  }
+  return ok;
+}
+
+/*!
+ * \brief Receives all datagrams of one burst.
+ * \return Number of received datagrams.
+ */
+std::size_t DrainBurst(SocketPair& pair, std::vector<std::uint8_t>& buffer, bool coalesced) {
+  std::size_t received{0U};
+  while (received < kBurstSize) {
+    ::amsr::core::Span<std::uint8_t> const view{buffer.data(), buffer.size()};
+    if (coalesced) {
+      ::amsr::core::Result<amsr::net::ip::Udp::Socket::CoalescedDatagramInfo> const info{
+          pair.receiver.ReceiveFromSyncCoalesced(view)};
+      if (!info.HasValue()) {
+        break;
+      }
+      std::size_t const segment{(info.Value().segment_size == 0U) ? info.Value().datagram_size
+                                                                   : info.Value().segment_size};
+      received += (info.Value().datagram_size + segment - 1U) / segment;
+    } else {
+      if (!pair.receiver.ReceiveFromSync(view).HasValue()) {
+        break;
+      }
+      ++received;
+    }
+  }
+  return received;
+}
+
+/*!
+ * \brief Send variants.
+ */
+enum class SendVariant : std::uint8_t { kSendTo, kSendmmsg, kGso };
+
+/*!
+ * \brief Measures one burst of the given send variant including draining it at the receiver.
+ */
+void MeasureBurst(char const* name, SendVariant variant, bool enable_gro) {
+  SocketPair pair{};
+  if (!OpenSocketPair(pair, enable_gro)) {
+    std::printf("%-28s %-44s %s\n", "UDP offload", name, "not supported");
+    return;
+  }
+  std::vector<std::uint8_t> const payload(kDatagramSize * kBurstSize, 0xA5U);
+  std::vector<std::uint8_t> receive_buffer(amsr::net::internal::kMaxUdpOffloadSize);
+  std::vector<osabstraction::io::ConstIOBuffer> datagram_buffers{};
+  std::vector<std::pair<::amsr::core::Span<osabstraction::io::ConstIOBuffer>, amsr::net::ip::Udp::Endpoint>>
+      bulk{};
+  for (std::size_t i{0U}; i < kBurstSize; ++i) {
+    datagram_buffers.push_back(osabstraction::io::ConstIOBuffer{&payload[i * kDatagramSize], kDatagramSize});
+  }
+  for (std::size_t i{0U}; i < kBurstSize; ++i) {
+    bulk.emplace_back(::amsr::core::Span<osabstraction::io::ConstIOBuffer>{&datagram_buffers[i], 1U},
+                      pair.destination);
+  }
+  osabstraction::io::ConstIOBuffer const whole_burst{payload.data(), payload.size()};
+  bool failed{false};
+
+  double const ns{benchmark::MeasureNsPerOp(kBursts, [&](std::uint64_t) {
+    switch (variant) {
+      case SendVariant::kSendTo:
+        for (osabstraction::io::ConstIOBuffer const& datagram : datagram_buffers) {
+          ::amsr::core::Span<osabstraction::io::ConstIOBuffer const> const single{&datagram, 1U};
+          failed = failed || (!pair.sender.SendToSync(single, pair.destination).HasValue());
+        }
+        break;
+      case SendVariant::kSendmmsg:
+        failed = failed || (!pair.sender.SendToSyncBulk({bulk.data(), bulk.size()}).HasValue());
+        break;
+      case SendVariant::kGso:
+        failed = failed || (!pair.sender
+                                 .SendToSyncSegmented({&whole_burst, 1U}, static_cast<std::uint16_t>(kDatagramSize),
+                                                      pair.destination)
+                                 .HasValue());
+        break;
+    }
+    benchmark::DoNotOptimize(DrainBurst(pair, receive_buffer, enable_gro));
+  })};
+  if (failed) {
+    std::printf("%-28s %-44s %s\n", "UDP offload", name, "not supported");
+  } else {
+    benchmark::ReportThroughput("UDP offload", name, kDatagramSize * kBurstSize, ns);
+  }
+}
+
+/*!
+ * \brief Checks that SendToSyncSegmented() rejects payloads that violate the UDP GSO limits without sending.
+ * \return True if all checks passed or the socket pair could not be opened.
+ */
+bool CheckSegmentLimits() {
+  SocketPair pair{};
+  bool passed{true};
+  if (OpenSocketPair(pair, false)) {
+    std::vector<std::uint8_t> const payload(amsr::net::internal::kMaxUdpOffloadSize + 1U, 0xA5U);
+    osabstraction::io::ConstIOBuffer const oversized{payload.data(), payload.size()};
+    osabstraction::io::ConstIOBuffer const too_many_segments{payload.data(),
+                                                             amsr::net::internal::kMaxUdpGsoSegments + 1U};
+    osabstraction::io::ConstIOBuffer const max_segments{payload.data(), amsr::net::internal::kMaxUdpGsoSegments};
+
+    ::amsr::core::Result<void> const zero{pair.sender.SendToSyncSegmented({&max_segments, 1U}, 0U, pair.destination)};
+    passed = benchmark::ReportCheck("UDP offload", "GSO segment size 0 rejected",
+                                    (!zero.HasValue()) && (zero.Error() == osabstraction::OsabErrc::kApiError)) &&
+             passed;
+
+    ::amsr::core::Result<void> const size{
+        pair.sender.SendToSyncSegmented({&oversized, 1U}, static_cast<std::uint16_t>(kDatagramSize), pair.destination)};
+    passed = benchmark::ReportCheck(
+                 "UDP offload", "GSO payload above offload size rejected",
+                 (!size.HasValue()) && (size.Error() == osabstraction::OsabErrc::kSystemEnvironmentError)) &&
+             passed;
+
+    ::amsr::core::Result<void> const segments{
+        pair.sender.SendToSyncSegmented({&too_many_segments, 1U}, 1U, pair.destination)};
+    passed = benchmark::ReportCheck(
+                 "UDP offload", "GSO segment count above limit rejected",
+                 (!segments.HasValue()) && (segments.Error() == osabstraction::OsabErrc::kSystemEnvironmentError)) &&
+             passed;
+  }
+  return passed;
+}
+
+}  // namespace
+
+/*!
+ * \brief Entry Point of the process.
+ * \return Zero when successfully executed, one if a check failed.
+ */
+int main() {
+  bool const checks_passed{CheckSegmentLimits()};
+  MeasureBurst("sendto x32, recvfrom", SendVariant::kSendTo, false);
+  MeasureBurst("sendmmsg x32, recvfrom", SendVariant::kSendmmsg, false);
+  MeasureBurst("GSO x32, recvfrom", SendVariant::kGso, false);
+  MeasureBurst("GSO x32, GRO receive", SendVariant::kGso, true);
+  return checks_passed ? 0 : 1;
+}
@@ -27,6 +27,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include "someip-protocol/internal/serialization/ser_static_layout.h"
 #include "someip-protocol/internal/serialization/ser_wrapper.h"
 
 #include "amsr/someip_protocol/internal/dataprototype_serialization/services_speedlimitservice/events/serializer_SpeedOverLimitEvent.h"
@@ -40,8 +41,8 @@ namespace events {
 
 void SerializerSpeedOverLimitEvent::Serialize(serialization::Writer
 &writer, ::datatypes::OverLimitEnum const& data) noexcept {
-  // Serialize byte stream
-  serialization::SomeIpProtocolSerialize<
+  // Serialize byte stream with a single buffer size check, the data type has a static layout
+  serialization::SomeIpProtocolSerializeStaticLayout<
       TpPackDataPrototype,
       // Byte-order of primitive datatype (/Datatypes/OverLimitEnum)
       typename serialization::Tp<TpPackDataPrototype>::ByteOrder
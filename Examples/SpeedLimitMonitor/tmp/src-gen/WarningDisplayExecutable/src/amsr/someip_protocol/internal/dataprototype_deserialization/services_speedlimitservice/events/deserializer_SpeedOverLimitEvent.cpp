@@ -27,6 +27,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include "someip-protocol/internal/deserialization/deser_static_layout.h"
 #include "someip-protocol/internal/deserialization/deser_wrapper.h"
 #include "amsr/someip_protocol/internal/dataprototype_deserialization/services_speedlimitservice/events/deserializer_SpeedOverLimitEvent.h"
 
@@ -53,24 +54,13 @@ deserialization::Result DeserializerSpeedOverLimitEvent::Deserialize(deserializa
         Utf8Encoding>;
 
 
-  // Verify static size
-  constexpr std::size_t static_size{deserialization::SomeIpProtocolGetStaticSize<
-      TpPackAlias,
-        // Byte-order of primitive datatype (/Datatypes/OverLimitEnum)
-      typename deserialization::Tp<TpPackAlias>::ByteOrder
-
-      >(deserialization::SizeToken<::datatypes::OverLimitEnum>{})};
-
-  deserialization::Result result{reader.VerifySize(static_size)};
-  if (result) {
-    // Deserialize byte stream
-    result = deserialization::SomeIpProtocolDeserialize<
+  // Verify the static size once and deserialize the byte stream, the data type has a static layout
+  deserialization::Result const result{deserialization::SomeIpProtocolDeserializeStaticLayout<
       TpPackAlias,
       // Byte-order of primitive datatype (/Datatypes/OverLimitEnum)
       typename deserialization::Tp<TpPackAlias>::ByteOrder
 
-      >(reader, data);
-  }
+      >(reader, data)};
 
   return result;
 }
@@ -0,0 +1,824 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**       \file     indexed_input_stream.h
+ *        \brief    Input stream over a complete in-memory JSON document with a structural index.
+ *
+ *        \details  The document is memory mapped (or read in one piece if the file cannot be mapped) and indexed by a
+ *                  StructuralIndex once. Afterwards all stream operations work on memory: single characters are taken
+ *                  without any buffer management and the searches used by the JSON readers to skip whitespace and to
+ *                  find string delimiters are answered from the index instead of testing every character.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_INDEXED_INPUT_STREAM_H_
+#define LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_INDEXED_INPUT_STREAM_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "amsr/core/result.h"
+#include "amsr/core/span.h"
+#include "amsr/core/string.h"
+#include "amsr/core/string_view.h"
+#include "amsr/iostream/input_stream.h"
+#include "amsr/iostream/stream_error_domain.h"
+#include "amsr/json/reader/internal/structural_index.h"
+#include "ara/core/vector.h"
+#include "vac/language/byte.h"
+#include "vac/language/function_ref.h"
+
+namespace amsr {
+namespace json {
+namespace internal {
+
+/*!
+ * \brief Input stream over an indexed in-memory JSON document.
+ */
+class IndexedInputStream final : public stream::InputStream {
+ public:
+  /*!
+   * \brief Open a file, load it into memory and index it.
+   * \param path The path to the file.
+   * \return The stream.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \error{StreamErrorDomain, StreamErrc::kNoSuchFileOrDirectory, if the file does not exist.}
+   * \error{StreamErrorDomain, StreamErrc::kIoError, if the file cannot be opened or read.}
+   * \vprivate
+   *
+   * \internal
+   * - Open the file and map it read-only into memory.
+   * - If the file cannot be mapped (e.g. a pipe or a pseudo file without size), read it completely into a buffer.
+   * - Build the structural index.
+   * \endinternal
+   */
+  static auto FromFile(amsr::core::StringView path) noexcept
+      -> amsr::core::Result<std::unique_ptr<IndexedInputStream>> {
+    using R = amsr::core::Result<std::unique_ptr<IndexedInputStream>>;
+    R result{stream::MakeErrorCode(stream::StreamErrc::kIoError, "IndexedInputStream: File could not be read.")};
+    amsr::core::String const null_terminated_path{path.data(), path.size()};
+    int const fd{::open(null_terminated_path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fd < 0) {
+      if (errno == ENOENT) {
+        result.EmplaceError(stream::MakeErrorCode(stream::StreamErrc::kNoSuchFileOrDirectory,
+                                                  "IndexedInputStream: File does not exist."));
+      }
+    } else {
+      std::unique_ptr<IndexedInputStream> input_stream{new IndexedInputStream{}};
+      struct stat file_status {};
+      if ((::fstat(fd, &file_status) == 0) && S_ISREG(file_status.st_mode) && (file_status.st_size > 0)) {
+        std::size_t const size{static_cast<std::size_t>(file_status.st_size)};
+        void* const address{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0)};
+        if (address != MAP_FAILED) {
+          input_stream->mapping_ = address;
+          input_stream->mapping_size_ = size;
+          input_stream->document_ = amsr::core::Span<char const>{static_cast<char const*>(address), size};
+        }
+      }
+      bool read_ok{true};
+      if (input_stream->mapping_ == nullptr) {
+        read_ok = ReadAll(fd, input_stream->buffer_);
+        input_stream->document_ =
+            amsr::core::Span<char const>{input_stream->buffer_.data(), input_stream->buffer_.size()};
+      }
+      static_cast<void>(::close(fd));
+      if (read_ok) {
+        input_stream->index_.Build(input_stream->document_);
+        result.EmplaceValue(std::move(input_stream));
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Construct a stream over a buffer and index it.
+   * \param document The document. Must outlive the stream.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  explicit IndexedInputStream(amsr::core::Span<char const> document) noexcept : InputStream(), document_{document} {
+    index_.Build(document_);
+  }
+
+  /*! \brief Deleted copy constructor. */
+  IndexedInputStream(IndexedInputStream const&) = delete;
+  /*! \brief Deleted move constructor. */
+  IndexedInputStream(IndexedInputStream&&) = delete;
+  /*! \brief Deleted copy assignment. */
+  auto operator=(IndexedInputStream const&) -> IndexedInputStream& = delete;
+  /*! \brief Deleted move assignment. */
+  auto operator=(IndexedInputStream&&) -> IndexedInputStream& = delete;
+
+  /*!
+   * \brief Unmap the document, if it has been mapped.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ~IndexedInputStream() noexcept final {
+    if (mapping_ != nullptr) {
+      static_cast<void>(::munmap(mapping_, mapping_size_));
+    }
+  }
+
+  /*!
+   * \brief Returns the current position.
+   * \return The current position, measured in bytes from the beginning of the document.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Tell() const noexcept -> amsr::core::Result<std::uint64_t> final {
+    return amsr::core::Result<std::uint64_t>{static_cast<std::uint64_t>(position_)};
+  }
+
+  /*!
+   * \brief Changes the position.
+   * \param offset Offset to change the position with.
+   * \param whence Specifies how the offset is interpreted.
+   * \return The updated position.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidArgument, if the resulting position is outside of the document.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Seek(std::int64_t offset, stream::SeekDirection whence) noexcept -> amsr::core::Result<std::uint64_t> final {
+    std::int64_t base{0};
+    if (whence == stream::SeekDirection::kCur) {
+      base = static_cast<std::int64_t>(position_);
+    } else if (whence == stream::SeekDirection::kEnd) {
+      base = static_cast<std::int64_t>(document_.size());
+    } else {
+      // Relative to the beginning.
+    }
+    std::int64_t const target{base + offset};
+    amsr::core::Result<std::uint64_t> result{
+        stream::MakeErrorCode(stream::StreamErrc::kInvalidArgument, "IndexedInputStream::Seek: Invalid position.")};
+    if ((target >= 0) && (static_cast<std::uint64_t>(target) <= document_.size())) {
+      position_ = static_cast<std::size_t>(target);
+      result.EmplaceValue(static_cast<std::uint64_t>(position_));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Copies up to the size of the buffer bytes into the buffer.
+   * \param buffer The buffer.
+   * \return The part of the buffer that has been filled.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidArgument, if the buffer is empty.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Read(amsr::core::Span<vac::language::byte> buffer) noexcept
+      -> amsr::core::Result<amsr::core::Span<vac::language::byte>> final {
+    amsr::core::Result<amsr::core::Span<vac::language::byte>> result{
+        stream::MakeErrorCode(stream::StreamErrc::kInvalidArgument, "IndexedInputStream::Read: Empty buffer.")};
+    if (!buffer.empty()) {
+      std::size_t const count{CopyOut(buffer.data(), buffer.size())};
+      result.EmplaceValue(buffer.first(count));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Copies up to the size of the buffer chars into the buffer.
+   * \param buffer The buffer.
+   * \return The part of the buffer that has been filled.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidArgument, if the buffer is empty.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Read(amsr::core::Span<char> buffer) noexcept -> amsr::core::Result<amsr::core::Span<char>> final {
+    amsr::core::Result<amsr::core::Span<char>> result{
+        stream::MakeErrorCode(stream::StreamErrc::kInvalidArgument, "IndexedInputStream::Read: Empty buffer.")};
+    if (!buffer.empty()) {
+      std::size_t const count{CopyOut(buffer.data(), buffer.size())};
+      result.EmplaceValue(buffer.first(count));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Reads up to \c count bytes without copying.
+   * \param count Maximum number of bytes to read.
+   * \return View on the document, empty at EOF.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Read(std::uint64_t count) noexcept -> amsr::core::Result<amsr::core::Span<char const>> final {
+    amsr::core::Span<char const> const view{TakeView(count)};
+    return amsr::core::Result<amsr::core::Span<char const>>{view};
+  }
+
+  /*!
+   * \brief Reads up to \c count bytes without copying and provides them to the callback.
+   * \param count Maximum number of bytes to read.
+   * \param callback Called once with the read bytes, if any.
+   * \return The number of read bytes.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Read(std::uint64_t count, vac::language::FunctionRef<void(amsr::core::StringView)> callback) noexcept
+      -> amsr::core::Result<std::uint64_t> final {
+    amsr::core::Span<char const> const view{TakeView(count)};
+    if (!view.empty()) {
+      callback(amsr::core::StringView{view.data(), view.size()});
+    }
+    return amsr::core::Result<std::uint64_t>{static_cast<std::uint64_t>(view.size())};
+  }
+
+  /*!
+   * \brief Reads while the predicate holds.
+   * \param pred Predicate deciding if a character is read.
+   * \return View on all matching characters.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto ReadWhile(vac::language::FunctionRef<bool(char)> pred) noexcept
+      -> amsr::core::Result<amsr::core::Span<char const>> final {
+    std::size_t end{position_};
+    while ((end < document_.size()) && pred(document_[end])) {
+      ++end;
+    }
+    return amsr::core::Result<amsr::core::Span<char const>>{TakeView(end - position_)};
+  }
+
+  /*!
+   * \brief Reads until one of the delimiters is found.
+   * \param delimiter The set of delimiters. The found delimiter is not consumed.
+   * \param callback Called once with the characters before the delimiter, if any.
+   * \return The found delimiter, or EOF.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidArgument, if no delimiters are given.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto ReadUntil(amsr::core::StringView delimiter,
+                 vac::language::FunctionRef<void(amsr::core::StringView)> callback) noexcept
+      -> amsr::core::Result<std::int64_t> final {
+    // The error is only created if needed, as the readers call this for every string.
+    amsr::core::Result<std::int64_t> result{static_cast<std::int64_t>(std::char_traits<char>::eof())};
+    if (delimiter.empty()) {
+      result.EmplaceError(
+          stream::MakeErrorCode(stream::StreamErrc::kInvalidArgument, "IndexedInputStream::ReadUntil: No delimiters."));
+    } else {
+      std::size_t const found{FindInSet(position_, delimiter)};
+      amsr::core::Span<char const> const view{TakeView(found - position_)};
+      if (!view.empty()) {
+        callback(amsr::core::StringView{view.data(), view.size()});
+      }
+      result.EmplaceValue(CharAt(found));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Moves to the first character matching the predicate.
+   * \param pred Predicate deciding if a character matches.
+   * \return Position of the found character.
+   * \error{StreamErrorDomain, StreamErrc::kEndOfFile, if no character matches.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Find(vac::language::FunctionRef<bool(char)> pred) noexcept -> amsr::core::Result<std::uint64_t> final {
+    while ((position_ < document_.size()) && (!pred(document_[position_]))) {
+      ++position_;
+    }
+    return FoundAt(position_);
+  }
+
+  /*!
+   * \brief Moves to the first character contained in the set.
+   * \param set The set of characters.
+   * \return Position of the found character.
+   * \error{StreamErrorDomain, StreamErrc::kEndOfFile, if no character matches.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Find(amsr::core::StringView set) noexcept -> amsr::core::Result<std::uint64_t> final {
+    position_ = FindInSet(position_, set);
+    return FoundAt(position_);
+  }
+
+  /*!
+   * \brief Moves to the first character not contained in the set, or to EOF.
+   * \param set The set of characters.
+   * \return Position of the first mismatch.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidArgument, if the set is empty.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   *
+   * \internal
+   * - Test the next kLinearProbe characters directly, whitespace between tokens is mostly short.
+   * - If the set consists of complete character classes (e.g. all JSON whitespace characters), find the first
+   *   character of any other class using the index.
+   * - Otherwise test every character.
+   * \endinternal
+   */
+  auto FindNot(amsr::core::StringView set) noexcept -> amsr::core::Result<std::uint64_t> final {
+    // The error is only created if needed, as the readers call this before every token.
+    amsr::core::Result<std::uint64_t> result{static_cast<std::uint64_t>(position_)};
+    if (set.empty()) {
+      result.EmplaceError(
+          stream::MakeErrorCode(stream::StreamErrc::kInvalidArgument, "IndexedInputStream::FindNot: Empty set."));
+    } else {
+      std::size_t const probe_end{std::min(position_ + kLinearProbe, document_.size())};
+      while ((position_ < probe_end) && (set.find(document_[position_]) != amsr::core::StringView::npos)) {
+        ++position_;
+      }
+      if ((position_ == probe_end) && (position_ < document_.size())) {
+        SetClasses const classes{GetSetClasses(set)};
+        if (classes.complete) {
+          position_ = index_.FindClass(position_, classes.classes, false);
+        } else {
+          while ((position_ < document_.size()) && (set.find(document_[position_]) != amsr::core::StringView::npos)) {
+            ++position_;
+          }
+        }
+      }
+      result.EmplaceValue(static_cast<std::uint64_t>(position_));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Takes one character.
+   * \return The character, or EOF.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Get() noexcept -> amsr::core::Result<std::int64_t> final {
+    std::int64_t const character{CharAt(position_)};
+    if (position_ < document_.size()) {
+      ++position_;
+    }
+    return amsr::core::Result<std::int64_t>{character};
+  }
+
+  /*!
+   * \brief Makes the most recently taken character available again.
+   * \return Nothing.
+   * \error{StreamErrorDomain, StreamErrc::kInvalidPosition, if the position is at the beginning.}
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto UnGet() noexcept -> amsr::core::Result<void> final {
+    amsr::core::Result<void> result{
+        stream::MakeErrorCode(stream::StreamErrc::kInvalidPosition, "IndexedInputStream::UnGet: At beginning.")};
+    if (position_ > 0U) {
+      --position_;
+      result.EmplaceValue();
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Peeks one character.
+   * \return The character, or EOF.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Peek() noexcept -> amsr::core::Result<std::int64_t> final {
+    return amsr::core::Result<std::int64_t>{CharAt(position_)};
+  }
+
+  /*!
+   * \brief Checks if EOF is reached.
+   * \return True if all characters have been read.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto IsEof() const noexcept -> bool final { return position_ >= document_.size(); }
+
+  /*!
+   * \brief Returns always true.
+   * \return True, the document is completely in memory.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto IsOpen() const noexcept -> bool final { return true; }
+
+ private:
+  /*! \brief Number of characters tested directly by a search before the index is used. */
+  static constexpr std::size_t kLinearProbe{16U};
+
+  /*! \brief Character classes of a character set. */
+  struct SetClasses {
+    /*! \brief Union of the classes of all characters. */
+    StructuralIndex::ClassSet classes;
+    /*! \brief True if every character of the set belongs to a class. */
+    bool indexed;
+    /*! \brief True if the set consists of exactly the characters of the classes. */
+    bool complete;
+  };
+
+  /*!
+   * \brief Construct an empty stream, used by FromFile().
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  IndexedInputStream() noexcept = default;
+
+  /*!
+   * \brief Read a file completely.
+   * \param fd The file descriptor.
+   * \param buffer The buffer to append to.
+   * \return True if the end of the file has been reached without error.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto ReadAll(int fd, ara::core::Vector<char>& buffer) noexcept -> bool {
+    constexpr std::size_t kChunkSize{65536U};
+    bool done{false};
+    bool ok{true};
+    while (ok && (!done)) {
+      std::size_t const old_size{buffer.size()};
+      buffer.resize(old_size + kChunkSize);
+      ssize_t const count{::read(fd, &buffer[old_size], kChunkSize)};
+      if (count > 0) {
+        buffer.resize(old_size + static_cast<std::size_t>(count));
+      } else {
+        buffer.resize(old_size);
+        done = (count == 0);
+        ok = done || (errno == EINTR);
+      }
+    }
+    return ok;
+  }
+
+  /*!
+   * \brief Get the bit of an indexed character within the bit set of all indexed characters.
+   * \param character The character.
+   * \return The bit, 0 if the character is not indexed. Bits 0 to 3 are whitespace, bits 4 and 5 string delimiters
+   *         and bits 6 to 11 structural characters.
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto GetCharacterBit(char character) noexcept -> std::uint16_t {
+    std::uint16_t index{0U};
+    switch (character) {
+      case ' ':
+        index = 1U;
+        break;
+      case '\t':
+        index = 2U;
+        break;
+      case '\n':
+        index = 3U;
+        break;
+      case '\r':
+        index = 4U;
+        break;
+      case '"':
+        index = 5U;
+        break;
+      case '\\':
+        index = 6U;
+        break;
+      case '{':
+        index = 7U;
+        break;
+      case '}':
+        index = 8U;
+        break;
+      case '[':
+        index = 9U;
+        break;
+      case ']':
+        index = 10U;
+        break;
+      case ':':
+        index = 11U;
+        break;
+      case ',':
+        index = 12U;
+        break;
+      default:
+        // Not indexed.
+        break;
+    }
+    return (index == 0U) ? static_cast<std::uint16_t>(0U) : static_cast<std::uint16_t>(1U << (index - 1U));
+  }
+
+  /*!
+   * \brief Get the classes of a character set.
+   * \param set The character set.
+   * \return The classes.
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   *
+   * \internal
+   * - Collect the bits of all characters of the set. The readers call this for every search, so the set is only
+   *   iterated once.
+   * - A class is part of the set if one of its bits is set, and the set is complete if all bits of its classes are set.
+   * \endinternal
+   */
+  static auto GetSetClasses(amsr::core::StringView set) noexcept -> SetClasses {
+    constexpr std::uint16_t kWhitespaceBits{0x000FU};
+    constexpr std::uint16_t kStringDelimiterBits{0x0030U};
+    constexpr std::uint16_t kStructuralBits{0x0FC0U};
+    SetClasses result{0U, true, false};
+    std::uint16_t characters{0U};
+    for (char const character : set) {
+      std::uint16_t const bit{GetCharacterBit(character)};
+      result.indexed = result.indexed && (bit != 0U);
+      characters = static_cast<std::uint16_t>(characters | bit);
+    }
+    std::uint16_t class_bits{0U};
+    for (std::pair<std::uint16_t, CharClass> const& char_class :
+         {std::make_pair(kWhitespaceBits, CharClass::kWhitespace),
+          std::make_pair(kStringDelimiterBits, CharClass::kStringDelimiter),
+          std::make_pair(kStructuralBits, CharClass::kStructural)}) {
+      if ((characters & char_class.first) != 0U) {
+        class_bits = static_cast<std::uint16_t>(class_bits | char_class.first);
+        result.classes =
+            static_cast<StructuralIndex::ClassSet>(result.classes | static_cast<std::uint8_t>(char_class.second));
+      }
+    }
+    result.complete = result.indexed && (characters == class_bits);
+    return result;
+  }
+
+  /*!
+   * \brief Find the first character contained in a set.
+   * \param position The position to start from.
+   * \param set The set of characters.
+   * \return Position of the found character, or the document size.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   *
+   * \internal
+   * - Test the next kLinearProbe characters directly, most tokens of a document are shorter.
+   * - If all characters of the set are indexed, jump from one candidate of their classes to the next and check if
+   *   the candidate is in the set.
+   * - Otherwise test every character.
+   * \endinternal
+   */
+  auto FindInSet(std::size_t position, amsr::core::StringView set) const noexcept -> std::size_t {
+    std::size_t found{position};
+    std::size_t const probe_end{std::min(position + kLinearProbe, document_.size())};
+    while ((found < probe_end) && (set.find(document_[found]) == amsr::core::StringView::npos)) {
+      ++found;
+    }
+    if ((found == probe_end) && (found < document_.size())) {
+      SetClasses const classes{GetSetClasses(set)};
+      if (classes.indexed && (!set.empty())) {
+        found = index_.FindClass(found, classes.classes, true);
+        while ((!classes.complete) && (found < document_.size()) &&
+               (set.find(document_[found]) == amsr::core::StringView::npos)) {
+          found = index_.FindClass(found + 1U, classes.classes, true);
+        }
+      } else {
+        while ((found < document_.size()) && (set.find(document_[found]) == amsr::core::StringView::npos)) {
+          ++found;
+        }
+      }
+    }
+    return found;
+  }
+
+  /*!
+   * \brief Get the character at a position.
+   * \param position The position.
+   * \return The character, or EOF (-1) if the position is at the end.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto CharAt(std::size_t position) const noexcept -> std::int64_t {
+    return (position < document_.size())
+               ? static_cast<std::int64_t>(std::char_traits<char>::to_int_type(document_[position]))
+               : static_cast<std::int64_t>(std::char_traits<char>::eof());
+  }
+
+  /*!
+   * \brief Create the result of a search.
+   * \param position The position of the found character.
+   * \return The position, or kEndOfFile if nothing was found.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto FoundAt(std::size_t position) const noexcept -> amsr::core::Result<std::uint64_t> {
+    amsr::core::Result<std::uint64_t> result{static_cast<std::uint64_t>(position)};
+    if (position >= document_.size()) {
+      result.EmplaceError(stream::MakeErrorCode(stream::StreamErrc::kEndOfFile, "IndexedInputStream: Not found."));
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Consume up to count characters.
+   * \param count Maximum number of characters.
+   * \return View on the consumed characters.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto TakeView(std::uint64_t count) noexcept -> amsr::core::Span<char const> {
+    std::size_t const remaining{document_.size() - position_};
+    std::size_t const size{(count < remaining) ? static_cast<std::size_t>(count) : remaining};
+    amsr::core::Span<char const> const view{document_.subspan(position_, size)};
+    position_ += size;
+    return view;
+  }
+
+  /*!
+   * \brief Copy up to size characters.
+   * \param destination The destination.
+   * \param size Maximum number of characters.
+   * \return Number of copied characters.
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto CopyOut(void* destination, std::size_t size) noexcept -> std::size_t {
+    amsr::core::Span<char const> const view{TakeView(size)};
+    if (!view.empty()) {
+      static_cast<void>(std::memcpy(destination, view.data(), view.size()));
+    }
+    return view.size();
+  }
+
+  /*! \brief The complete document. */
+  amsr::core::Span<char const> document_{};
+
+  /*! \brief The document read from a file which could not be mapped. */
+  ara::core::Vector<char> buffer_{};
+
+  /*! \brief Start of the memory mapping of the document, nullptr if not mapped. */
+  void* mapping_{nullptr};
+
+  /*! \brief Size of the memory mapping. */
+  std::size_t mapping_size_{0U};
+
+  /*! \brief The character class index of the document. */
+  StructuralIndex index_{};
+
+  /*! \brief The current read position. */
+  std::size_t position_{0U};
+};
+
+}  // namespace internal
+}  // namespace json
+}  // namespace amsr
+
+#endif  // LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_INDEXED_INPUT_STREAM_H_
@@ -0,0 +1,502 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**       \file     structural_index.h
+ *        \brief    Character class index of a complete JSON document.
+ *
+ *        \details  Classifies every character of the document in one vectorized pass into whitespace, string
+ *                  delimiters (quote and backslash) and structural characters. AVX2 or SSE2 is selected at runtime if
+ *                  the CPU supports it, the scalar classification is used otherwise. The classes are stored as one
+ *                  bit per character, so searching for the next character of a class skips 64 characters per step.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_STRUCTURAL_INDEX_H_
+#define LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_STRUCTURAL_INDEX_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define AMSR_JSON_STRUCTURAL_INDEX_X86 1
+#endif
+
+#include "amsr/core/span.h"
+#include "amsr/core/string_view.h"
+#include "ara/core/vector.h"
+
+namespace amsr {
+namespace json {
+namespace internal {
+
+/*!
+ * \brief Character classes stored in the StructuralIndex, usable as bit set.
+ */
+enum class CharClass : std::uint8_t {
+  /*! \brief Any other character. */
+  kNone = 0U,
+  /*! \brief JSON whitespace: space, tab, line feed and carriage return. */
+  kWhitespace = 1U,
+  /*! \brief String delimiters: quotation mark and backslash. */
+  kStringDelimiter = 2U,
+  /*! \brief Structural characters: braces, brackets, colon and comma. */
+  kStructural = 4U
+};
+
+/*!
+ * \brief Implementations available for classifying the characters of a block.
+ */
+enum class StructuralIndexBackend : std::uint8_t {
+  /*! \brief One character per iteration. */
+  kScalar = 0U,
+  /*! \brief 16 characters per compare with SSE2. */
+  kSse2 = 1U,
+  /*! \brief 32 characters per compare with AVX2. */
+  kAvx2 = 2U
+};
+
+/*!
+ * \brief Index of the character classes of a JSON document.
+ *
+ * \details The index does not resolve whether a character is inside a string: The readers consume the document through
+ *          the character based stream interface, which has the same semantics inside and outside of strings.
+ */
+class StructuralIndex final {
+ public:
+  /*! \brief Number of characters covered by one index block. */
+  static constexpr std::size_t kBlockSize{64U};
+
+  /*! \brief Number of distinct character classes. */
+  static constexpr std::size_t kNumberOfClasses{3U};
+
+  /*! \brief Bit set of character classes. */
+  using ClassSet = std::uint8_t;
+
+  /*!
+   * \brief Get the class of a character.
+   * \param character The character.
+   * \return The class.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  static auto Classify(char character) noexcept -> CharClass {
+    CharClass result{CharClass::kNone};
+    switch (character) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        result = CharClass::kWhitespace;
+        break;
+      case '"':
+      case '\\':
+        result = CharClass::kStringDelimiter;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        result = CharClass::kStructural;
+        break;
+      default:
+        // Not indexed.
+        break;
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Get all characters of a class.
+   * \param char_class The class.
+   * \return The characters.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  static auto GetCharacters(CharClass char_class) noexcept -> amsr::core::StringView {
+    amsr::core::StringView result{};
+    switch (char_class) {
+      case CharClass::kWhitespace:
+        result = amsr::core::StringView{" \t\n\r"};
+        break;
+      case CharClass::kStringDelimiter:
+        result = amsr::core::StringView{"\"\\"};
+        break;
+      case CharClass::kStructural:
+        result = amsr::core::StringView{"{}[]:,"};
+        break;
+      default:
+        // No characters.
+        break;
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Check if the CPU supports a backend.
+   * \param backend The backend.
+   * \return True if the backend can be used on this CPU.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  static auto IsBackendSupported(StructuralIndexBackend backend) noexcept -> bool {
+    bool result{backend == StructuralIndexBackend::kScalar};
+#ifdef AMSR_JSON_STRUCTURAL_INDEX_X86
+    __builtin_cpu_init();
+    if (backend == StructuralIndexBackend::kAvx2) {
+      result = __builtin_cpu_supports("avx2") != 0;
+    } else if (backend == StructuralIndexBackend::kSse2) {
+      result = __builtin_cpu_supports("sse2") != 0;
+    } else {
+      // Scalar is always supported.
+    }
+#endif
+    return result;
+  }
+
+  /*!
+   * \brief Get the backend used by Build().
+   * \return The fastest backend supported by the CPU.
+   *
+   * \details The CPU features are queried on the first call only.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  static auto GetBackend() noexcept -> StructuralIndexBackend {
+    static StructuralIndexBackend const backend{
+        IsBackendSupported(StructuralIndexBackend::kAvx2)
+            ? StructuralIndexBackend::kAvx2
+            : (IsBackendSupported(StructuralIndexBackend::kSse2) ? StructuralIndexBackend::kSse2
+                                                                 : StructuralIndexBackend::kScalar)};
+    return backend;
+  }
+
+  /*!
+   * \brief Build the index of a document with the backend returned by GetBackend().
+   * \param document The document. Only its size is stored, the data is not referenced after the call.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  void Build(amsr::core::Span<char const> document) noexcept { Build(document, GetBackend()); }
+
+  /*!
+   * \brief Build the index of a document with the given backend.
+   * \param document The document. Only its size is stored, the data is not referenced after the call.
+   * \param backend  The backend.
+   *
+   * \context ANY
+   * \pre IsBackendSupported(backend) returns true.
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   *
+   * \internal
+   * - Select the block classification of the backend once.
+   * - Classify all complete blocks directly from the document.
+   * - Copy the trailing partial block into a zero padded buffer and classify it, so no load crosses the document end.
+   * \endinternal
+   */
+  void Build(amsr::core::Span<char const> document, StructuralIndexBackend backend) noexcept {
+    ClassifyBlockFunction classify_block{&ClassifyBlockScalar};
+#ifdef AMSR_JSON_STRUCTURAL_INDEX_X86
+    if (backend == StructuralIndexBackend::kAvx2) {
+      classify_block = &ClassifyBlockAvx2;
+    } else if (backend == StructuralIndexBackend::kSse2) {
+      classify_block = &ClassifyBlockSse2;
+    } else {
+      // Scalar classification.
+    }
+#else
+    static_cast<void>(backend);
+#endif
+    size_ = document.size();
+    std::size_t const number_of_blocks{(size_ + kBlockSize - 1U) / kBlockSize};
+    blocks_.clear();
+    blocks_.resize(number_of_blocks);
+    std::size_t const full_blocks{size_ / kBlockSize};
+    for (std::size_t block{0U}; block < full_blocks; ++block) {
+      classify_block(&document[block * kBlockSize], blocks_[block]);
+    }
+    if (full_blocks < number_of_blocks) {
+      std::array<char, kBlockSize> padded{};
+      std::size_t const remaining{size_ - (full_blocks * kBlockSize)};
+      static_cast<void>(std::memcpy(padded.data(), &document[full_blocks * kBlockSize], remaining));
+      classify_block(padded.data(), blocks_[full_blocks]);
+    }
+  }
+
+  /*!
+   * \brief Get the number of blocks of the index.
+   * \return The number of blocks.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  auto GetNumberOfBlocks() const noexcept -> std::size_t { return blocks_.size(); }
+
+  /*!
+   * \brief Find the first character at or after a position whose class is (or is not) contained in a set.
+   * \param position The position to start from.
+   * \param classes  The set of classes, a combination of CharClass values.
+   * \param in_set   True to find a character of the given classes, false to find a character of any other class.
+   * \return Position of the found character, or the document size if there is none.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  auto FindClass(std::size_t position, ClassSet classes, bool in_set) const noexcept -> std::size_t {
+    std::size_t result{size_};
+    std::size_t block{position / kBlockSize};
+    std::uint64_t mask{0U};
+    if (position < size_) {
+      mask = in_set ? GetMask(block, classes) : ~GetMask(block, classes);
+      mask &= ~std::uint64_t{0U} << (position % kBlockSize);
+    } else {
+      block = blocks_.size();
+    }
+    while (block < blocks_.size()) {
+      if (mask != 0U) {
+        result = (block * kBlockSize) + CountTrailingZeros(mask);
+        break;
+      }
+      ++block;
+      if (block < blocks_.size()) {
+        mask = in_set ? GetMask(block, classes) : ~GetMask(block, classes);
+      }
+    }
+    return (result < size_) ? result : size_;
+  }
+
+  /*!
+   * \brief Get the bits of the given classes of one block.
+   * \param block   The block.
+   * \param classes The set of classes.
+   * \return One bit per character of the block, set if the character belongs to one of the classes.
+   *
+   * \context ANY
+   * \pre block is smaller than the number of blocks.
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   * \vprivate
+   */
+  auto GetMask(std::size_t block, ClassSet classes) const noexcept -> std::uint64_t {
+    BlockMasks const& masks{blocks_[block]};
+    std::uint64_t mask{0U};
+    for (std::size_t index{0U}; index < kNumberOfClasses; ++index) {
+      if ((classes & (1U << index)) != 0U) {
+        mask |= masks[index];
+      }
+    }
+    return mask;
+  }
+
+ private:
+  /*! \brief Bits of the character classes of one block, indexed by the bit number of the CharClass. */
+  using BlockMasks = std::array<std::uint64_t, kNumberOfClasses>;
+
+  /*! \brief Classification of one block of kBlockSize characters. */
+  using ClassifyBlockFunction = void (*)(char const*, BlockMasks&);
+
+  /*!
+   * \brief Count the trailing zero bits.
+   * \param value The value, must not be zero.
+   * \return The number of trailing zero bits.
+   *
+   * \context ANY
+   * \pre value != 0
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto CountTrailingZeros(std::uint64_t value) noexcept -> std::size_t {
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+    std::size_t count{0U};
+    while ((value & 1U) == 0U) {
+      value >>= 1U;
+      ++count;
+    }
+    return count;
+#endif
+  }
+
+  /*!
+   * \brief Classify one block of characters one by one.
+   * \param data  Start of the block, kBlockSize characters must be readable.
+   * \param masks The bits of the block.
+   *
+   * \context ANY
+   * \pre -
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static void ClassifyBlockScalar(char const* data, BlockMasks& masks) noexcept {
+    masks = BlockMasks{};
+    for (std::size_t index{0U}; index < kBlockSize; ++index) {
+      std::uint8_t const char_class{static_cast<std::uint8_t>(Classify(data[index]))};
+      for (std::size_t class_index{0U}; class_index < kNumberOfClasses; ++class_index) {
+        masks[class_index] |= static_cast<std::uint64_t>((char_class >> class_index) & 1U) << index;
+      }
+    }
+  }
+
+#ifdef AMSR_JSON_STRUCTURAL_INDEX_X86
+  /*!
+   * \brief Classify one block of characters using SSE2.
+   * \param data  Start of the block, kBlockSize characters must be readable.
+   * \param masks The bits of the block.
+   *
+   * \context ANY
+   * \pre The CPU supports SSE2.
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  __attribute__((target("sse2"))) static void ClassifyBlockSse2(char const* data, BlockMasks& masks) noexcept {
+    masks = BlockMasks{};
+    for (std::size_t lane{0U}; lane < (kBlockSize / sizeof(__m128i)); ++lane) {
+      __m128i const v{_mm_loadu_si128(reinterpret_cast<__m128i const*>(&data[lane * sizeof(__m128i)]))};
+      __m128i const whitespace{
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))))};
+      __m128i const delimiter{
+          _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')))};
+      // '{' | 0x20 == '{', '[' | 0x20 == '{', '}' | 0x20 == '}', ']' | 0x20 == '}'.
+      __m128i const folded{_mm_or_si128(v, _mm_set1_epi8(0x20))};
+      __m128i const structural{
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                    _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))))};
+      std::size_t const shift{lane * sizeof(__m128i)};
+      masks[0U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(whitespace))) << shift;
+      masks[1U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(delimiter))) << shift;
+      masks[2U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(structural))) << shift;
+    }
+  }
+
+  /*!
+   * \brief Classify one block of characters using AVX2.
+   * \param data  Start of the block, kBlockSize characters must be readable.
+   * \param masks The bits of the block.
+   *
+   * \context ANY
+   * \pre The CPU supports AVX2.
+   * \threadsafe TRUE
+   * \reentrant TRUE
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  __attribute__((target("avx2"))) static void ClassifyBlockAvx2(char const* data, BlockMasks& masks) noexcept {
+    masks = BlockMasks{};
+    for (std::size_t lane{0U}; lane < (kBlockSize / sizeof(__m256i)); ++lane) {
+      __m256i const v{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(&data[lane * sizeof(__m256i)]))};
+      __m256i const whitespace{_mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))))};
+      __m256i const delimiter{
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')))};
+      // '{' | 0x20 == '{', '[' | 0x20 == '{', '}' | 0x20 == '}', ']' | 0x20 == '}'.
+      __m256i const folded{_mm256_or_si256(v, _mm256_set1_epi8(0x20))};
+      __m256i const structural{_mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+                          _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))))};
+      std::size_t const shift{lane * sizeof(__m256i)};
+      masks[0U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(whitespace))) << shift;
+      masks[1U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(delimiter))) << shift;
+      masks[2U] |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(structural))) << shift;
+    }
+  }
+#endif
+
+  /*! \brief The class bits of all blocks. */
+  ara::core::Vector<BlockMasks> blocks_{};
+
+  /*! \brief Size of the indexed document. */
+  std::size_t size_{0U};
+};
+
+}  // namespace internal
+}  // namespace json
+}  // namespace amsr
+
+#endif  // LIB_VAJSON_INCLUDE_AMSR_JSON_READER_INTERNAL_STRUCTURAL_INDEX_H_
@@ -43,6 +43,8 @@ static constexpr sync::Strategy kFileSyncStrategy{sync::Strategy::kDefault};
 
 /*!
  * \brief The sync strategy used for remote logging.
+ * \details The remote sink queue is part of the prebuilt logging library layout and stays at sync::Strategy::kDefault.
+ *          Queues that are created with mpsc::MakeMPSC() outside of the library may select sync::Strategy::kLockFree.
  */
 static constexpr sync::Strategy kRemoteSyncStrategy{sync::Strategy::kDefault};
 
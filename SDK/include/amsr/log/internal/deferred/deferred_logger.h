@@ -0,0 +1,404 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**     \file       deferred_logger.h
+ *      \brief      Logging front-end that defers formatting to the consumer of the records.
+ *      \details    The logging thread only checks the log level and copies the raw arguments into its record buffer.
+ *                  Formatting happens when the records are drained, either by replaying them into the regular
+ *                  LogStream or by serializing them as DLT verbose payload.
+ *
+ *      \unit       LogAndTrace::Logging::DeferredLogger
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_DEFERRED_LOGGER_H_
+#define LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_DEFERRED_LOGGER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "amsr/core/span.h"
+#include "amsr/core/string_view.h"
+#include "amsr/log/internal/deferred/record.h"
+#include "amsr/log/internal/deferred/record_buffer.h"
+#include "amsr/log/internal/time.h"
+#include "amsr/log/internal/types.h"
+#include "amsr/log/internal/verbose/serialize_verbose.h"
+#include "amsr/log/logger.h"
+#include "amsr/log/logstream.h"
+#include "amsr/timer/timer.h"
+#include "amsr/timer/timer_manager.h"
+
+namespace amsr {
+namespace log {
+namespace internal {
+namespace deferred {
+
+/*!
+ * \brief Selects whether the time of the log call is stored in the record.
+ * \details The call time is captured by default. Reading the clock dominates the cost of a deferred log call, so
+ *          callers that only need the time of formatting may opt out.
+ */
+enum class CallTime : std::uint8_t {
+  kNotCaptured = 0,
+  kCaptured = 1,
+};
+
+/*!
+ * \brief Logging front-end that stores binary records instead of formatted messages.
+ *
+ * \details Usage:
+ *          \code
+ *          static constexpr LogSite kSite{LogLevel::kInfo, __FILE__, __LINE__};
+ *          deferred_logger.Log(kSite, "Received", count, "bytes");
+ *          \endcode
+ *          Supported arguments are bool, char, all fixed width integers, float, double, string literals, char const*
+ *          and core::StringView. Strings are copied into the record, so they need not outlive the call.
+ */
+class DeferredLogger final {
+  /*! \brief The logger the records are formatted with. */
+  Logger* logger_;
+  /*! \brief Whether the time of the log call is stored in the record. */
+  CallTime call_time_;
+
+ public:
+  /*!
+   * \brief Constructor
+   * \details Registers the logger with the record buffer registry, so its records are formatted while this front-end
+   *          exists.
+   * \param logger    The logger to log to. Must outlive this front-end.
+   * \param call_time Whether the time of the log call is stored in the record.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit DeferredLogger(Logger& logger, CallTime call_time = CallTime::kCaptured) noexcept
+      : logger_{&logger}, call_time_{call_time} {
+    RecordBufferRegistry::Instance().AddLogger(logger);
+  }
+
+  /*! \brief Disallow move construction. */
+  DeferredLogger(DeferredLogger&&) = delete;
+  /*! \brief Disallow copy construction. */
+  DeferredLogger(DeferredLogger const&) = delete;
+  /*! \brief Disallow move assignment. */
+  auto operator=(DeferredLogger&&) -> DeferredLogger& = delete;
+  /*! \brief Disallow copy assignment. */
+  auto operator=(DeferredLogger const&) -> DeferredLogger& = delete;
+
+  /*!
+   * \brief Destructor
+   * \details Formats the pending records of all threads and removes the logger from the record buffer registry.
+   *          Records that are logged through this front-end afterwards are discarded, so no record refers to the
+   *          logger once it is destroyed.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ~DeferredLogger() noexcept;
+
+  /*!
+   * \brief Stores a log record in the record buffer of the calling thread.
+   *
+   * \tparam Args The types of the arguments.
+   * \param site  The call site. Must have static storage duration.
+   * \param args  The arguments of the log message.
+   *
+   * \details The record is dropped if the record buffer of the calling thread is full.
+   *
+   * \internal
+   *   - #10 Return early if the log level is not enabled for this logger.
+   *   - #20 Reserve space for the record in the buffer of this thread.
+   *   - #30 Take the time stamp if the call time is captured.
+   *   - #40 Write the header and the raw arguments and publish the record.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   * \threadsafe  TRUE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \context     ANY
+   */
+  template <typename... Args>
+  void Log(LogSite const& site, Args const&... args) noexcept {
+    if (this->logger_->IsLevelRelevant(site.level)) {
+      std::size_t const size{RecordSize(args...)};
+      ThreadRecordBuffer& buffer{GetThreadRecordBuffer()};
+      std::uint8_t* const dst{buffer.Reserve(size)};
+      if (dst != nullptr) {
+        DltTime const time_stamp{(this->call_time_ == CallTime::kCaptured) ? GetDltTimeStamp() : DltTime{0}};
+        RecordHeader const header{static_cast<std::uint32_t>(size), static_cast<std::uint32_t>(sizeof...(Args)),
+                                  &site, this->logger_, time_stamp};
+        WriteRecord(dst, header, args...);
+        buffer.Commit(size);
+      }
+    }
+  }
+};
+
+namespace detail {
+/*!
+ * \brief Visitor that streams the arguments of a record into a LogStream.
+ */
+class ReplayVisitor final {
+  /*! \brief The stream to write into. */
+  LogStream* stream_;
+
+ public:
+  /*!
+   * \brief Constructor
+   * \param stream The stream to write into.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit ReplayVisitor(LogStream& stream) noexcept : stream_{&stream} {}
+
+  /*!
+   * \brief Streams one argument.
+   * \tparam T    The type of the argument.
+   * \param value The argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T>
+  void operator()(T value) noexcept {
+    // VCA_LOGAPI_CHECKED_CONTRACT
+    static_cast<void>(*this->stream_ << value);
+  }
+};
+
+/*!
+ * \brief Visitor that serializes the arguments of a record as DLT verbose arguments.
+ */
+class VerboseVisitor final {
+  /*! \brief The remaining buffer or the first error. */
+  SerResult result_;
+
+ public:
+  /*!
+   * \brief Constructor
+   * \param buffer The buffer to serialize into.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit VerboseVisitor(ByteView buffer) noexcept : result_{buffer} {}
+
+  /*!
+   * \brief Serializes a boolean.
+   * \param value The argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void operator()(bool value) noexcept {
+    if (this->result_.HasValue()) {
+      this->result_ = verbose::SerializeBool(this->result_.Value(), value);
+    }
+  }
+
+  /*!
+   * \brief Serializes a character as string of length one.
+   * \param value The argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void operator()(char value) noexcept {
+    char const characters[]{value, '\0'};
+    (*this)(core::StringView{&characters[0], 1});
+  }
+
+  /*!
+   * \brief Serializes a string.
+   * \param value The argument. Must be followed by a null terminator.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void operator()(core::StringView value) noexcept {
+    if (this->result_.HasValue()) {
+      this->result_ = verbose::Serialize(this->result_.Value(), verbose::DltString{value});
+    }
+  }
+
+  /*!
+   * \brief Serializes a number.
+   * \tparam T    The type of the argument.
+   * \param value The argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T>
+  void operator()(T value) noexcept {
+    if (this->result_.HasValue()) {
+      this->result_ = verbose::SerializeNumber(this->result_.Value(), value);
+    }
+  }
+
+  /*!
+   * \brief Get the serialization result.
+   * \return The remaining buffer or the first error.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto GetResult() const noexcept -> SerResult const& { return this->result_; }
+};
+}  // namespace detail
+
+/*!
+ * \brief Formats one record through the LogStream of its logger.
+ *
+ * \param record The record including its header.
+ * \return       True if the record was valid.
+ *
+ * \details All sinks of the logger receive the message. The LogStream stamps the message with the time of
+ *          formatting, the time of the log call stays available in the record header.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline auto ReplayRecord(core::Span<std::uint8_t const> record) noexcept -> bool {
+  Optional<RecordHeader> const header{ReadHeader(record)};
+  bool valid{header.has_value()};
+  if (valid) {
+    LogSite const& site{*header->site};
+    LogStream stream{header->logger->WithLevel(site.level)};
+    if (site.file != nullptr) {
+      static_cast<void>(stream.WithLocation(core::StringView{site.file}, site.line));
+    }
+    valid = VisitArgs(record, detail::ReplayVisitor{stream});
+  }
+  return valid;
+}
+
+/*!
+ * \brief Serializes the arguments of one record as DLT verbose payload.
+ *
+ * \param buffer The buffer to serialize into.
+ * \param record The record including its header.
+ * \return       The remaining buffer, or an error if the buffer is too small or the record is invalid.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline auto SerializeVerbose(ByteView buffer, core::Span<std::uint8_t const> record) noexcept -> SerResult {
+  detail::VerboseVisitor visitor{buffer};
+  SerResult result{Err(LogErrc::kRuntimeError, "Invalid deferred log record.")};
+  if (VisitArgs(record, visitor)) {
+    result = visitor.GetResult();
+  }
+  return result;
+}
+
+/*!
+ * \brief Formats all pending records of all threads.
+ *
+ * \return The number of formatted records.
+ *
+ * \details Must be called periodically by one thread, e.g. the thread that drives the sinks. DeferredLogDrainer does
+ *          this on the thread of a timer manager.
+ * \spec
+ *   requires true;
+ * \endspec
+ * \threadsafe  TRUE
+ * \reentrant   FALSE
+ * \synchronous TRUE
+ * \context     ANY
+ */
+inline auto DrainDeferredLogs() noexcept -> std::size_t {
+  return RecordBufferRegistry::Instance().ConsumeAll(
+      [](core::Span<std::uint8_t const> record) { static_cast<void>(ReplayRecord(record)); });
+}
+
+/*!
+ * \internal
+ *   - #10 Format the pending records, including the records of this front-end.
+ *   - #20 Remove the logger from the registry.
+ * \endinternal
+ */
+inline DeferredLogger::~DeferredLogger() noexcept {
+  static_cast<void>(DrainDeferredLogs());
+  RecordBufferRegistry::Instance().RemoveLogger(*this->logger_);
+}
+
+/*! \brief The default period of DeferredLogDrainer. */
+constexpr std::chrono::milliseconds kDefaultDrainPeriod{10};
+
+/*!
+ * \brief Periodically formats the pending deferred log records on the thread of a timer manager.
+ *
+ * \details Create the drainer with the timer manager of the reactor that drives the log sinks, so records are
+ *          formatted on the sink thread and not by the logging threads.
+ */
+class DeferredLogDrainer final : public ::amsr::timer::Timer {
+ public:
+  /*!
+   * \brief Constructor, starts the periodic drain.
+   * \param timer_manager The timer manager of the sink thread. Must outlive the drainer.
+   * \param period        The drain period.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit DeferredLogDrainer(::amsr::timer::TimerManager* timer_manager,
+                              ::amsr::timer::Timer::Clock::duration period = kDefaultDrainPeriod) noexcept
+      : ::amsr::timer::Timer{timer_manager} {
+    this->SetPeriod(period);
+    this->Start();
+  }
+
+  /*! \brief Disallow move construction. */
+  DeferredLogDrainer(DeferredLogDrainer&&) = delete;
+  /*! \brief Disallow copy construction. */
+  DeferredLogDrainer(DeferredLogDrainer const&) = delete;
+  /*! \brief Disallow move assignment. */
+  auto operator=(DeferredLogDrainer&&) -> DeferredLogDrainer& = delete;
+  /*! \brief Disallow copy assignment. */
+  auto operator=(DeferredLogDrainer const&) -> DeferredLogDrainer& = delete;
+
+  /*!
+   * \brief Destructor, stops the periodic drain.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ~DeferredLogDrainer() noexcept final { this->Stop(); }
+
+  /*!
+   * \brief Formats all pending records.
+   * \return True, so the timer stays scheduled.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto HandleTimer() noexcept -> bool final {
+    static_cast<void>(DrainDeferredLogs());
+    return true;
+  }
+};
+
+}  // namespace deferred
+}  // namespace internal
+}  // namespace log
+}  // namespace amsr
+
+#endif  // LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_DEFERRED_LOGGER_H_
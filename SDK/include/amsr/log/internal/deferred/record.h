@@ -0,0 +1,485 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**     \file       record.h
+ *      \brief      Binary record format of deferred log messages.
+ *      \details    A record is a fixed header followed by the arguments of the log call. Every argument is stored as a
+ *                  one byte tag followed by its raw value in native endianness. Strings are stored as a 16 bit length
+ *                  followed by the characters and a null terminator. Records are padded to a multiple of 8 bytes.
+ *
+ *      \unit       LogAndTrace::Logging::DeferredRecord
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_H_
+#define LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "amsr/core/span.h"
+#include "amsr/core/string_view.h"
+#include "amsr/log/internal/time.h"
+#include "amsr/log/internal/utils.h"
+#include "amsr/log/log_level.h"
+#include "amsr/log_fwd.h"
+
+namespace amsr {
+namespace log {
+namespace internal {
+namespace deferred {
+
+/*!
+ * \brief Static description of a deferred log call site.
+ *
+ * \details Must have static storage duration, as records only store its address.
+ */
+struct LogSite {
+  /*! \brief The log level of the call site. */
+  LogLevel level;
+  /*! \brief The source file of the call site or nullptr. */
+  char const* file;
+  /*! \brief The source line of the call site. */
+  std::int32_t line;
+};
+
+/*! \brief The type tag of a recorded argument. */
+enum class ArgTag : std::uint8_t {
+  kBool = 1,
+  kChar = 2,
+  kUInt8 = 3,
+  kUInt16 = 4,
+  kUInt32 = 5,
+  kUInt64 = 6,
+  kSInt8 = 7,
+  kSInt16 = 8,
+  kSInt32 = 9,
+  kSInt64 = 10,
+  kFloat32 = 11,
+  kFloat64 = 12,
+  kString = 13,
+};
+
+/*! \brief The alignment of records. */
+constexpr std::size_t kRecordAlignment{8};
+
+/*! \brief The argument count that marks padding at the end of a record buffer. */
+constexpr std::uint32_t kPaddingRecord{std::numeric_limits<std::uint32_t>::max()};
+
+/*!
+ * \brief The header of a record.
+ */
+struct RecordHeader {
+  /*! \brief The size of the whole record including header and padding. */
+  std::uint32_t size;
+  /*! \brief The number of arguments or kPaddingRecord. */
+  std::uint32_t arg_count;
+  /*! \brief The call site. */
+  LogSite const* site;
+  /*! \brief The logger the record is logged to. */
+  Logger* logger;
+  /*! \brief The time of the log call, 0 if the call time was not captured. */
+  DltTime time_stamp;
+};
+
+/*! \brief The size of the prefix that every record and every padding has. */
+constexpr std::size_t kRecordPrefixSize{sizeof(std::uint32_t) + sizeof(std::uint32_t)};
+
+namespace detail {
+/*!
+ * \brief Maps an arithmetic type onto its argument tag.
+ *
+ * \tparam T The type of the argument.
+ * \return   The tag.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename T>
+constexpr auto NumberTag() noexcept -> ArgTag {
+  return std::is_same<T, bool>::value    ? ArgTag::kBool
+         : std::is_same<T, char>::value  ? ArgTag::kChar
+         : std::is_floating_point<T>::value ? ((sizeof(T) == sizeof(float)) ? ArgTag::kFloat32 : ArgTag::kFloat64)
+         : std::is_signed<T>::value
+             ? ((sizeof(T) == 1) ? ArgTag::kSInt8
+                : (sizeof(T) == 2) ? ArgTag::kSInt16
+                : (sizeof(T) == 4) ? ArgTag::kSInt32
+                                   : ArgTag::kSInt64)
+             : ((sizeof(T) == 1) ? ArgTag::kUInt8
+                : (sizeof(T) == 2) ? ArgTag::kUInt16
+                : (sizeof(T) == 4) ? ArgTag::kUInt32
+                                   : ArgTag::kUInt64);
+}
+}  // namespace detail
+
+/*!
+ * \brief Encoding of one argument type.
+ *
+ * \tparam T The type of the argument.
+ *           Supported are arithmetic types, core::StringView and C strings.
+ */
+template <typename T, typename = void>
+struct ArgCodec;
+
+/*!
+ * \brief Encoding of arithmetic arguments.
+ *
+ * \tparam T The type of the argument.
+ */
+template <typename T>
+struct ArgCodec<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+  static_assert(sizeof(T) <= sizeof(std::uint64_t), "Arithmetic types wider than 64 bit are not supported.");
+
+  /*!
+   * \brief Returns the encoded size of the argument.
+   * \return The size in bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static constexpr auto Size(T) noexcept -> std::size_t { return sizeof(ArgTag) + sizeof(T); }
+
+  /*!
+   * \brief Writes the argument.
+   *
+   * \param dst   The destination. Must have Size(value) bytes.
+   * \param value The value to write.
+   * \return      The byte following the written argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Write(std::uint8_t* dst, T value) noexcept -> std::uint8_t* {
+    dst[0] = static_cast<std::uint8_t>(detail::NumberTag<T>());
+    static_cast<void>(std::memcpy(&dst[1], &value, sizeof(T)));
+    return &dst[sizeof(ArgTag) + sizeof(T)];
+  }
+};
+
+/*!
+ * \brief Encoding of string view arguments.
+ */
+template <>
+struct ArgCodec<core::StringView> {
+  /*!
+   * \brief Returns the encoded size of the argument.
+   * \param value The value to write.
+   * \return      The size in bytes. Strings are truncated to 65534 characters.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Size(core::StringView value) noexcept -> std::size_t {
+    return sizeof(ArgTag) + sizeof(std::uint16_t) + Length(value) + sizeof(char);
+  }
+
+  /*!
+   * \brief Writes the argument.
+   *
+   * \param dst   The destination. Must have Size(value) bytes.
+   * \param value The value to write.
+   * \return      The byte following the written argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Write(std::uint8_t* dst, core::StringView value) noexcept -> std::uint8_t* {
+    std::uint16_t const length{Length(value)};
+    dst[0] = static_cast<std::uint8_t>(ArgTag::kString);
+    static_cast<void>(std::memcpy(&dst[1], &length, sizeof(length)));
+    static_cast<void>(std::memcpy(&dst[sizeof(ArgTag) + sizeof(length)], value.data(), length));
+    dst[sizeof(ArgTag) + sizeof(length) + length] = 0;
+    return &dst[sizeof(ArgTag) + sizeof(length) + length + sizeof(char)];
+  }
+
+ private:
+  /*!
+   * \brief Returns the stored length of a string.
+   * \param value The string.
+   * \return      The length, limited to 65534 so that the DLT length including the terminator fits.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Length(core::StringView value) noexcept -> std::uint16_t {
+    return static_cast<std::uint16_t>(
+        std::min(value.size(), static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max() - 1)));
+  }
+};
+
+/*!
+ * \brief Encoding of C string arguments.
+ */
+template <>
+struct ArgCodec<char const*> {
+  /*!
+   * \brief Returns the encoded size of the argument.
+   * \param value The null terminated string or nullptr.
+   * \return      The size in bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Size(char const* value) noexcept -> std::size_t { return ArgCodec<core::StringView>::Size(View(value)); }
+
+  /*!
+   * \brief Writes the argument.
+   *
+   * \param dst   The destination. Must have Size(value) bytes.
+   * \param value The null terminated string or nullptr.
+   * \return      The byte following the written argument.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Write(std::uint8_t* dst, char const* value) noexcept -> std::uint8_t* {
+    return ArgCodec<core::StringView>::Write(dst, View(value));
+  }
+
+ private:
+  /*!
+   * \brief Creates a view on a C string.
+   * \param value The null terminated string or nullptr.
+   * \return      The view, empty for nullptr.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto View(char const* value) noexcept -> core::StringView {
+    return (value == nullptr) ? core::StringView{} : core::StringView{value, std::strlen(value)};
+  }
+};
+
+/*!
+ * \brief The argument type used for encoding a value of type T.
+ * \tparam T The type of the argument. Arrays of char decay to C strings.
+ */
+template <typename T>
+using ArgType = std::conditional_t<std::is_convertible<T const&, char const*>::value, char const*, T>;
+
+/*!
+ * \brief Calculates the size of a record.
+ *
+ * \tparam Args The types of the arguments.
+ * \param args  The arguments.
+ * \return      The record size including header and padding.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename... Args>
+auto RecordSize(Args const&... args) noexcept -> std::size_t {
+  std::size_t size{sizeof(RecordHeader)};
+  // VECTOR NL AutosarC++17_10-A18.1.1: MD_VAC_A18.1.1_cStyleArraysShouldNotBeUsed
+  std::size_t const sizes[]{std::size_t{0}, ArgCodec<ArgType<Args>>::Size(args)...};
+  for (std::size_t const arg_size : sizes) {
+    size += arg_size;
+  }
+  return (size + (kRecordAlignment - 1)) & ~(kRecordAlignment - 1);
+}
+
+/*!
+ * \brief Writes a record.
+ *
+ * \tparam Args  The types of the arguments.
+ * \param dst    The destination. Must have RecordSize(args...) bytes and be aligned to kRecordAlignment.
+ * \param header The header of the record.
+ * \param args   The arguments.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename... Args>
+void WriteRecord(std::uint8_t* dst, RecordHeader const& header, Args const&... args) noexcept {
+  static_cast<void>(std::memcpy(dst, &header, sizeof(RecordHeader)));
+  std::uint8_t* cursor{&dst[sizeof(RecordHeader)]};
+  // VECTOR NL AutosarC++17_10-A18.1.1: MD_VAC_A18.1.1_cStyleArraysShouldNotBeUsed
+  bool const unused[]{true, ((cursor = ArgCodec<ArgType<Args>>::Write(cursor, args)), true)...};
+  static_cast<void>(unused);
+}
+
+namespace detail {
+/*!
+ * \brief Returns the size of a fixed size argument value.
+ *
+ * \param tag The argument tag.
+ * \return    The value size in bytes, 0 for strings and unknown tags.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+constexpr auto FixedValueSize(ArgTag tag) noexcept -> std::size_t {
+  return ((tag == ArgTag::kBool) || (tag == ArgTag::kChar) || (tag == ArgTag::kUInt8) || (tag == ArgTag::kSInt8)) ? 1
+         : ((tag == ArgTag::kUInt16) || (tag == ArgTag::kSInt16))                                                  ? 2
+         : ((tag == ArgTag::kUInt32) || (tag == ArgTag::kSInt32) || (tag == ArgTag::kFloat32))                     ? 4
+         : ((tag == ArgTag::kUInt64) || (tag == ArgTag::kSInt64) || (tag == ArgTag::kFloat64))                     ? 8
+                                                                                                                   : 0;
+}
+
+/*!
+ * \brief Reads a value of type T.
+ *
+ * \tparam T  The type of the value.
+ * \param src The source. Must have sizeof(T) bytes.
+ * \return    The value.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename T>
+auto ReadValue(std::uint8_t const* src) noexcept -> T {
+  T value{};
+  static_cast<void>(std::memcpy(&value, src, sizeof(T)));
+  return value;
+}
+
+/*!
+ * \brief Calls a visitor with one fixed size argument value.
+ *
+ * \tparam Visitor The visitor type.
+ * \param tag      The argument tag.
+ * \param src      The value. Must have FixedValueSize(tag) bytes.
+ * \param visitor  The visitor.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename Visitor>
+void VisitFixed(ArgTag tag, std::uint8_t const* src, Visitor& visitor) noexcept {
+  switch (tag) {
+    case ArgTag::kBool:
+      visitor(ReadValue<bool>(src));
+      break;
+    case ArgTag::kChar:
+      visitor(ReadValue<char>(src));
+      break;
+    case ArgTag::kUInt8:
+      visitor(ReadValue<std::uint8_t>(src));
+      break;
+    case ArgTag::kUInt16:
+      visitor(ReadValue<std::uint16_t>(src));
+      break;
+    case ArgTag::kUInt32:
+      visitor(ReadValue<std::uint32_t>(src));
+      break;
+    case ArgTag::kUInt64:
+      visitor(ReadValue<std::uint64_t>(src));
+      break;
+    case ArgTag::kSInt8:
+      visitor(ReadValue<std::int8_t>(src));
+      break;
+    case ArgTag::kSInt16:
+      visitor(ReadValue<std::int16_t>(src));
+      break;
+    case ArgTag::kSInt32:
+      visitor(ReadValue<std::int32_t>(src));
+      break;
+    case ArgTag::kSInt64:
+      visitor(ReadValue<std::int64_t>(src));
+      break;
+    case ArgTag::kFloat32:
+      visitor(ReadValue<float>(src));
+      break;
+    default:
+      visitor(ReadValue<double>(src));
+      break;
+  }
+}
+}  // namespace detail
+
+/*!
+ * \brief Reads the header of a record.
+ *
+ * \param record The record including its header.
+ * \return       The header, or nothing if the record is too short.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline auto ReadHeader(core::Span<std::uint8_t const> record) noexcept -> Optional<RecordHeader> {
+  Optional<RecordHeader> result{};
+  if (record.size() >= sizeof(RecordHeader)) {
+    RecordHeader header{};
+    static_cast<void>(std::memcpy(&header, record.data(), sizeof(RecordHeader)));
+    if ((header.size >= sizeof(RecordHeader)) && (header.size <= record.size())) {
+      result.emplace(header);
+    }
+  }
+  return result;
+}
+
+/*!
+ * \brief Calls a visitor with every argument of a record.
+ *
+ * \tparam Visitor A generic callable that accepts bool, char, all fixed width integers, float, double and
+ *                 core::StringView.
+ * \param record   The record including its header.
+ * \param visitor  The visitor.
+ * \return         True if the record could be decoded completely.
+ *
+ * \internal
+ *   - #10 Read the header.
+ *   - #20 For every argument read the tag and check that the value lies within the record.
+ *    - #30 Pass the value to the visitor.
+ * \endinternal
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename Visitor>
+auto VisitArgs(core::Span<std::uint8_t const> record, Visitor&& visitor) noexcept -> bool {
+  Optional<RecordHeader> const header{ReadHeader(record)};
+  bool valid{header.has_value()};
+  std::size_t offset{sizeof(RecordHeader)};
+  for (std::uint32_t i{0}; valid && (i < header->arg_count); ++i) {
+    valid = (offset + sizeof(ArgTag)) <= header->size;
+    if (valid) {
+      ArgTag const tag{static_cast<ArgTag>(record[offset])};
+      offset += sizeof(ArgTag);
+      if (tag == ArgTag::kString) {
+        valid = (offset + sizeof(std::uint16_t)) <= header->size;
+        if (valid) {
+          std::uint16_t const length{detail::ReadValue<std::uint16_t>(&record[offset])};
+          offset += sizeof(std::uint16_t);
+          valid = ((offset + length + sizeof(char)) <= header->size) && (record[offset + length] == 0);
+          if (valid) {
+            // VECTOR NL AutosarC++17_10-A5.2.4: MD_LOG_AutosarC++17_10-A5.2.4_char_cast
+            visitor(core::StringView{reinterpret_cast<char const*>(&record[offset]), length});
+            offset += length + sizeof(char);
+          }
+        }
+      } else {
+        std::size_t const size{detail::FixedValueSize(tag)};
+        valid = (size != 0) && ((offset + size) <= header->size);
+        if (valid) {
+          detail::VisitFixed(tag, &record[offset], visitor);
+          offset += size;
+        }
+      }
+    }
+  }
+  return valid;
+}
+
+}  // namespace deferred
+}  // namespace internal
+}  // namespace log
+}  // namespace amsr
+
+#endif  // LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_H_
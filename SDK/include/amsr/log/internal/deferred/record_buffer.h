@@ -0,0 +1,424 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**     \file       record_buffer.h
+ *      \brief      Per-thread buffers for deferred log records.
+ *      \details    Every logging thread writes its records into its own single producer, single consumer byte ring.
+ *                  The rings of all threads are registered once and drained by the formatting thread.
+ *
+ *      \unit       LogAndTrace::Logging::DeferredRecordBuffer
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_BUFFER_H_
+#define LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_BUFFER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "amsr/core/span.h"
+#include "amsr/core/vector.h"
+#include "amsr/log/internal/deferred/record.h"
+#include "amsr/log/internal/mpsc/ring_buffer.h"
+
+namespace amsr {
+namespace log {
+namespace internal {
+namespace deferred {
+
+/*! \brief The default size of the record buffer of one thread in bytes. */
+constexpr std::size_t kDefaultRecordBufferSize{std::size_t{64} * 1024};
+
+/*!
+ * \brief Single producer, single consumer byte ring for deferred log records of one thread.
+ *
+ * \details A record is always stored contiguously. If a record does not fit in front of the end of the ring, the
+ *          remaining bytes are marked as padding and the record starts at the beginning.
+ */
+class ThreadRecordBuffer final {
+  /*! \brief The storage, allocated as 64 bit words to align records. */
+  std::unique_ptr<std::uint64_t[]> storage_;
+  /*! \brief The size of the ring in bytes, a power of two. */
+  std::size_t size_;
+  /*! \brief Position of the next write, only modified by the producer. */
+  std::atomic<std::size_t> tail_{0};
+  /*! \brief Last read position seen by the producer, so the consumer position is only loaded if the ring looks full. */
+  std::size_t cached_head_{0};
+  /*! \brief Padding that separates the producer and the consumer position. */
+  std::uint8_t padding_before_head_[mpsc::kCacheLineSize - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)]{};
+  /*! \brief Position of the next read, only modified by the consumer. */
+  std::atomic<std::size_t> head_{0};
+  /*! \brief The number of records dropped because the ring was full. */
+  std::atomic<std::uint64_t> dropped_count_{0};
+
+ public:
+  /*!
+   * \brief Constructor
+   * \param size The size of the ring in bytes. Rounded up to a power of two of at least 256 bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit ThreadRecordBuffer(std::size_t size) noexcept : storage_{}, size_{RoundUp(size)} {
+    // VECTOR NC AutosarC++17_10-A18.5.8: MD_LOG_AutosarC++17_10-A18.5.8_false_positive_local_heap
+    this->storage_ = std::make_unique<std::uint64_t[]>(this->size_ / sizeof(std::uint64_t));
+  }
+
+  /*! \brief Disallow move construction. */
+  ThreadRecordBuffer(ThreadRecordBuffer&&) = delete;
+  /*! \brief Disallow copy construction. */
+  ThreadRecordBuffer(ThreadRecordBuffer const&) = delete;
+  /*! \brief Disallow move assignment. */
+  auto operator=(ThreadRecordBuffer&&) -> ThreadRecordBuffer& = delete;
+  /*! \brief Disallow copy assignment. */
+  auto operator=(ThreadRecordBuffer const&) -> ThreadRecordBuffer& = delete;
+  /*!
+   * \brief Default destructor.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ~ThreadRecordBuffer() noexcept = default;
+
+  /*!
+   * \brief Reserves contiguous space for a record.
+   *
+   * \param size The size of the record. Must be a multiple of kRecordAlignment.
+   * \return     The reserved space or nullptr if the ring is full. Must be committed with Commit(size).
+   *
+   * \internal
+   *   - #10 If the record does not fit in front of the end of the ring, the rest of the ring is needed as padding.
+   *   - #20 If the free space behind the cached read position does not suffice, reload the read position.
+   *   - #30 If the free space suffices, write the padding marker and return the start of the record.
+   *   - #40 Otherwise count the dropped record.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Reserve(std::size_t size) noexcept -> std::uint8_t* {
+    std::uint8_t* result{nullptr};
+    std::size_t const tail{this->tail_.load(std::memory_order_relaxed)};
+    std::size_t const offset{tail & (this->size_ - 1)};
+    std::size_t const contiguous{this->size_ - offset};
+    std::size_t const padding{(size > contiguous) ? contiguous : std::size_t{0}};
+    if (((tail - this->cached_head_) + padding + size) > this->size_) {
+      this->cached_head_ = this->head_.load(std::memory_order_acquire);
+    }
+    if ((size <= (this->size_ / 2)) && (((tail - this->cached_head_) + padding + size) <= this->size_)) {
+      if (padding != 0) {
+        std::uint32_t const prefix[]{static_cast<std::uint32_t>(padding), kPaddingRecord};
+        static_cast<void>(std::memcpy(&this->Bytes()[offset], prefix, kRecordPrefixSize));
+        this->tail_.store(tail + padding, std::memory_order_release);
+      }
+      result = &this->Bytes()[(tail + padding) & (this->size_ - 1)];
+    } else {
+      this->dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Publishes the record written into the last reserved space.
+   * \param size The size passed to Reserve().
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void Commit(std::size_t size) noexcept {
+    this->tail_.store(this->tail_.load(std::memory_order_relaxed) + size, std::memory_order_release);
+  }
+
+  /*!
+   * \brief Passes the oldest record to a consumer and removes it.
+   *
+   * \tparam Fn   A callable with the signature void(core::Span<std::uint8_t const>).
+   * \param fn    The consumer.
+   * \return      True if a record was consumed.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename Fn>
+  auto TryConsume(Fn&& fn) noexcept -> bool {
+    bool consumed{false};
+    bool done{false};
+    std::size_t head{this->head_.load(std::memory_order_relaxed)};
+    std::size_t const tail{this->tail_.load(std::memory_order_acquire)};
+    while ((not done) && (head != tail)) {
+      std::uint8_t const* const record{&this->Bytes()[head & (this->size_ - 1)]};
+      std::uint32_t prefix[2]{};
+      static_cast<void>(std::memcpy(prefix, record, kRecordPrefixSize));
+      if (prefix[1] != kPaddingRecord) {
+        fn(core::Span<std::uint8_t const>{record, prefix[0]});
+        consumed = true;
+        done = true;
+      }
+      head += prefix[0];
+      this->head_.store(head, std::memory_order_release);
+    }
+    return consumed;
+  }
+
+  /*!
+   * \brief Checks if all records have been consumed.
+   * \return True if the ring is empty.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto IsEmpty() const noexcept -> bool {
+    return this->head_.load(std::memory_order_acquire) == this->tail_.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \brief Get the number of records dropped because the ring was full.
+   * \return The number of dropped records.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto GetDroppedCount() const noexcept -> std::uint64_t {
+    return this->dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /*!
+   * \brief Returns the storage as bytes.
+   * \return The first byte of the ring.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Bytes() const noexcept -> std::uint8_t* {
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_VAC_A5.2.4_reinterpretCast
+    return reinterpret_cast<std::uint8_t*>(this->storage_.get());
+  }
+
+  /*!
+   * \brief Rounds up the ring size.
+   * \param size The requested size.
+   * \return     The smallest power of two not smaller than size and 256.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto RoundUp(std::size_t size) noexcept -> std::size_t {
+    std::size_t result{256};
+    while (result < size) {
+      result <<= 1U;
+    }
+    return result;
+  }
+};
+
+/*!
+ * \brief Registry of the record buffers of all threads.
+ *
+ * \details A thread registers its buffer on its first deferred log call. The registry keeps the buffer alive after the
+ *          thread exited until all of its records have been consumed.
+ *          Records point to their logger. Only records of loggers that are registered with AddLogger() are consumed,
+ *          records of removed loggers are discarded.
+ */
+class RecordBufferRegistry final {
+  /*! \brief The guard protecting the lists of buffers and loggers. Only taken on registration and draining. */
+  std::mutex mutex_{};
+  /*! \brief The registered buffers. */
+  core::Vector<std::shared_ptr<ThreadRecordBuffer>> buffers_{};
+  /*! \brief The registered loggers and the number of their registrations. */
+  core::Vector<std::pair<Logger const*, std::size_t>> loggers_{};
+  /*! \brief The number of records dropped by buffers that have been released. */
+  std::uint64_t released_dropped_count_{0};
+  /*! \brief The number of records discarded because their logger was removed. */
+  std::uint64_t discarded_count_{0};
+
+ public:
+  /*!
+   * \brief Get the process wide registry.
+   * \return The registry.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto Instance() noexcept -> RecordBufferRegistry& {
+    static RecordBufferRegistry registry{};
+    return registry;
+  }
+
+  /*!
+   * \brief Creates and registers a buffer for the calling thread.
+   * \return The buffer.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Register() noexcept -> std::shared_ptr<ThreadRecordBuffer> {
+    // VECTOR NC AutosarC++17_10-A18.5.8: MD_LOG_AutosarC++17_10-A18.5.8_false_positive_local_heap
+    std::shared_ptr<ThreadRecordBuffer> buffer{std::make_shared<ThreadRecordBuffer>(kDefaultRecordBufferSize)};
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    // VCA_LOGAPI_CHECKED_CONTRACT
+    this->buffers_.push_back(buffer);
+    return buffer;
+  }
+
+  /*!
+   * \brief Registers a logger that records may be logged to.
+   * \param logger The logger. Must stay alive until it is removed again.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void AddLogger(Logger const& logger) noexcept {
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    core::Vector<std::pair<Logger const*, std::size_t>>::iterator const it{this->FindLogger(&logger)};
+    if (it != this->loggers_.end()) {
+      ++it->second;
+    } else {
+      // VCA_LOGAPI_CHECKED_CONTRACT
+      this->loggers_.emplace_back(&logger, 1);
+    }
+  }
+
+  /*!
+   * \brief Removes one registration of a logger.
+   * \details Once the last registration is removed, the remaining records of the logger are discarded.
+   * \param logger The logger.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void RemoveLogger(Logger const& logger) noexcept {
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    core::Vector<std::pair<Logger const*, std::size_t>>::iterator const it{this->FindLogger(&logger)};
+    if (it != this->loggers_.end()) {
+      --it->second;
+      if (it->second == 0) {
+        // VCA_LOGAPI_CHECKED_CONTRACT
+        static_cast<void>(this->loggers_.erase(it));
+      }
+    }
+  }
+
+  /*!
+   * \brief Consumes all records of all buffers.
+   *
+   * \tparam Fn A callable with the signature void(core::Span<std::uint8_t const>).
+   * \param fn  The consumer. Only called for records of registered loggers.
+   * \return    The number of consumed records.
+   *
+   * \details Buffers of exited threads are released once they are empty.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename Fn>
+  auto ConsumeAll(Fn&& fn) noexcept -> std::size_t {
+    std::size_t count{0};
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    auto const consume_if_logger_registered = [this, &fn, &count](core::Span<std::uint8_t const> record) {
+      Optional<RecordHeader> const header{ReadHeader(record)};
+      if (header.has_value() && (this->FindLogger(header->logger) != this->loggers_.end())) {
+        fn(record);
+        ++count;
+      } else {
+        ++this->discarded_count_;
+      }
+    };
+    for (std::shared_ptr<ThreadRecordBuffer> const& buffer : this->buffers_) {
+      bool consumed{true};
+      while (consumed) {
+        consumed = buffer->TryConsume(consume_if_logger_registered);
+      }
+    }
+    // VCA_LOGAPI_CHECKED_CONTRACT
+    this->buffers_.erase(std::remove_if(this->buffers_.begin(), this->buffers_.end(),
+                                        [this](std::shared_ptr<ThreadRecordBuffer> const& buffer) {
+                                          bool const release{(buffer.use_count() == 1) && buffer->IsEmpty()};
+                                          if (release) {
+                                            this->released_dropped_count_ += buffer->GetDroppedCount();
+                                          }
+                                          return release;
+                                        }),
+                         this->buffers_.end());
+    return count;
+  }
+
+  /*!
+   * \brief Get the number of records dropped by all threads because their buffer was full.
+   * \return The number of dropped records.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto GetDroppedCount() noexcept -> std::uint64_t {
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    std::uint64_t count{this->released_dropped_count_};
+    for (std::shared_ptr<ThreadRecordBuffer> const& buffer : this->buffers_) {
+      count += buffer->GetDroppedCount();
+    }
+    return count;
+  }
+
+  /*!
+   * \brief Get the number of records discarded because their logger was removed before they were consumed.
+   * \return The number of discarded records.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto GetDiscardedCount() noexcept -> std::uint64_t {
+    std::lock_guard<std::mutex> const guard{this->mutex_};
+    return this->discarded_count_;
+  }
+
+ private:
+  /*!
+   * \brief Finds the registration of a logger.
+   * \param logger The logger.
+   * \return       The registration or the end of the list.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto FindLogger(Logger const* logger) noexcept -> core::Vector<std::pair<Logger const*, std::size_t>>::iterator {
+    return std::find_if(this->loggers_.begin(), this->loggers_.end(),
+                        [logger](std::pair<Logger const*, std::size_t> const& entry) { return entry.first == logger; });
+  }
+};
+
+/*!
+ * \brief Get the record buffer of the calling thread.
+ * \return The buffer, registered on the first call of a thread.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline auto GetThreadRecordBuffer() noexcept -> ThreadRecordBuffer& {
+  thread_local std::shared_ptr<ThreadRecordBuffer> const buffer{RecordBufferRegistry::Instance().Register()};
+  return *buffer;
+}
+
+}  // namespace deferred
+}  // namespace internal
+}  // namespace log
+}  // namespace amsr
+
+#endif  // LIB_AMSR_LOG_INCLUDE_AMSR_LOG_INTERNAL_DEFERRED_RECORD_BUFFER_H_
@@ -24,7 +24,9 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "amsr/log/internal/mpsc/mpsc_fwd.h"
@@ -136,6 +138,24 @@ class Consumer final {
     this->queue_->ClearOnMessage();
   }
 
+  /*!
+   * \brief Get the number of values the producers could not add because the queue was full.
+   * \details Only the lock-free queue counts dropped values. Producers of the other strategies get the
+   *          LogErrc::kBufferTooSmall error of Push() instead.
+   *
+   * \tparam S The synchronization strategy.
+   *           Must be sync::Strategy::kLockFree.
+   * \return The number of dropped values.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <sync::Strategy S = thread, std::enable_if_t<S == sync::Strategy::kLockFree, std::uint8_t> = 0>
+  auto GetDroppedCount() const noexcept -> std::uint64_t {
+    // VCA_LOGAPI_VALID_OBJECT
+    return this->queue_->GetDroppedCount();
+  }
+
  private:
   /*!
    * \brief Value constructor that is called by MakeMPSC
@@ -24,12 +24,16 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <atomic>
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
 #include "amsr/log/internal/log_error_domain.h"
+#include "amsr/log/internal/mpsc/ring_buffer.h"
 #include "amsr/log/internal/sync/primitive.h"
 #include "amsr/log/internal/utils.h"
 #include "vac/language/unique_function.h"
@@ -274,6 +278,202 @@ class Queue final {
   void CallOnMessage() const noexcept { this->on_message_(nullptr); }
 };
 
+/*!
+ * \brief Internal lock-free queue
+ *
+ * \tparam T The value type of the queue.
+ *           Must implement the MoveConstructible and Destructible named requirements.
+ *           Must also meet the type requirements of amsr::core::Optional<T>::Optional()
+ *           and amsr::core::Optional<T>::Emplace.
+ *
+ * \details Values are stored in a preallocated ring buffer, so pushing neither locks nor allocates.
+ *          The on message callback is never called concurrently. A producer that finds the callback busy leaves a
+ *          pending notification, which the thread currently running the callback delivers before it returns.
+ */
+template <typename T>
+class Queue<T, sync::Strategy::kLockFree> final {
+ public:
+  /*! \brief Type for the on direct message callback */
+  using OnMessage = vac::language::UniqueFunction<bool(T* const) const>;
+
+ private:
+  /*! \brief The ring buffer containing the data. */
+  RingBuffer<T> ring_;
+  /*! \brief The on message callback. */
+  OnMessage mutable on_message_{[](T const* const) { return false; }};
+  /*! \brief Set while a thread runs or replaces the on message callback. */
+  std::atomic_flag callback_busy_ = ATOMIC_FLAG_INIT;
+  /*! \brief Set if a notification about a new value in the ring buffer has not been delivered yet. */
+  std::atomic<bool> notification_pending_{false};
+  /*! \brief The number of values rejected because the queue was full. */
+  std::atomic<std::uint64_t> dropped_count_{0};
+
+ public:
+  /*! \brief Reference type of the contained value. */
+  using reference = T&;
+
+  /*!
+   * \brief Constructor
+   * \param capacity The capacity for the queue. Rounded up to the next power of two.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit Queue(std::uint32_t capacity) noexcept : ring_{capacity} {}
+
+  /*! \brief Disallow move construction. */
+  Queue(Queue&&) = delete;
+  /*! \brief Disallow copy construction. */
+  Queue(Queue const&) = delete;
+  /*! \brief Disallow move assignment. */
+  auto operator=(Queue&&) -> Queue& = delete;
+  /*! \brief Disallow copy assignment. */
+  auto operator=(Queue const&) -> Queue& = delete;
+  /*!
+   * \brief Default destructor.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  // VCA_LOGAPI_CHECKED_CONTRACT
+  ~Queue() noexcept = default;
+
+  /*!
+   * \brief Add a value to the queue
+   *
+   * \param value The value to add
+   * \return      Nothing or the error that occurred.
+   *
+   * \internal
+   *   - #10 Try to send data directly to the receiver.
+   *   - #20 If sending directly failed, store the value in the ring buffer.
+   *    - #30 If stored, notify the user about a new message in the queue.
+   *    - #40 Otherwise count the dropped value.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Push(T&& value) noexcept -> Result<void> {
+    Result<void> result{};
+    if (not this->PushToUser(value)) {
+      if (this->ring_.TryPush(value)) {
+        this->notification_pending_.store(true);
+        this->DeliverNotifications();
+      } else {
+        this->dropped_count_.fetch_add(1, std::memory_order_relaxed);
+        result.EmplaceError(Err(LogErrc::kBufferTooSmall, "Message could not be added to queue"));
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Pop from this queue.
+   *
+   * \return either the popped element or nothing.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Pop() noexcept -> Optional<T> { return this->ring_.TryPop(); }
+
+  /*!
+   * \brief Set the on message callback
+   *
+   * \param on_message The callback to call on new messages
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetOnMessage(OnMessage&& on_message) noexcept { this->ReplaceOnMessage(std::move(on_message)); }
+
+  /*!
+   * \brief Removes the currently set on message callback.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void ClearOnMessage() noexcept {
+    this->ReplaceOnMessage([](T const* const) { return false; });
+  }
+
+  /*!
+   * \brief Get the number of values rejected because the queue was full.
+   *
+   * \return The number of dropped values.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto GetDroppedCount() const noexcept -> std::uint64_t {
+    return this->dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /*!
+   * \brief Try to send the value to the user.
+   *
+   * \param value The value to push.
+   * \return      True in case the circumvention was successful.
+   *
+   * \internal
+   *   - #10 If we get exclusive access to the message callback.
+   *    - #20 Then alert the user about this message.
+   *    - #30 Release the callback and deliver notifications left by other producers meanwhile.
+   *   - #40 Return the result of the operation.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto PushToUser(T& value) noexcept -> bool {
+    bool result{false};
+    if (not this->callback_busy_.test_and_set(std::memory_order_acquire)) {
+      result = this->on_message_(&value);
+      this->callback_busy_.clear();
+      this->DeliverNotifications();
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Calls the on message callback for pending notifications unless another thread runs it.
+   *
+   * \details The pending flag is stored before the busy flag is tested, and the busy flag is cleared before the
+   *          pending flag is tested again (both sequentially consistent), so a notification is never lost.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void DeliverNotifications() noexcept {
+    while (this->notification_pending_.load() && (not this->callback_busy_.test_and_set())) {
+      if (this->notification_pending_.exchange(false)) {
+        this->on_message_(nullptr);
+      }
+      this->callback_busy_.clear();
+    }
+  }
+
+  /*!
+   * \brief Replaces the on message callback.
+   *
+   * \param on_message The new callback.
+   * \details Waits until no other thread runs the callback. Only called on configuration changes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void ReplaceOnMessage(OnMessage&& on_message) noexcept {
+    while (this->callback_busy_.test_and_set(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    this->on_message_ = std::move(on_message);
+    this->callback_busy_.clear();
+    this->DeliverNotifications();
+  }
+};
+
 }  // namespace mpsc
 }  // namespace internal
 }  // namespace log
@@ -0,0 +1,241 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**     \file       ring_buffer.h
+ *      \brief      Bounded lock-free ring buffer used by the lock-free MPSC queue.
+ *      \details    All cells are allocated on construction. Every cell carries a sequence number that tells producers
+ *                  and consumers whether the cell is free or holds an element of the current lap.
+ *
+ *      \unit       LogAndTrace::Common::MPSC::RingBuffer
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_COMMON_INCLUDE_AMSR_LOG_INTERNAL_MPSC_RING_BUFFER_H_
+#define LIB_COMMON_INCLUDE_AMSR_LOG_INTERNAL_MPSC_RING_BUFFER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "amsr/log/internal/utils.h"
+
+namespace amsr {
+namespace log {
+namespace internal {
+namespace mpsc {
+
+/*!
+ * \brief Assumed cache line size, used to keep the producer and the consumer index apart.
+ */
+constexpr std::size_t kCacheLineSize{64};
+
+/*!
+ * \brief Bounded lock-free ring buffer.
+ *
+ * \tparam T The value type of the ring buffer.
+ *           Must implement the MoveConstructible and Destructible named requirements.
+ *
+ * \details Any number of threads may push and pop concurrently.
+ *          Pushing never allocates, a push into a full ring buffer fails.
+ */
+template <typename T>
+class RingBuffer final {
+  /*! \brief One slot of the ring. */
+  struct Cell {
+    /*! \brief Sequence number of the cell. */
+    std::atomic<std::size_t> sequence{0};
+    /*! \brief Storage for one element. */
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+  };
+
+  /*! \brief The cells of the ring. */
+  std::unique_ptr<Cell[]> cells_;
+  /*! \brief The number of cells. */
+  std::size_t size_;
+  /*! \brief Padding that keeps the producer index on its own cache line. */
+  std::uint8_t padding_before_tail_[kCacheLineSize]{};
+  /*! \brief Position of the next push. */
+  std::atomic<std::size_t> tail_{0};
+  /*! \brief Padding that separates the producer and the consumer index. */
+  std::uint8_t padding_before_head_[kCacheLineSize - sizeof(std::atomic<std::size_t>)]{};
+  /*! \brief Position of the next pop. */
+  std::atomic<std::size_t> head_{0};
+  /*! \brief Padding that keeps the consumer index on its own cache line. */
+  std::uint8_t padding_after_head_[kCacheLineSize - sizeof(std::atomic<std::size_t>)]{};
+
+ public:
+  /*!
+   * \brief Constructor
+   *
+   * \param capacity The capacity of the ring buffer. Rounded up to the next power of two.
+   *                 A capacity of 0 creates a ring buffer that rejects every push.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit RingBuffer(std::uint32_t capacity) noexcept : cells_{}, size_{RoundUpToPowerOfTwo(capacity)} {
+    if (this->size_ > 0) {
+      // VECTOR NC AutosarC++17_10-A18.5.8: MD_LOG_AutosarC++17_10-A18.5.8_false_positive_local_heap
+      this->cells_ = std::make_unique<Cell[]>(this->size_);
+      for (std::size_t i{0}; i < this->size_; ++i) {
+        this->cells_[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /*! \brief Disallow move construction. */
+  RingBuffer(RingBuffer&&) = delete;
+  /*! \brief Disallow copy construction. */
+  RingBuffer(RingBuffer const&) = delete;
+  /*! \brief Disallow move assignment. */
+  auto operator=(RingBuffer&&) -> RingBuffer& = delete;
+  /*! \brief Disallow copy assignment. */
+  auto operator=(RingBuffer const&) -> RingBuffer& = delete;
+
+  /*!
+   * \brief Destroys all elements that are still stored.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ~RingBuffer() noexcept {
+    while (this->TryPop().has_value()) {
+    }
+  }
+
+  /*!
+   * \brief Try to add a value to the ring buffer.
+   *
+   * \param value The value to add. Left untouched if the ring buffer is full.
+   * \return      True if the value was added.
+   *
+   * \internal
+   *   - #10 Load the cell at the current producer position.
+   *   - #20 If the cell is free for this lap, try to claim the position.
+   *    - #30 On success move the value into the cell and publish it.
+   *   - #40 If the cell still holds an element of the previous lap, the ring buffer is full.
+   *   - #50 Otherwise another producer claimed the position, retry with the new one.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto TryPush(T& value) noexcept -> bool {
+    bool pushed{false};
+    bool done{this->size_ == 0};
+    std::size_t position{this->tail_.load(std::memory_order_relaxed)};
+    while (not done) {
+      Cell& cell{this->cells_[position & (this->size_ - 1)]};
+      std::size_t const sequence{cell.sequence.load(std::memory_order_acquire)};
+      std::intptr_t const diff{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position)};
+      if (diff == 0) {
+        if (this->tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          // VCA_LOGAPI_CHECKED_CONTRACT
+          static_cast<void>(new (&cell.storage) T(std::move(value)));
+          cell.sequence.store(position + 1, std::memory_order_release);
+          pushed = true;
+          done = true;
+        }
+      } else if (diff < 0) {
+        done = true;
+      } else {
+        position = this->tail_.load(std::memory_order_relaxed);
+      }
+    }
+    return pushed;
+  }
+
+  /*!
+   * \brief Try to remove the oldest value from the ring buffer.
+   *
+   * \return Either the removed value or nothing.
+   *
+   * \internal
+   *   - #10 Load the cell at the current consumer position.
+   *   - #20 If the cell holds an element of this lap, try to claim the position.
+   *    - #30 On success move the element out and free the cell for the next lap.
+   *   - #40 If the cell is still free, the ring buffer is empty.
+   *   - #50 Otherwise another consumer claimed the position, retry with the new one.
+   * \endinternal
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto TryPop() noexcept -> Optional<T> {
+    Optional<T> result{};
+    bool done{this->size_ == 0};
+    std::size_t position{this->head_.load(std::memory_order_relaxed)};
+    while (not done) {
+      Cell& cell{this->cells_[position & (this->size_ - 1)]};
+      std::size_t const sequence{cell.sequence.load(std::memory_order_acquire)};
+      std::intptr_t const diff{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1)};
+      if (diff == 0) {
+        if (this->head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          // VECTOR NL AutosarC++17_10-A5.2.4: MD_LOG_AutosarC++17_10-A5.2.4_cast_from_aligned_storage
+          T& element{*reinterpret_cast<T*>(&cell.storage)};
+          result.emplace(std::move(element));
+          // VCA_LOGAPI_CHECKED_CONTRACT
+          element.~T();
+          cell.sequence.store(position + this->size_, std::memory_order_release);
+          done = true;
+        }
+      } else if (diff < 0) {
+        done = true;
+      } else {
+        position = this->head_.load(std::memory_order_relaxed);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Returns the number of cells.
+   *
+   * \return The capacity of the ring buffer.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  auto Capacity() const noexcept -> std::size_t { return this->size_; }
+
+ private:
+  /*!
+   * \brief Rounds up to the next power of two.
+   *
+   * \param value The value to round.
+   * \return      The smallest power of two not smaller than value, or 0 for 0.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  static auto RoundUpToPowerOfTwo(std::uint32_t value) noexcept -> std::size_t {
+    std::size_t result{(value == 0) ? std::size_t{0} : std::size_t{1}};
+    while (result < value) {
+      result <<= 1U;
+    }
+    return result;
+  }
+};
+
+}  // namespace mpsc
+}  // namespace internal
+}  // namespace log
+}  // namespace amsr
+
+#endif  // LIB_COMMON_INCLUDE_AMSR_LOG_INTERNAL_MPSC_RING_BUFFER_H_
@@ -114,9 +114,10 @@ class TryLock final {
  * \tparam kStrategy The strategy to use for the synchronization primitive.
  *
  * \details Supports Mutexes, Spinlocks & a dummy implemenation (single threaded usecase).
+ *          Strategy::kLockFree maps to a mutex, as only the MPSC queue has a lock-free implementation.
  */
 template <Strategy kStrategy>
-using Primitive = std::conditional_t<kStrategy == Strategy::kMutex, std::mutex, EmptyLock>;
+using Primitive = std::conditional_t<kStrategy == Strategy::kEmpty, EmptyLock, std::mutex>;
 
 }  // namespace sync
 }  // namespace internal
@@ -30,10 +30,15 @@ namespace amsr {
 namespace log {
 namespace internal {
 namespace sync {
-/*! \brief Thread synchronization specification */
+/*!
+ * \brief Thread synchronization specification
+ * \details kLockFree is opt-in and selects the lock-free ring buffer for MPSC queues. Other synchronization primitives
+ *          use a mutex for it.
+ */
 enum class Strategy : std::uint8_t {
   kMutex = 1,
   kEmpty = 2,
+  kLockFree = 3,
   kDefault = kMutex,
 };
 }  // namespace sync
@@ -23,6 +23,7 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include <cstdint>
+#include <type_traits>
 
 #include "amsr/log/internal/abort.h"
 #include "amsr/log/internal/serialize.h"
@@ -105,6 +106,50 @@ inline auto Serialize(ByteView buffer, DltString value) noexcept -> SerResult {
       .AndThen([&value](ByteView view) { return detail::SerializeDescription(view, value.GetDescription()); })
       .AndThen([&msg](ByteView view) { return internal::Serialize(view, msg, "Serialize DLT String."_sv); });
 }
+
+/*!
+ * \brief Serialize a boolean for DLT verbose mode.
+ *
+ * \param buffer The buffer to serialize into.
+ * \param value  The value to serialize.
+ * \return       The serializer result.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline auto SerializeBool(ByteView buffer, bool value) noexcept -> SerResult {
+  TypeInfo info{};
+  info.SetBool();
+  return native::Serialize(buffer, info.GetSerializable(), "Serialize DLT Bool Type Info."_sv)
+      .AndThen([value](ByteView view) { return internal::Serialize(view, value, "Serialize DLT Bool."_sv); });
+}
+
+/*!
+ * \brief Serialize an integer or floating point number for DLT verbose mode.
+ *
+ * \tparam T     The type of the number.
+ *               Must be an arithmetic type other than bool.
+ * \param buffer The buffer to serialize into.
+ * \param value  The value to serialize.
+ * \return       The serializer result.
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename T>
+auto SerializeNumber(ByteView buffer, T value) noexcept -> SerResult {
+  static_assert(std::is_arithmetic<T>::value && (not std::is_same<T, bool>::value), "Only numbers are supported.");
+  TypeInfo info{};
+  if (std::is_floating_point<T>::value) {
+    info.SetFloat(sizeof(T));
+  } else if (std::is_signed<T>::value) {
+    info.SetSigned(sizeof(T));
+  } else {
+    info.SetUnsigned(sizeof(T));
+  }
+  return native::Serialize(buffer, info.GetSerializable(), "Serialize DLT Number Type Info."_sv)
+      .AndThen([value](ByteView view) { return native::Serialize(view, value, "Serialize DLT Number."_sv); });
+}
 }  // namespace verbose
 }  // namespace internal
 }  // namespace log
@@ -22,6 +22,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
 #include <cstdint>
 
 #include "amsr/core/string_view.h"
@@ -81,6 +82,49 @@ class TypeInfo {
    * \endspec
    */
   auto IsString() const & noexcept -> bool { return this->HasBit(9); }
+  /*!
+   * \brief Sets the type info to be a boolean.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetBool() & noexcept {
+    this->SetTypeLength(sizeof(bool));
+    this->SetBit(4);
+  }
+  /*!
+   * \brief Sets the type info to be a signed integer.
+   * \param size The size of the integer in bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetSigned(std::size_t size) & noexcept {
+    this->SetTypeLength(size);
+    this->SetBit(5);
+  }
+  /*!
+   * \brief Sets the type info to be an unsigned integer.
+   * \param size The size of the integer in bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetUnsigned(std::size_t size) & noexcept {
+    this->SetTypeLength(size);
+    this->SetBit(6);
+  }
+  /*!
+   * \brief Sets the type info to be a floating point number.
+   * \param size The size of the number in bytes.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetFloat(std::size_t size) & noexcept {
+    this->SetTypeLength(size);
+    this->SetBit(7);
+  }
   /*!
    * \brief Set the VARI flag to signify a description/unit.
    * \spec
@@ -106,6 +150,20 @@ class TypeInfo {
   void SetBit(std::uint32_t idx) & noexcept {
     this->serialized_ = static_cast<std::uint32_t>(this->serialized_ | static_cast<std::uint32_t>(1ul << idx));
   }
+  /*!
+   * \brief Sets the type length field (TYLE) for a value of the given size.
+   * \details DLT encodes 8, 16, 32, 64 & 128 bit as 1 to 5.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void SetTypeLength(std::size_t size) & noexcept {
+    std::uint32_t length{1};
+    while ((length < 5) && ((std::size_t{1} << (length - 1)) < size)) {
+      ++length;
+    }
+    this->serialized_ = static_cast<std::uint32_t>(this->serialized_ | length);
+  }
   /*!
    * \brief Checks a single bit in the u32.
    * \spec
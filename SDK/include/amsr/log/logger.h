@@ -614,6 +614,21 @@ class Logger final {
    */
   auto IsEnabled(core::StringView sink, LogLevel log_level) const noexcept -> internal::FilterResult;
 
+  /*!
+   * \brief Checks the log level against the threshold of this logger without consulting the sinks.
+   *
+   * \param log_level Log level to verify
+   * \return          True if at least one sink may accept the log level.
+   *
+   * \details Inline fast path for the deferred logging front-end.
+   * \spec
+   *   requires true;
+   * \endspec
+   *
+   * \vprivate Component private.
+   */
+  auto IsLevelRelevant(LogLevel log_level) const noexcept -> bool { return this->log_levels_.IsRelevant(log_level); }
+
   /*!
    * \brief Returns the proxy to the LoggerBase for accessing application ID, remote logger etc.
    *
@@ -0,0 +1,305 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file
+ *        \brief  Defines a bounded single-producer-single-consumer queue that overwrites the oldest element when full.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_COMMON_LIBOSABSTRACTION_INTERFACE_INCLUDE_AMSR_MEMORY_CONTAINER_OVERWRITING_SPSC_QUEUE_H_
+#define LIB_COMMON_LIBOSABSTRACTION_INTERFACE_INCLUDE_AMSR_MEMORY_CONTAINER_OVERWRITING_SPSC_QUEUE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "amsr/core/optional.h"
+#include "vac/container/static_vector.h"
+
+namespace amsr {
+namespace memory {
+namespace container {
+
+/*!
+ * \brief   Bounded lock-free single-producer single-consumer queue that overwrites the oldest element when full.
+ * \details Follows the free-running index design of SPSCQueueProducer and SPSCQueueConsumer: head and tail
+ *          indices only grow and are mapped into the buffer by modulo capacity. In addition every cell carries a
+ *          sequence number, so that the producer can take over the oldest cell from the consumer side when the queue
+ *          is full. Taking over the oldest cell and consuming it are arbitrated by a compare-exchange on the tail
+ *          index, i.e. an element is either consumed or dropped, never both.
+ *          If the producer finds the queue full while the consumer is just moving the oldest element out, the new
+ *          element is dropped instead of waiting for the consumer.
+ *          Unlike the SPSCQueue the elements are stored in process-local memory owned by the queue.
+ *
+ * \tparam  T  Type of the stored elements. Must be move constructible.
+ *
+ * \vprivate    Vector product internal API
+ */
+template <typename T>
+class OverwritingSpscQueue final {
+ public:
+  /*!
+   * \brief Result of an Enqueue() call.
+   */
+  enum class EnqueueResult : std::uint8_t {
+    /*!
+     * \brief The element was stored.
+     */
+    kEnqueued,
+    /*!
+     * \brief The element was stored, the oldest element was dropped to make room.
+     */
+    kEnqueuedOldestDropped,
+    /*!
+     * \brief The element was dropped because the queue was full and the oldest element was being consumed.
+     */
+    kNewestDropped,
+    /*!
+     * \brief The element was dropped because the queue has no capacity.
+     */
+    kNoCapacity
+  };
+
+  /*!
+   * \brief Construct an empty queue without capacity.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      FALSE
+   */
+  OverwritingSpscQueue() noexcept = default;
+
+  /*!
+   * \brief Destroy the queue and all stored elements.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      FALSE
+   */
+  ~OverwritingSpscQueue() noexcept = default;
+
+  OverwritingSpscQueue(OverwritingSpscQueue const&) noexcept = delete;
+  auto operator=(OverwritingSpscQueue const&) noexcept -> OverwritingSpscQueue& = delete;
+  OverwritingSpscQueue(OverwritingSpscQueue&&) noexcept = delete;
+  auto operator=(OverwritingSpscQueue&&) noexcept -> OverwritingSpscQueue& = delete;
+
+  /*!
+   * \brief Drop all elements and set a new capacity.
+   *
+   * \param[in] capacity  The number of elements that can be stored. Zero disables the queue.
+   *
+   * \pre         Neither Enqueue() nor Dequeue() is called concurrently.
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      FALSE
+   */
+  void Reset(std::size_t capacity) noexcept {
+    ::vac::container::StaticVector<Cell> cells{};
+    if (capacity != 0U) {
+      cells.resize(capacity);
+    }
+    std::uint64_t sequence{0U};
+    for (Cell& cell : cells) {
+      cell.sequence.store(sequence, std::memory_order_relaxed);
+      ++sequence;
+    }
+    cells_.swap(cells);
+    head_index_.store(0U, std::memory_order_relaxed);
+    tail_index_.store(0U, std::memory_order_release);
+  }
+
+  /*!
+   * \brief Returns the capacity of the queue.
+   *
+   * \return Number of elements that can be stored.
+   *
+   * \pre         -
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   */
+  auto Capacity() const noexcept -> std::size_t { return cells_.size(); }
+
+  /*!
+   * \brief Returns the number of stored elements.
+   * \details Exact only when called by the producer or the consumer while the other side is idle, an upper bound
+   *          otherwise.
+   *
+   * \return Number of stored elements.
+   *
+   * \pre         -
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   */
+  auto Size() const noexcept -> std::size_t {
+    std::uint64_t const tail_index{tail_index_.load(std::memory_order_acquire)};
+    std::uint64_t const head_index{head_index_.load(std::memory_order_acquire)};
+    return (head_index > tail_index) ? static_cast<std::size_t>(head_index - tail_index) : 0U;
+  }
+
+  /*!
+   * \brief   Store an element, dropping the oldest element if the queue is full.
+   *
+   * \param[in] element  The element to store.
+   *
+   * \return Whether the element was stored and whether an element was dropped.
+   *
+   * \pre         Must only be called by the single producer.
+   * \context     Reactor
+   * \threadsafe  TRUE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   *
+   * \internal
+   * - If the queue has no capacity, drop the element.
+   * - If the cell at the head index is free, store the element and publish it.
+   * - Otherwise the queue is full:
+   *   - Try to claim the oldest element by advancing the tail index.
+   *   - If the claim succeeds, replace the oldest element by the new one and publish it.
+   *   - Otherwise the consumer is consuming the oldest element, drop the new element.
+   * \endinternal
+   */
+  auto Enqueue(T&& element) noexcept -> EnqueueResult {
+    EnqueueResult result{EnqueueResult::kNoCapacity};
+    std::size_t const capacity{cells_.size()};
+    if (capacity != 0U) {
+      std::uint64_t const head_index{head_index_.load(std::memory_order_relaxed)};
+      Cell& cell{cells_[static_cast<std::size_t>(head_index % capacity)]};
+      if (cell.sequence.load(std::memory_order_acquire) == head_index) {
+        result = EnqueueResult::kEnqueued;
+      } else {
+        std::uint64_t oldest_index{head_index - capacity};
+        if (tail_index_.compare_exchange_strong(oldest_index, oldest_index + 1U, std::memory_order_acq_rel)) {
+          cell.element.reset();
+          result = EnqueueResult::kEnqueuedOldestDropped;
+        } else {
+          result = EnqueueResult::kNewestDropped;
+        }
+      }
+      if (result != EnqueueResult::kNewestDropped) {
+        cell.element.emplace(std::move(element));
+        cell.sequence.store(head_index + 1U, std::memory_order_release);
+        head_index_.store(head_index + 1U, std::memory_order_release);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Remove the oldest element.
+   *
+   * \return The oldest element, or an empty Optional if the queue is empty.
+   *
+   * \pre         Must only be called by the single consumer.
+   * \context     App
+   * \threadsafe  TRUE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   *
+   * \internal
+   * - Loop:
+   *   - If the cell at the tail index holds the element for this index, try to claim it by advancing the tail index.
+   *     - If the claim succeeds, move the element out and release the cell to the producer.
+   *     - Otherwise the producer dropped the element, retry with the new tail index.
+   *   - Otherwise the queue is empty.
+   * \endinternal
+   */
+  auto Dequeue() noexcept -> ::amsr::core::Optional<T> {
+    ::amsr::core::Optional<T> result{};
+    std::size_t const capacity{cells_.size()};
+    if (capacity != 0U) {
+      std::uint64_t tail_index{tail_index_.load(std::memory_order_acquire)};
+      bool done{false};
+      while (!done) {
+        Cell& cell{cells_[static_cast<std::size_t>(tail_index % capacity)]};
+        if (cell.sequence.load(std::memory_order_acquire) != (tail_index + 1U)) {
+          done = true;  // Empty.
+        } else if (tail_index_.compare_exchange_weak(tail_index, tail_index + 1U, std::memory_order_acq_rel)) {
+          result.emplace(std::move(*cell.element));
+          cell.element.reset();
+          cell.sequence.store(tail_index + capacity, std::memory_order_release);
+          done = true;
+        } else {
+          // The producer dropped the element or the exchange failed spuriously, tail_index has been reloaded.
+        }
+      }
+    }
+    return result;
+  }
+
+ private:
+  /*!
+   * \brief One buffer cell.
+   */
+  struct Cell {
+    /*!
+     * \brief Index + 1 if the cell holds the element with that index, index if the cell is free for that index.
+     */
+    std::atomic<std::uint64_t> sequence{0U};
+
+    /*!
+     * \brief The stored element.
+     */
+    ::amsr::core::Optional<T> element{};
+  };
+
+  /*!
+   * \brief The buffer cells.
+   */
+  ::vac::container::StaticVector<Cell> cells_{};
+
+  /*!
+   * \brief Free-running index of the next element to be stored. Only written by the producer.
+   */
+  std::atomic<std::uint64_t> head_index_{0U};
+
+  /*!
+   * \brief Free-running index of the oldest stored element. Advanced by the consumer and, when dropping, the producer.
+   */
+  std::atomic<std::uint64_t> tail_index_{0U};
+};
+
+}  // namespace container
+}  // namespace memory
+}  // namespace amsr
+
+#endif  // LIB_COMMON_LIBOSABSTRACTION_INTERFACE_INCLUDE_AMSR_MEMORY_CONTAINER_OVERWRITING_SPSC_QUEUE_H_
@@ -22,6 +22,9 @@
 #ifndef LIB_NET_LIBOSABSTRACTION_INTERFACE_INCLUDE_AMSR_NET_INTERNAL_BASIC_DATAGRAM_SOCKET_H_
 #define LIB_NET_LIBOSABSTRACTION_INTERFACE_INCLUDE_AMSR_NET_INTERNAL_BASIC_DATAGRAM_SOCKET_H_
 
+#include <sys/socket.h>
+
+#include <cstring>
 #include <iterator>
 #include <utility>
 
@@ -31,6 +34,8 @@
 #include "amsr/net/interface.h"
 #include "amsr/net/internal/basic_socket.h"
 #include "amsr/net/internal/os_interface.h"
+#include "amsr/net/internal/os_interface_errors.h"
+#include "amsr/net/internal/os_interface_helper.h"
 #include "amsr/net/internal/specific_types.h"
 #include "amsr/net/internal/types.h"
 #include "amsr/net/ip/address_utils.h"
@@ -148,6 +153,23 @@ class BasicDatagramSocket final : public BasicSocket<Protocol, BasicDatagramSock
   using SockOptMulticastLoop =
       SocketOptionIPBoolean<IPPROTO_IP, IP_MULTICAST_LOOP, kIPv6MulticastLoopProtocol, kIPv6MulticastLoop>;
 
+  /*!
+   * \brief Socket option to set the UDP generic segmentation offload (GSO) segment size for all sent datagrams.
+   *
+   * \details A value of 0 disables segmentation. Setting the option fails if the kernel does not support UDP GSO.
+   *          SendToSyncSegmented() sets the segment size per call and does not require this option.
+   */
+  using SockOptUdpSegment = SocketOptionSignedInteger<IPPROTO_UDP, kUdpSegment>;
+
+  /*!
+   * \brief Socket option to enable / disable UDP generic receive offload (GRO).
+   *
+   * \details If enabled, the kernel may coalesce consecutive datagrams of the same flow and size into one buffer. Such
+   *          buffers must be received with ReceiveFromSyncCoalesced(). Setting the option fails if the kernel does not
+   *          support UDP GRO.
+   */
+  using SockOptUdpGro = SocketOptionBoolean<IPPROTO_UDP, kUdpGro>;
+
   /*!
    * \brief Notifies about a completed asynchronous send operation.
    *
@@ -192,6 +214,27 @@ class BasicDatagramSocket final : public BasicSocket<Protocol, BasicDatagramSock
     std::size_t datagram_size{};
   };
 
+  /*!
+   * \brief Stores additional information about a received buffer that may contain coalesced datagrams.
+   */
+  struct CoalescedDatagramInfo {
+    /*!
+     * \brief The sender's network endpoint.
+     */
+    EndpointType remote_endpoint;
+
+    /*!
+     * \brief Total number of received bytes.
+     */
+    std::size_t datagram_size{};
+
+    /*!
+     * \brief Size of every coalesced datagram except the last one, which may be shorter. Equals datagram_size if the
+     *        kernel did not coalesce datagrams.
+     */
+    std::size_t segment_size{};
+  };
+
   /*!
    * \brief Notifies about a completed asynchronous receive operation.
    *
@@ -1077,6 +1120,50 @@ class BasicDatagramSocket final : public BasicSocket<Protocol, BasicDatagramSock
       ::amsr::core::Span<std::pair<::amsr::core::Span<std::uint8_t const>, EndpointType>> datagrams) noexcept
       -> ::amsr::core::Result<std::size_t>;
 
+  /*!
+   * \brief Sends multiple datagrams of equal size to one destination with a single UDP GSO send call.
+   *
+   * \details
+   * The kernel (or the network card) splits the payload into datagrams of segment_size bytes. The last datagram may be
+   * shorter. The number of datagrams must not exceed kMaxUdpGsoSegments and the payload must not exceed
+   * kMaxUdpOffloadSize.
+   * If the kernel does not support UDP GSO the call fails and nothing is sent. The caller shall fall back to
+   * SendToSyncBulk() in that case.
+   *
+   * \param[in] io_buffers_view View to an array of IOBuffers holding the concatenated payload of all datagrams. Must
+   *                            consist of kMaxIOBufferArraySize or fewer entries.
+   * \param[in] segment_size    Size of every datagram except the last one. Must be greater than 0.
+   * \param[in] destination     The destination endpoint. Same restrictions as for SendToSync().
+   *
+   * \return The result of the service.
+   *
+   * \error  osabstraction::OsabErrc::kUnexpected                Unexpected error that is mapped to no category. Also
+   *                                                             returned if the kernel does not support UDP GSO.
+   * \error  osabstraction::OsabErrc::kResource                  Not enough system resources to send datagrams.
+   * \error  osabstraction::OsabErrc::kBusy                      Operation would block. Try again later.
+   * \error  osabstraction::OsabErrc::kInsufficientPrivileges    Not allowed to send datagrams.
+   * \error  osabstraction::OsabErrc::kSystemEnvironmentError    The payload exceeds kMaxUdpOffloadSize or would be
+   *                                                             split into more than kMaxUdpGsoSegments datagrams.
+   * \error  osabstraction::OsabErrc::kDisconnected              No route to destination exists.
+   * \error  osabstraction::OsabErrc::kApiError                  The socket is not open or is connected (associated),
+   *                                                             the destination does not match the socket or the
+   *                                                             segment size is 0.
+   *
+   * \context         ANY
+   *
+   * \pre             -
+   *
+   * \reentrant       FALSE
+   * \synchronous     TRUE
+   * \threadsafe      FALSE
+   * \steady          TRUE
+   *
+   * \vprivate        Vector product internal API
+   */
+  auto SendToSyncSegmented(::amsr::core::Span<osabstraction::io::ConstIOBuffer const> io_buffers_view,
+                           std::uint16_t segment_size, EndpointType const& destination) noexcept
+      -> ::amsr::core::Result<void>;
+
   /*!
    * \brief Sends a datagram to the specified destination in the background.
    *
@@ -1733,6 +1820,45 @@ class BasicDatagramSocket final : public BasicSocket<Protocol, BasicDatagramSock
       ::amsr::core::Span<std::pair<::amsr::core::Span<std::uint8_t>, DatagramInfo>> buffers_view) noexcept
       -> ::amsr::core::Result<std::size_t>;
 
+  /*!
+   * \brief Receives a buffer that may contain multiple datagrams coalesced by UDP GRO.
+   *
+   * \details
+   * Works like ReceiveFromSync(). If UDP GRO is enabled (SockOptUdpGro) the kernel may deliver consecutive datagrams
+   * of the same sender and size in one buffer, segment_size in the returned info tells where to split it. Without UDP
+   * GRO support every call delivers exactly one datagram and segment_size equals datagram_size.
+   *
+   * \param[in, out] buffer_view   View to an array of bytes. Should provide kMaxUdpOffloadSize bytes if UDP GRO is
+   *                               enabled, otherwise coalesced datagrams are truncated. Must at most consist of
+   *                               kMaxIOBufferSize bytes.
+   *
+   * \return Information about the received buffer.
+   *
+   * \error  osabstraction::OsabErrc::kUnexpected                 Unexpected error that is mapped to no category.
+   * \error  osabstraction::OsabErrc::kResource                   Not enough system resources to receive datagram.
+   * \error  osabstraction::OsabErrc::kBusy                       Operation would block. Try again later.
+   * \error  osabstraction::OsabErrc::kInsufficientPrivileges     Not allowed to receive datagram.
+   * \error  osabstraction::OsabErrc::kDisconnected               Asynchronous network error that has been caused by a
+   *                                                              previous datagram.
+   * \error  osabstraction::OsabErrc::kApiError                   The socket is not open or there is an ongoing
+   *                                                              asynchronous receive operation.
+   * \error  osabstraction::OsabErrc::kTruncation                 Provided buffer did not have enough space to store the
+   *                                                              received data.
+   *
+   * \context         ANY
+   *
+   * \pre             -
+   *
+   * \reentrant       FALSE
+   * \synchronous     TRUE
+   * \threadsafe      FALSE
+   * \steady          TRUE
+   *
+   * \vprivate        Vector product internal API
+   */
+  auto ReceiveFromSyncCoalesced(::amsr::core::Span<std::uint8_t> buffer_view) noexcept
+      -> ::amsr::core::Result<CoalescedDatagramInfo>;
+
   /*!
    * \brief Receives a datagram.
    *
@@ -2402,6 +2528,29 @@ class BasicDatagramSocket final : public BasicSocket<Protocol, BasicDatagramSock
    */
   auto CheckSocketStateMatchesDestination(EndpointType const& destination) const noexcept -> ::amsr::core::Result<void>;
 
+  /*!
+   * \brief           Check whether a payload can be sent with one UDP GSO send call.
+   *
+   * \param[in]       io_buffers_view View to the payload buffers.
+   * \param[in]       segment_size    Size of every datagram except the last one.
+   *
+   * \error osabstraction::OsabErrc::kApiError                   The segment size is 0.
+   * \error osabstraction::OsabErrc::kSystemEnvironmentError     The payload exceeds kMaxUdpOffloadSize or would be split
+   *                                                             into more than kMaxUdpGsoSegments datagrams.
+   *
+   * \context         ANY
+   *
+   * \pre             -
+   *
+   * \reentrant       TRUE
+   * \synchronous     TRUE
+   * \threadsafe      TRUE
+   *
+   * \vprivate        Vector component internal API
+   */
+  static auto CheckSegmentedPayloadSize(::amsr::core::Span<osabstraction::io::ConstIOBuffer const> io_buffers_view,
+                                        std::uint16_t segment_size) noexcept -> ::amsr::core::Result<void>;
+
   /*!
    * \brief Stores the connection state.
    */
@@ -4646,6 +4795,142 @@ auto BasicDatagramSocket<Protocol>::CheckSocketStateMatchesDestination(EndpointT
              : ::amsr::core::Result<void>{};
 }
 
+/*!
+ * \internal
+ * - Sum up the payload size.
+ * - Reject a segment size of 0.
+ * - Reject a payload that exceeds the UDP offload size or needs more than the maximum number of GSO segments.
+ * \endinternal
+ */
+template <class Protocol>
+auto BasicDatagramSocket<Protocol>::CheckSegmentedPayloadSize(
+    ::amsr::core::Span<osabstraction::io::ConstIOBuffer const> io_buffers_view, std::uint16_t segment_size) noexcept
+    -> ::amsr::core::Result<void> {
+  std::size_t payload_size{0U};
+  for (osabstraction::io::ConstIOBuffer const& io_buffer : io_buffers_view) {
+    payload_size += io_buffer.size;
+  }
+
+  ::amsr::core::Result<void> result{};
+  if (segment_size == 0U) {
+    result.EmplaceError(MakeErrorCode(osabstraction::OsabErrc::kApiError, "UDP GSO segment size must not be 0."));
+  } else if (payload_size > kMaxUdpOffloadSize) {
+    result.EmplaceError(
+        MakeErrorCode(osabstraction::OsabErrc::kSystemEnvironmentError, "Payload exceeds the UDP offload size."));
+  } else if (((payload_size + segment_size) - 1U) / segment_size > kMaxUdpGsoSegments) {
+    result.EmplaceError(MakeErrorCode(osabstraction::OsabErrc::kSystemEnvironmentError,
+                                      "Payload needs more than the maximum number of UDP GSO segments."));
+  } else {
+    // Payload can be sent with one UDP GSO send call.
+  }
+  return result;
+}
+
+/*!
+ * \internal
+ * - Enter critical section.
+ * - Verify the preconditions.
+ * - Check if the state of the connection allows sending to a non-default destination and the input is valid for that.
+ * - Leave critical section.
+ * - If sending is possible
+ *   - Check the segment size, the number of segments and the payload size.
+ * - If the payload can be sent
+ *   - Alter destination endpoint if needed.
+ *   - Send the payload with one UDP GSO send call.
+ * - Output the result of sending.
+ * \endinternal
+ */
+template <class Protocol>
+auto BasicDatagramSocket<Protocol>::SendToSyncSegmented(
+    ::amsr::core::Span<osabstraction::io::ConstIOBuffer const> io_buffers_view, std::uint16_t segment_size,
+    EndpointType const& destination) noexcept -> ::amsr::core::Result<void> {
+  this->AcquireLock();
+
+  this->AssertProperIOBufferArraySize(io_buffers_view.size());
+
+  ::amsr::core::Result<void> send_result{
+      this->CheckSendIsPossible()
+          .AndThen([this]() -> ::amsr::core::Result<void> { return this->CheckIsNotConnected(); })
+          .AndThen([this, &destination]() -> ::amsr::core::Result<void> {
+            return this->CheckEndpointProtocolMatches(destination);
+          })
+          .AndThen([this, &destination]() -> ::amsr::core::Result<void> {
+            return this->CheckSocketUsesNetworkStack(destination.GetNetworkStackId());
+          })
+          .AndThen([this, &destination]() -> ::amsr::core::Result<void> {
+            return this->CheckSocketStateMatchesDestination(destination);
+          })};
+
+  this->ReleaseLock();
+
+  if (send_result.HasValue()) {
+    send_result = CheckSegmentedPayloadSize(io_buffers_view, segment_size);
+  }
+
+  if (send_result.HasValue()) {
+    EndpointType const dest_endpoint{this->AlterDestinationEndpoint(destination)};
+    send_result = os_interface::SendToWithSegmentSize(this->GetNativeHandle(), io_buffers_view,
+                                                      dest_endpoint.GetData(), segment_size);
+  }
+
+  return send_result;
+}
+
+/*!
+ * \internal
+ * - Enter critical section.
+ * - Verify the preconditions.
+ * - Check if the object state allows receive.
+ * - Leave critical section.
+ * - If the object state allows receive
+ *   - Receive one buffer and request the UDP_GRO control message.
+ *   - Output the total size and the segment size reported by the kernel, or the total size if the kernel did not
+ *     coalesce datagrams.
+ * - Otherwise output the respective error.
+ * \endinternal
+ */
+template <class Protocol>
+auto BasicDatagramSocket<Protocol>::ReceiveFromSyncCoalesced(::amsr::core::Span<std::uint8_t> buffer_view) noexcept
+    -> ::amsr::core::Result<CoalescedDatagramInfo> {
+  this->AcquireLock();
+
+  this->AssertProperIOBufferSize(buffer_view.size());
+
+  ::amsr::core::Result<void> const receive_is_possible_result{this->CheckReceiveIsPossible()};
+
+  this->ReleaseLock();
+
+  ::amsr::core::Result<CoalescedDatagramInfo> result{osabstraction::OsabErrc::kUnexpected};  // dummy error
+  if (receive_is_possible_result.HasValue()) {
+    ::amsr::core::Array<osabstraction::io::MutableIOBuffer, 1> incoming_io_vector{
+        {osabstraction::io::ConvertSpanToMutableIOBuffer(buffer_view)}};
+    CoalescedDatagramInfo info{EndpointType{this->GetProtocolUnsafe(), this->GetNetworkStackId()}, 0, 0};
+
+    // VECTOR NL AutosarC++17_10-A3.9.1: MD_OSA_A3.9.1_PosixApi
+    int gro_segment_size{0};
+    std::size_t gro_used_bytes{0};
+    ::amsr::core::Array<AncillaryDataRequest, 1> ancillary_requests{
+        {AncillaryDataRequest{SockOptLevel{IPPROTO_UDP}, ControlMessageType{kUdpGro},
+                              AncillaryDataView{&gro_segment_size, sizeof(gro_segment_size)}, &gro_used_bytes}}};
+
+    ::amsr::core::Result<std::size_t> const receive_result{
+        os_interface::ReceiveFrom(this->GetNativeHandle(), incoming_io_vector, info.remote_endpoint.GetData(),
+                                  ancillary_requests)};
+    if (receive_result.HasValue()) {
+      info.datagram_size = receive_result.Value();
+      info.segment_size = ((gro_used_bytes == sizeof(gro_segment_size)) && (gro_segment_size > 0))
+                              ? static_cast<std::size_t>(gro_segment_size)
+                              : info.datagram_size;
+      result.EmplaceValue(info);
+    } else {
+      result.EmplaceError(receive_result.Error());
+    }
+  } else {
+    result.EmplaceError(receive_is_possible_result.Error());
+  }
+  return result;
+}
+
 /*!
  * \exclusivearea ::amsr::net::internal::BasicSocket::lock_::mutex_
  * Ensures atomicity when jointly accessing object state and reactor event settings for data transfer operations.
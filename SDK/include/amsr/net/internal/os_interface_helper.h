@@ -25,8 +25,21 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <netinet/in.h>
 #include <sys/socket.h>
 
+#include <cstdint>
+#include <cstring>
+#include "amsr/core/array.h"
+#include "amsr/core/result.h"
+#include "amsr/core/span.h"
+#include "amsr/net/internal/os_interface_errors.h"
+#include "amsr/net/internal/os_specific_constants.h"
+#include "amsr/net/internal/types.h"
+#include "osabstraction/internal/errors.h"
+#include "osabstraction/io/io_buffer.h"
+#include "osabstraction/io/native_types.h"
+
 namespace amsr {
 namespace net {
 namespace internal {
@@ -154,6 +167,73 @@ inline void* GetCMSGData(cmsghdr* const cmsg_header) noexcept {
   // VECTOR Enable AutosarC++17_10-M5.0.21: MD_OSA_M5.0.21_os_structure_msghdr_cmsghdr
   return cmsg_data;
 }
+
+/*!
+ * \brief           Sends a payload that the kernel splits into datagrams of equal size (UDP GSO).
+ *
+ * \details
+ * The payload is sent with one sendmsg() call carrying an UDP_SEGMENT control message.
+ *
+ * \param[in]       handle            Valid native handle.
+ * \param[in]       io_buffers_view   View to the payload buffers. Must consist of kMaxIOBufferArraySize or fewer
+ *                                    entries.
+ * \param[in]       destination       View to a valid address.
+ * \param[in]       segment_size      Size of every datagram except the last one.
+ *
+ * \return          Result of operation.
+ *
+ * \error           osabstraction::OsabErrc::kUnexpected              Unexpected error that is mapped to no category.
+ * \error           osabstraction::OsabErrc::kResource                Not enough system resources to send datagrams.
+ * \error           osabstraction::OsabErrc::kBusy                    Operation would block. Try again later.
+ * \error           osabstraction::OsabErrc::kInsufficientPrivileges  Not allowed to send datagrams.
+ * \error           osabstraction::OsabErrc::kSystemEnvironmentError  The payload exceeds the maximum allowed size.
+ * \error           osabstraction::OsabErrc::kDisconnected            No route to destination exists.
+ *
+ * \context         ANY
+ *
+ * \pre             handle identifies an open datagram socket.
+ *
+ * \reentrant       FALSE
+ * \synchronous     TRUE
+ * \threadsafe      FALSE
+ *
+ * \vprivate        Vector component internal API
+ */
+inline ::amsr::core::Result<void> SendToWithSegmentSize(
+    osabstraction::io::NativeHandle handle, ::amsr::core::Span<osabstraction::io::ConstIOBuffer const> io_buffers_view,
+    SocketConstAddrView destination, std::uint16_t segment_size) noexcept {
+  ::amsr::core::Result<void> result{};
+
+  ::amsr::core::Array<struct iovec, osabstraction::io::kMaxIOBufferArraySize> io_vector{};
+  for (std::size_t i{0}; i < io_buffers_view.size(); ++i) {
+    // VECTOR NL AutosarC++17_10-A5.2.3: MD_VAC_A5.2.3_CastRemovesConstQualification
+    io_vector[i].iov_base = const_cast<void*>(io_buffers_view[i].base_pointer);
+    io_vector[i].iov_len = io_buffers_view[i].size;
+  }
+
+  // VECTOR NL AutosarC++17_10-A18.1.1: MD_VAC_A18.1.1_cStyleArraysShouldNotBeUsed
+  alignas(struct cmsghdr) std::uint8_t control_buffer[CMSG_SPACE(sizeof(std::uint16_t))]{};
+  struct msghdr message {};
+  // VECTOR NL AutosarC++17_10-A5.2.3: MD_VAC_A5.2.3_CastRemovesConstQualification
+  message.msg_name = const_cast<struct sockaddr*>(destination.pointer);
+  message.msg_namelen = destination.size;
+  message.msg_iov = io_vector.data();
+  message.msg_iovlen = io_buffers_view.size();
+  message.msg_control = &control_buffer[0];
+  message.msg_controllen = sizeof(control_buffer);
+
+  struct cmsghdr* const control_message{GetFirstCMSGHeader(&message)};
+  control_message->cmsg_level = IPPROTO_UDP;
+  control_message->cmsg_type = kUdpSegment;
+  // VECTOR NL AutosarC++17_10-M5.0.3: MD_OSA_M5.0.3_os_structure_msghdr_cmsghdr
+  control_message->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+  static_cast<void>(std::memcpy(GetCMSGData(control_message), &segment_size, sizeof(segment_size)));
+
+  if (::sendmsg(handle, &message, 0) < 0) {
+    result.EmplaceError(MapSendmsgDatagramSocketError(osabstraction::internal::GetErrorNumber()));
+  }
+  return result;
+}
 }  // namespace os_interface
 }  // namespace internal
 }  // namespace net
@@ -31,6 +31,7 @@
 #include <netinet/ether.h>  // ether_aton()
 #include <netinet/in.h>
 #include <netinet/tcp.h>  // TCP_NODELAY socket option
+#include <netinet/udp.h>  // UDP_SEGMENT, UDP_GRO socket options
 #include <sys/socket.h>
 
 #include <climits>  // IOV_MAX
@@ -122,6 +123,26 @@ static constexpr std::int32_t const kTCPKeepIdle{TCP_KEEPIDLE};
  */
 static constexpr std::int32_t const kTCPKeepInterval{TCP_KEEPINTVL};
 
+/*!
+ * \brief           UDP generic segmentation offload (GSO) socket option and control message type.
+ */
+static constexpr std::int32_t const kUdpSegment{UDP_SEGMENT};
+
+/*!
+ * \brief           UDP generic receive offload (GRO) socket option and control message type.
+ */
+static constexpr std::int32_t const kUdpGro{UDP_GRO};
+
+/*!
+ * \brief           Maximum number of segments the kernel accepts for one UDP GSO send call.
+ */
+static constexpr std::uint32_t const kMaxUdpGsoSegments{64};
+
+/*!
+ * \brief           Maximum size of a UDP GSO send or a UDP GRO coalesced receive (maximum IP payload).
+ */
+static constexpr std::uint32_t const kMaxUdpOffloadSize{65507};
+
 // VECTOR Next Line AutosarC++17_10-A16.0.1: MD_OSA_A16.0.1_recvmmsg_configuration
 #ifndef AMSR_RECVMMSG_MAXIMUM
 /*!
@@ -179,8 +179,8 @@ class ReferenceCounter {
       }
       // VCA_VAC_STD_FUNC_FULFILL_CONTRACT
     } while (!std::atomic_compare_exchange_strong_explicit<std::int32_t>(  // COV_LIBVAC_RARE_MULTITHREAD_CASE
-        &use_count_, &count, count + 1, std::memory_order::memory_order_acq_rel,
-        std::memory_order::memory_order_relaxed));
+        &use_count_, &count, count + 1, std::memory_order_acq_rel,
+        std::memory_order_relaxed));
   }
 
   /*!
@@ -192,7 +192,7 @@ class ReferenceCounter {
    * \spec            requires true; \endspec
    */
   auto GetUseCount() const noexcept -> std::int32_t {
-    return std::atomic_load_explicit(&use_count_, std::memory_order::memory_order_relaxed);
+    return std::atomic_load_explicit(&use_count_, std::memory_order_relaxed);
   }
 
  private:
@@ -22,11 +22,13 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
 #include <memory>
 #include <utility>
 
 #include "amsr/core/optional.h"
 #include "amsr/core/result.h"
+#include "amsr/core/span.h"
 #include "amsr/socal/internal/events/cache_interface.h"
 #include "amsr/socal/internal/events/event_subscriber_interface.h"
 #include "amsr/socal/internal/events/memory_wrapper_interface.h"
@@ -215,6 +217,43 @@ class ProxyEventBackendInterface {
   virtual ReadSamplesResult ReadSamples(std::size_t const max_samples,
                                         CallableReadSamplesResult const& callable_sample_result) noexcept = 0;
 
+  /*!
+   * \brief   Reads the serialized samples from underlying receive buffers into a caller provided buffer.
+   * \details Same semantics as ReadSamples(), but the samples are stored into consecutive elements of the given buffer
+   *          instead of being passed to a callable one by one. Bindings may override this API to fill the buffer
+   *          without the per-sample callable invocation, the default implementation is based on ReadSamples().
+   * \param[in]  max_samples  Maximum number of samples that can be processed within this call.
+   * \param[out] samples      Buffer the samples are stored into, starting at the first element. At most
+   *                          min(max_samples, samples.size()) samples are read.
+   * \return Result containing the number of samples that have been stored into the buffer.
+   * \error ara::com::ComErrc::kMaxSamplesReached  If all slots from the binding are used at the beginning of the call.
+   * \pre         Event must be subscribed.
+   * \context     App
+   * \threadsafe  FALSE for same class instance, TRUE for different instances.
+   *              TRUE against GetE2EResult and GetFreeSampleCount when invoked on same/different class instances.
+   * \reentrant   FALSE for same class instance, TRUE for different instances.
+   * \synchronous TRUE
+   * \steady TRUE
+   * \internal
+   * - Call ReadSamples() with the number of samples fitting into the buffer and move every sample into the next
+   *   buffer element.
+   * \endinternal
+   */
+  virtual ReadSamplesResult ReadSamplesBatch(std::size_t const max_samples,
+                                             ::amsr::core::Span<SampleData> samples) noexcept {
+    std::size_t const batch_size{(max_samples < samples.size()) ? max_samples : samples.size()};
+    std::size_t stored_samples{0U};
+    ReadSamplesResult result{ReadSamplesResult::FromValue(0U)};
+    if (batch_size > 0U) {
+      result = ReadSamples(batch_size, [&samples, &stored_samples](SampleData&& sample_data) {
+        // VCA_SOCAL_CALLING_STL_APIS
+        samples[stored_samples] = std::move(sample_data);
+        ++stored_samples;
+      });
+    }
+    return result;
+  }
+
   /*!
    * \brief Gets the E2E result of the recent E2E check.
    * \return The E2E result of the recent E2E check.
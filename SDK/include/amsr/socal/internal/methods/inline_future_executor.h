@@ -0,0 +1,106 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  inline_future_executor.h
+ *        \brief  Class used for inline execution of callbacks from ara::core::Future::then in event-driven mode.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_SOCAL_INCLUDE_AMSR_SOCAL_INTERNAL_METHODS_INLINE_FUTURE_EXECUTOR_H_
+#define LIB_SOCAL_INCLUDE_AMSR_SOCAL_INTERNAL_METHODS_INLINE_FUTURE_EXECUTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+
+#include "ara/core/future.h"
+#include "vac/language/unique_function.h"
+
+namespace amsr {
+namespace socal {
+namespace internal {
+namespace methods {
+
+/*!
+ * \brief   Class implementing the ExecutorInterface for event-driven mode, to execute the callbacks registered using
+ *          ara::core::Future::then() API inline.
+ * \details The callbacks are executed directly in the context which completes the Promise (usually the reactor thread
+ *          of the binding), or in the context of Future::then() if the Future is already ready. Compared to the
+ *          EventModeFutureExecutor this saves the hand-over to the continuation thread-pool. Only suitable for
+ *          lightweight callbacks which neither block nor wait for another Future.
+ *
+ * \unit Socal::Proxy::ProxyMethod::FutureExecutor::InlineFutureExecutor
+ */
+class InlineFutureExecutor final : public ::ara::core::internal::ExecutorInterface {
+ public:
+  /*!
+   * \brief Type alias for the work item submitted to this executor.
+   */
+  using WorkItemType = ::vac::language::UniqueFunction<void()>;
+
+  /*!
+   * \brief Default constructor.
+   * \steady FALSE
+   */
+  InlineFutureExecutor() noexcept = default;
+
+  /*!
+   * \brief Delete copy constructor.
+   */
+  InlineFutureExecutor(InlineFutureExecutor const&) noexcept = delete;
+
+  /*!
+   * \brief Delete move constructor.
+   */
+  InlineFutureExecutor(InlineFutureExecutor&&) noexcept = delete;
+
+  /*!
+   * \brief Delete copy assignment.
+   */
+  InlineFutureExecutor& operator=(InlineFutureExecutor const&) & noexcept = delete;
+
+  /*!
+   * \brief Delete move assignment.
+   */
+  InlineFutureExecutor& operator=(InlineFutureExecutor&&) & noexcept = delete;
+
+  /*!
+   * \brief Default destructor.
+   * \steady FALSE
+   */
+  // VCA_SOCAL_FREEING_STATICALLY_ALLOCATED_MEMORY
+  ~InlineFutureExecutor() noexcept final = default;
+
+  /*!
+   * \brief Execute the submitted work item immediately in the calling context.
+   * \param work_item  The callback function which shall be executed.
+   * \pre         -
+   * \context     Reactor | App | Callback.
+   * \threadsafe  TRUE for same class instance, TRUE for different instances.
+   * \reentrant   TRUE for same class instance, TRUE for different instances.
+   * \synchronous TRUE
+   * \steady TRUE
+   */
+  void SubmitWork(WorkItemType&& work_item) noexcept final {
+    if (work_item) {
+      work_item();  // VCA_SOCAL_CALLING_STL_APIS
+    }
+  }
+};
+
+}  // namespace methods
+}  // namespace internal
+}  // namespace socal
+}  // namespace amsr
+
+#endif  // LIB_SOCAL_INCLUDE_AMSR_SOCAL_INTERNAL_METHODS_INLINE_FUTURE_EXECUTOR_H_
@@ -24,6 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -31,6 +32,7 @@
 #include "amsr/core/future.h"
 #include "amsr/core/promise.h"  // necessary for Future::SetExecutionContext
 #include "amsr/socal/internal/logging/ara_com_logger.h"
+#include "amsr/socal/internal/methods/inline_future_executor.h"
 #include "amsr/socal/internal/methods/proxy_fire_and_forget_method_backend_interface.h"
 #include "amsr/socal/internal/methods/proxy_method_backend_interface.h"
 #include "vac/container/string_literals.h"
@@ -42,6 +44,28 @@ namespace methods {
 // VECTOR NC AutosarC++17_10-M7.3.6: MD_SOCAL_AutosarC++17_10-M7.3.6_usingDirectiveInHeaderFile
 using vac::container::literals::operator""_sv;  // NOLINT(build/namespaces)
 
+/*!
+ * \brief Execution policy for the callbacks registered using ara::core::Future::then() on the futures returned by a
+ *        proxy method.
+ * \vpublic
+ */
+enum class ContinuationExecutionPolicy : std::uint8_t {
+  /*!
+   * \brief   Execute callbacks by the future executor of the proxy.
+   * \details In event-driven mode the callbacks are executed by worker thread(s) of the continuation thread-pool.
+   *          This is the default policy.
+   */
+  kProxyExecutor,
+
+  /*!
+   * \brief   Execute callbacks inline in the context which completes the method response.
+   * \details The callbacks are executed without a thread hop, usually on the reactor thread of the binding. Callbacks
+   *          must be lightweight, must not block and must not wait for another Future. Only allowed in event-driven
+   *          runtime processing mode.
+   */
+  kInline
+};
+
 /*!
  * \brief Parameter list of a method.
  * \tparam ArgsT  The parameters of this method call.
@@ -153,7 +177,7 @@ struct MethodParameters {
      * \spec requires true; \endspec
      * \internal
      * - Forward the method request to the backend.
-     * - Set the future executor context on the returned future.
+     * - Set the future executor context of the selected continuation execution policy on the returned future.
      * - If the executor context was not set:
      *   - Log a fatal error message and trigger an abort.
      * - Return the future to the caller.
@@ -166,7 +190,7 @@ struct MethodParameters {
       // VCA_SOCAL_PROXY_METHOD_BACKEND_REF, VCA_SOCAL_PROXY_METHOD_BACKEND_REF_HANDLEREQUEST_ARGUMENTS
       Return future{proxy_method_backend_.HandleRequest(std::forward<ArgsT const&>(args)...)};
       bool const execution_context_set{
-          future.SetExecutionContext(future_executor_)};  // VCA_SOCAL_EXTERNAL_FUNCTION_CONTRACT
+          future.SetExecutionContext(active_future_executor_)};  // VCA_SOCAL_EXTERNAL_FUNCTION_CONTRACT
       if (!execution_context_set) {
         logger_.LogFatalAndAbort(
             [](::amsr::socal::internal::logging::AraComLogger::StringStream& s) {
@@ -179,6 +203,39 @@ struct MethodParameters {
       // PTP-E-Socal-ProxyMethod_ProxyMethod_WithArgs
     }
 
+    /*!
+     * \brief   Select the execution policy for callbacks registered using Future::then() on the futures returned by
+     *          subsequent calls of this method.
+     * \details By default the callbacks are executed by the future executor of the proxy. With
+     *          ContinuationExecutionPolicy::kInline lightweight callbacks are executed directly in the context which
+     *          completes the method response, which avoids the hand-over to the continuation thread-pool.
+     * \param[in] policy  The continuation execution policy.
+     * \pre         Event-driven runtime processing mode if policy is ContinuationExecutionPolicy::kInline.
+     * \context     App
+     * \threadsafe  FALSE for same class instance, TRUE for different instances. Must not be called concurrently to a
+     *              method call on the same instance.
+     * \reentrant   FALSE for same class instance, TRUE for different instances.
+     * \synchronous TRUE
+     * \vpublic
+     * \steady FALSE
+     * \spec requires true; \endspec
+     * \internal
+     * - If inline execution is requested:
+     *   - Use the inline future executor for subsequent method calls.
+     * - Otherwise use the future executor of the proxy for subsequent method calls.
+     * \endinternal
+     */
+    void SetContinuationExecutionPolicy(ContinuationExecutionPolicy const policy) noexcept {
+      if (policy == ContinuationExecutionPolicy::kInline) {
+        if (!inline_future_executor_) {
+          inline_future_executor_ = std::make_shared<::amsr::socal::internal::methods::InlineFutureExecutor>();
+        }
+        active_future_executor_ = inline_future_executor_;
+      } else {
+        active_future_executor_ = future_executor_;
+      }
+    }
+
    private:
     /*!
      * \brief The the proxy communication partner towards the binding.
@@ -186,10 +243,20 @@ struct MethodParameters {
     ::amsr::socal::internal::methods::ProxyMethodBackendInterface<Output, ArgsT...>& proxy_method_backend_;
 
     /*!
-     * \brief The future executor used for callback execution on Future::then() requests.
+     * \brief The future executor of the proxy used for callback execution on Future::then() requests.
      */
     ExecutorInterfacePtr future_executor_;
 
+    /*!
+     * \brief The inline future executor, created on first selection of ContinuationExecutionPolicy::kInline.
+     */
+    ExecutorInterfacePtr inline_future_executor_{nullptr};
+
+    /*!
+     * \brief The future executor set on the futures returned by this method, according to the selected policy.
+     */
+    ExecutorInterfacePtr active_future_executor_{future_executor_};
+
     /*!
      * \brief An instance of a logger.
      */
@@ -304,7 +371,7 @@ struct MethodParameters<void> {
      * \spec requires true; \endspec
      * \internal
      * - Forward the method request to the backend.
-     * - Set the future executor context on the returned future.
+     * - Set the future executor context of the selected continuation execution policy on the returned future.
      * - If the executor context was not set:
      *   - Log a fatal error message and trigger an abort.
      * - Return the future to the caller.
@@ -314,7 +381,7 @@ struct MethodParameters<void> {
       // PTP-B-Socal-ProxyMethod_ProxyMethod_ArgLess
       Return future{proxy_method_backend_.HandleRequest()};  // VCA_SOCAL_PROXY_METHOD_BACKEND_REF
       bool const execution_context_set{
-          future.SetExecutionContext(future_executor_)};  // VCA_SOCAL_EXTERNAL_FUNCTION_CONTRACT
+          future.SetExecutionContext(active_future_executor_)};  // VCA_SOCAL_EXTERNAL_FUNCTION_CONTRACT
       if (!execution_context_set) {
         logger_.LogFatalAndAbort(
             [](::amsr::socal::internal::logging::AraComLogger::StringStream& s) {
@@ -327,6 +394,39 @@ struct MethodParameters<void> {
       // PTP-E-Socal-ProxyMethod_ProxyMethod_ArgLess
     }
 
+    /*!
+     * \brief   Select the execution policy for callbacks registered using Future::then() on the futures returned by
+     *          subsequent calls of this method.
+     * \details By default the callbacks are executed by the future executor of the proxy. With
+     *          ContinuationExecutionPolicy::kInline lightweight callbacks are executed directly in the context which
+     *          completes the method response, which avoids the hand-over to the continuation thread-pool.
+     * \param[in] policy  The continuation execution policy.
+     * \pre         Event-driven runtime processing mode if policy is ContinuationExecutionPolicy::kInline.
+     * \context     App
+     * \threadsafe  FALSE for same class instance, TRUE for different instances. Must not be called concurrently to a
+     *              method call on the same instance.
+     * \reentrant   FALSE for same class instance, TRUE for different instances.
+     * \synchronous TRUE
+     * \vpublic
+     * \steady FALSE
+     * \spec requires true; \endspec
+     * \internal
+     * - If inline execution is requested:
+     *   - Use the inline future executor for subsequent method calls.
+     * - Otherwise use the future executor of the proxy for subsequent method calls.
+     * \endinternal
+     */
+    void SetContinuationExecutionPolicy(ContinuationExecutionPolicy const policy) noexcept {
+      if (policy == ContinuationExecutionPolicy::kInline) {
+        if (!inline_future_executor_) {
+          inline_future_executor_ = std::make_shared<::amsr::socal::internal::methods::InlineFutureExecutor>();
+        }
+        active_future_executor_ = inline_future_executor_;
+      } else {
+        active_future_executor_ = future_executor_;
+      }
+    }
+
    private:
     /*!
      * \brief The communication partner towards the binding.
@@ -334,10 +434,20 @@ struct MethodParameters<void> {
     ::amsr::socal::internal::methods::ProxyMethodBackendInterface<Output>& proxy_method_backend_;
 
     /*!
-     * \brief The future executor used for callback execution on Future::then() requests.
+     * \brief The future executor of the proxy used for callback execution on Future::then() requests.
      */
     ExecutorInterfacePtr future_executor_;
 
+    /*!
+     * \brief The inline future executor, created on first selection of ContinuationExecutionPolicy::kInline.
+     */
+    ExecutorInterfacePtr inline_future_executor_{nullptr};
+
+    /*!
+     * \brief The future executor set on the futures returned by this method, according to the selected policy.
+     */
+    ExecutorInterfacePtr active_future_executor_{future_executor_};
+
     /*!
      * \brief An instance of a logger.
      */
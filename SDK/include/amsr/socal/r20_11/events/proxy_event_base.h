@@ -26,6 +26,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <limits>
@@ -34,6 +35,7 @@
 #include <utility>
 
 #include "amsr/core/abort.h"
+#include "amsr/core/span.h"
 #include "amsr/core/string_view.h"
 #include "amsr/socal/internal/events/event_subscriber_interface.h"
 #include "amsr/socal/internal/events/proxy_event_backend_interface.h"
@@ -99,6 +101,26 @@ class ProxyEventBase : public ::amsr::socal::internal::events::EventSubscriberIn
    */
   using SampleData = typename ProxyEventBackend::SampleData;
 
+  /*!
+   * \brief Type alias for the view on a batch of samples passed to the callable of GetNewSamplesBatch().
+   * \vpublic
+   */
+  using SampleBatchView = ::amsr::core::Span<SampleType const* const>;
+
+  /*!
+   * \brief   Type alias for the view on the E2E check status of a batch of samples passed to the callable of
+   *          GetNewSamplesBatch().
+   * \details Element i holds the E2E check status of sample i of the SampleBatchView.
+   * \vpublic
+   */
+  using E2ECheckStatusBatchView = ::amsr::core::Span<::ara::com::e2e::ProfileCheckStatus const>;
+
+  /*!
+   * \brief Default maximum number of samples passed to the callable of GetNewSamplesBatch() at once.
+   * \vpublic
+   */
+  static constexpr std::size_t kDefaultSampleBatchSize{16U};
+
   ProxyEventBase() = delete;
   ProxyEventBase(ProxyEventBase const&) = delete;
   ProxyEventBase(ProxyEventBase&&) = delete;
@@ -273,6 +295,92 @@ class ProxyEventBase : public ::amsr::socal::internal::events::EventSubscriberIn
     return result;
   }
 
+  /*!
+   * \brief   Reads the serialized samples from underlying receive buffers and hands them out in batches.
+   * \details In contrast to GetNewSamples() no SamplePtr is created per sample: the callable gets a contiguous view of
+   *          up to BatchSize sample pointers, and all samples of a batch are returned to the binding together once the
+   *          callable returns. The sample pointers are only valid within the callable. The callable also gets the
+   *          E2E check status of every sample, so E2E protected events can use the batch path. Use GetNewSamples() to
+   *          keep samples beyond the callable or to access their time stamp.
+   * \tparam    BatchSize    Maximum number of samples passed to the callable at once. Must not be zero.
+   * \tparam    F            User provided callable function with the signature
+   *                         void(SampleBatchView, E2ECheckStatusBatchView).
+   * \param[in] f            Callable to be invoked for every batch of deserialized samples.
+   * \param[in] max_samples  Maximum number of samples that can be processed within this call.
+   * \return Result containing the number of successfully processed events within this call or an error.
+   * \error ara::com::ComErrc::kMaxSamplesReached  If all slots from visible sample cache are used.
+   * \pre         Subscribe() has been called.
+   * \context     App
+   * \threadsafe  FALSE for same class instance, TRUE for different instances.
+   *              This API can be called from event receive handler when subscription / unsubscription is requested in
+   *              parallel from the application thread without the need of additional synchronization measures.
+   * \reentrant   FALSE for same class instance, TRUE for different instances.
+   * \synchronous TRUE
+   * \vpublic
+   * \steady TRUE
+   * \spec requires true; \endspec
+   * \internal
+   * - If the event is subscribed
+   *   - Repeat until max_samples are processed or the backend provides less samples than requested:
+   *     - Read up to BatchSize samples from the backend into the batch buffer.
+   *     - If reading fails and no sample has been processed yet, return the error.
+   *     - Collect the sample pointers and E2E check status and invoke the user provided callable f with views on them.
+   *     - Return all samples of the batch to their cache.
+   * - Otherwise
+   *   - Abort.
+   * \endinternal
+   */
+  template <std::size_t BatchSize = kDefaultSampleBatchSize, typename F>
+  auto GetNewSamplesBatch(F&& f, std::size_t max_samples = std::numeric_limits<size_t>::max()) noexcept
+      -> GetNewSamplesResult {
+    static_assert(BatchSize > 0U, "The batch size must not be zero.");
+    GetNewSamplesResult result{GetNewSamplesResult::FromValue(0UL)};
+    if (is_subscribed_.load()) {
+      std::array<SampleData, BatchSize> samples{};
+      std::array<SampleType const*, BatchSize> sample_pointers{};
+      std::array<::ara::com::e2e::ProfileCheckStatus, BatchSize> check_status{};
+      std::size_t processed_samples{0U};
+      bool more_samples{true};
+      while (more_samples && (processed_samples < max_samples)) {
+        std::size_t const remaining_samples{max_samples - processed_samples};
+        std::size_t const requested_samples{(remaining_samples < BatchSize) ? remaining_samples : BatchSize};
+        // VCA_SOCAL_FUNCTION_CALL_ON_VALID_OBJECTS_ADHERING_TO_FUNCTION_CONTRACT
+        GetNewSamplesResult const read_result{proxy_event_backend_.ReadSamplesBatch(
+            requested_samples, ::amsr::core::Span<SampleData>{samples.data(), requested_samples})};
+        if (!read_result.HasValue()) {
+          if (processed_samples == 0U) {
+            result = read_result;
+          }
+          more_samples = false;
+        } else {
+          std::size_t const read_samples{read_result.Value()};
+          for (std::size_t index{0U}; index < read_samples; ++index) {
+            // VCA_SOCAL_DEREFERENCING_POINTER_WITH_RUNTIME_CHECK
+            sample_pointers[index] = samples[index].memory_wrapper_if_ptr->operator->();
+            check_status[index] = samples[index].e2e_check_status;
+          }
+          if (read_samples > 0U) {
+            // VCA_SOCAL_CALLING_NON_STATIC_FUNCTION_FROM_CALLBACK_SYNCHRONOUSLY
+            f(SampleBatchView{sample_pointers.data(), read_samples},
+              E2ECheckStatusBatchView{check_status.data(), read_samples});
+            ReturnSamples(::amsr::core::Span<SampleData>{samples.data(), read_samples});
+          }
+          processed_samples += read_samples;
+          result.EmplaceValue(processed_samples);
+          more_samples = (read_samples == requested_samples);
+        }
+      }
+    } else {
+      logger_.LogFatalAndAbort(
+          [](::amsr::socal::internal::logging::AraComLogger::StringStream& s) {
+            // VCA_SOCAL_CALLING_STL_APIS
+            s << "API called before subscription or after unsubscription of the event.";
+          },
+          static_cast<char const*>(__func__), __LINE__);
+    }
+    return result;
+  }
+
   /*!
    * \brief Return the global SMState of this specific proxy event.
    * \return The SMState of the last E2E_Check from GetNewSamples.
@@ -407,6 +515,44 @@ class ProxyEventBase : public ::amsr::socal::internal::events::EventSubscriberIn
   ::amsr::socal::internal::logging::AraComLogger const logger_;
 
  private:
+  /*!
+   * \brief   Return a batch of samples to their caches.
+   * \details The cache of the first sample is locked once and used for all samples sharing it, samples of other caches
+   *          are returned one by one.
+   * \param[in,out] samples  The samples to return. The elements are reset afterwards.
+   * \pre         -
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \steady TRUE
+   * \spec requires true; \endspec
+   */
+  static void ReturnSamples(::amsr::core::Span<SampleData> samples) noexcept {
+    using CacheWeakPtr = decltype(SampleData::cache_ptr);
+    CacheWeakPtr const batch_cache_weak_ptr{samples[0U].cache_ptr};
+    // VCA_SOCAL_CALLING_STL_APIS
+    auto const batch_cache{batch_cache_weak_ptr.lock()};
+    for (SampleData& sample : samples) {
+      bool const same_cache{(!sample.cache_ptr.owner_before(batch_cache_weak_ptr)) &&
+                            (!batch_cache_weak_ptr.owner_before(sample.cache_ptr))};
+      if (same_cache) {
+        if (batch_cache) {
+          // VCA_SOCAL_DEREFERENCING_POINTER_WITH_RUNTIME_CHECK
+          batch_cache->ReturnEntry(std::move(sample.memory_wrapper_if_ptr));
+        }
+      } else {
+        // VCA_SOCAL_CALLING_STL_APIS
+        auto const sample_cache{sample.cache_ptr.lock()};
+        if (sample_cache) {
+          // VCA_SOCAL_DEREFERENCING_POINTER_WITH_RUNTIME_CHECK
+          sample_cache->ReturnEntry(std::move(sample.memory_wrapper_if_ptr));
+        }
+      }
+      sample = SampleData{};
+    }
+  }
+
   /*!
    * \brief Construct the SamplePtr from the deserialization result when the parameter of time stamp is disabled.
    * \tparam    Config             Configures if the time stamp is enabled or disabled.
@@ -15,18 +15,28 @@
  *        \brief  This file contains the EventMessageDispatcher which provides an API to send event messages to
  *                subscribers via TCP or UDP.
  *
+ *      \details  The receivers of every provided event are precomputed (eventgroup resolution, multicast threshold and
+ *                deduplication of receivers subscribed to several eventgroups) whenever the subscriptions change.
+ *                Dispatching an event only walks this fan-out list and does not allocate.
+ *
  *********************************************************************************************************************/
 #ifndef LIB_SOMEIP_DAEMON_CORE_INCLUDE_AMSR_SOMEIP_DAEMON_CORE_SERVER_EVENTGROUP_EVENT_MESSAGE_DISPATCHER_H_
 #define LIB_SOMEIP_DAEMON_CORE_INCLUDE_AMSR_SOMEIP_DAEMON_CORE_SERVER_EVENTGROUP_EVENT_MESSAGE_DISPATCHER_H_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <utility>
+#include "ara/core/array.h"
 #include "ara/core/vector.h"
 
 #include "amsr/generic/generic_error_domain.h"
 #include "amsr/someip_daemon_core/server/eventgroup/eventgroup_subscriber.h"
 #include "ara/core/memory_resource.h"
+#include "ara/core/optional.h"
 
 namespace amsr {
 namespace someip_daemon_core {
@@ -42,8 +52,9 @@ template <typename TcpSender, typename UdpSender>
 class EventMessageDispatcher final {
  private:
   /*!
-   * \brief Container of unique IP addresses to which an event has already been sent.
-   * \details std::set container is used to avoid sending duplicate events to the same destination.
+   * \brief Container of unique IP addresses to which an event is sent.
+   * \details std::set container is used to avoid sending duplicate events to the same destination. Only used when the
+   *          fan-out lists are rebuilt.
    */
   using SentToSet =
       std::set<configuration::Configuration::SocketAddress, std::less<configuration::Configuration::SocketAddress>,
@@ -75,10 +86,40 @@ class EventMessageDispatcher final {
       ara::core::Map<someip_protocol::internal::EventgroupId, configuration::types::ProvidedSomeIpEventgroup>;
 
   /*!
-   * \brief Default constructible.
+   * \brief Constructs the dispatcher and resolves the eventgroups of every provided event.
+   * \param[in] provided_eventgroup_map A provided eventgroup map. Must outlive this object.
+   * \context Init
    * \steady FALSE
+   *
+   * \internal
+   * - For every eventgroup and every event of the eventgroup:
+   *   - Add the eventgroup to the fan-out entry of the event, creating the entry if needed.
+   * - Sort the entries by event id.
+   * \endinternal
    */
-  EventMessageDispatcher() noexcept = default;
+  explicit EventMessageDispatcher(ProvidedEventgroupMap const& provided_eventgroup_map) noexcept {
+    for (typename ProvidedEventgroupMap::value_type const& eg : provided_eventgroup_map) {
+      for (configuration::types::ProvidedSomeIpEventMap::value_type const& event : eg.second.events) {
+        typename ara::core::Vector<EventFanOut>::iterator entry{
+            std::find_if(fan_out_.begin(), fan_out_.end(),
+                         [&event](EventFanOut const& candidate) { return candidate.event_id == event.first; })};
+        if (entry == fan_out_.end()) {
+          fan_out_.emplace_back();
+          fan_out_.back().event_id = event.first;
+          entry = std::prev(fan_out_.end());
+        }
+        EventgroupSlot slot{};
+        slot.eventgroup_id = eg.first;
+        if (eg.second.multicast_eventgroup_config.has_value()) {
+          slot.multicast_threshold.emplace(eg.second.multicast_eventgroup_config->multicast_threshold);
+        }
+        entry->eventgroups.emplace_back(slot);
+      }
+    }
+    std::sort(fan_out_.begin(), fan_out_.end(),
+              [](EventFanOut const& lhs, EventFanOut const& rhs) { return lhs.event_id < rhs.event_id; });
+  }
+
   /*!
    * \brief Default destructible.
    * \steady FALSE
@@ -90,11 +131,61 @@ class EventMessageDispatcher final {
   EventMessageDispatcher& operator=(EventMessageDispatcher const&) noexcept = delete;
   EventMessageDispatcher& operator=(EventMessageDispatcher&&) noexcept = delete;
 
+  /*!
+   * \brief Rebuilds the fan-out lists of all events from the current subscriptions.
+   * \details Must be called after every change of the subscriptions, as the fan-out lists hold raw pointers to the
+   *          senders owned by the subscriptions. Receiver lists are built both for an available and for a missing
+   *          multicast sender, so the multicast decision is taken on dispatch with the current multicast sender. The
+   *          list capacities are kept, so a rebuild only allocates when the number of receivers grows beyond any
+   *          previous number.
+   * \param[in] senders A reference to a map with the event subscribers.
+   *
+   * \context Network, App
+   * \reentrant FALSE
+   * \steady FALSE
+   *
+   * \internal
+   * - For each event:
+   *   - Clear the receiver lists.
+   *   - For each eventgroup of the event:
+   *     - Store the number of subscribers and whether the multicast threshold of the eventgroup is reached.
+   *     - Append every TCP and UDP sender not yet contained in the list of the protocol to the receiver lists used
+   *       without multicast sender, together with the eventgroup slot it was found in first.
+   *     - If the multicast threshold is not reached, do the same for the receiver lists used with multicast sender.
+   *   - Release the receiver addresses.
+   * \endinternal
+   */
+  void UpdateSubscriptions(SendersMap const& senders) noexcept {
+    for (EventFanOut& entry : fan_out_) {
+      UnicastReceivers& with_multicast{entry.unicast_receivers[kWithMulticastSender]};
+      UnicastReceivers& without_multicast{entry.unicast_receivers[kWithoutMulticastSender]};
+      with_multicast.Clear();
+      without_multicast.Clear();
+      for (std::size_t slot_index{0U}; slot_index < entry.eventgroups.size(); ++slot_index) {
+        EventgroupSlot& slot{entry.eventgroups[slot_index]};
+        typename SendersMap::const_iterator const subscribers{senders.find(slot.eventgroup_id)};
+        slot.subscriber_count = (subscribers == senders.cend()) ? 0U : subscribers->second.size();
+        slot.multicast_threshold_reached =
+            (slot.multicast_threshold.has_value()) &&
+            (slot.multicast_threshold.value() != configuration::Configuration::kEventMulticastThresholdUseOnlyUnicast) &&
+            (slot.multicast_threshold.value() <= slot.subscriber_count);
+        if (slot.subscriber_count != 0U) {
+          for (EventgroupSubscriberType const& subscriber : subscribers->second) {
+            without_multicast.Add(subscriber, slot_index);
+            if (!slot.multicast_threshold_reached) {
+              with_multicast.Add(subscriber, slot_index);
+            }
+          }
+        }
+      }
+      with_multicast.ReleaseSentTo();
+      without_multicast.ReleaseSentTo();
+    }
+  }
+
   /*!
    * \brief Dispatches a SOME/IP message via TCP to subscribers.
    * \param[in] message The SOME/IP message.
-   * \param[in] senders A reference to a map with the event subscribers.
-   * \param[in] provided_eventgroup_map A provided eventgroup map.
    * \param[in] event A reference to the current event.
    * \param[in] udp_mcast_sender The UDP multicast sender.
    *
@@ -102,81 +193,35 @@ class EventMessageDispatcher final {
    * \error amsr::generic::GenErrc::kRuntimeConnectionTransmissionFailed if the event couldn't be
    *        forwarded.
    *
+   * \pre UpdateSubscriptions() has been called after the last change of the subscriptions.
    * \context Network
    * \reentrant FALSE
    * \steady TRUE
    * \trace SPEC-4981715
    *
    * \internal
-   * - For each eventgroup to which the event belongs
-   *  - Get the multicast configuration for the event
-   *  - If the event exist within the senders.
-   *    - If the event must be sent using multicast (it has a multicast configuration, threshold is valid, threshold is
-   *      lesser than the number of eventgroup's senders and udp multicast sender is not nullptr):
-   *      - If Dispatch the event using the multicast sender returns success,
-   *        - Emplace the value to the result.
-   *    - Else: send the event using unicast
-   *      - If the event is configured to use TCP protocol:
-   *        - If Dispatch the event using the TCP subscription returns success,
-   *        - Emplace the value to the result.
-   *      - Else: the event uses udp protocol
-   *        - If Dispatch the event using the UDP subscription (unicast) returns success,
-   *        - Emplace the value to the result.
-   *  - Else: Emplace the value to the result, if no subscribers are found.
+   * - Look up the fan-out entry of the event.
+   * - For each eventgroup to which the event belongs, that is sent via multicast:
+   *   - If Dispatch the event using the multicast sender returns success, emplace the value to the result.
+   * - If the event is configured to use TCP protocol, forward the event to every TCP receiver.
+   * - Else forward the event to every UDP receiver.
+   * - Emplace the value to the result if an eventgroup without subscribers exists (valid usecase), or if all
+   *   forwards of the receivers first found in a unicast eventgroup succeeded.
    * \endinternal
    */
-  static ara::core::Result<void> DispatchSomeIpMessage(
-      std::shared_ptr<someip_protocol::internal::SomeIpMessage> message, SendersMap const& senders,
-      ProvidedEventgroupMap const& provided_eventgroup_map, configuration::types::SomeIpEventDeployment const& event,
-      UdpSenderImmutablePtr udp_mcast_sender) noexcept {
-    ara::core::Result<void> result{ara::core::ErrorCode{amsr::generic::GenErrc::kRuntimeConnectionTransmissionFailed}};
-    SentToSet sent_to_list{};
-
-    for (std::pair<someip_protocol::internal::EventgroupId,
-                   ara::core::Optional<configuration::types::MulticastEventgroupConfig>> const& eg_config :
-         EventToEventgroups(provided_eventgroup_map, event.event_id)) {
-      // Multicast threshold.
-      // Check availability to avoid std::out_of_range exception.
-      if (senders.count(eg_config.first) != 0) {
-        bool const send_via_multicast{(eg_config.second.has_value()) &&
-                                      (eg_config.second->multicast_threshold !=
-                                       configuration::Configuration::kEventMulticastThresholdUseOnlyUnicast) &&
-                                      (eg_config.second->multicast_threshold <= senders.at(eg_config.first).size()) &&
-                                      (udp_mcast_sender != nullptr)};
-
-        if (send_via_multicast) {
-          // Send via multicast
-          if (udp_mcast_sender->ForwardFromLocal(message)) {
-            result.EmplaceValue();
-          }
-        } else {
-          // Send via unicast
-          if (event.transport_protocol == configuration::types::TransportProtocol::kTCP) {
-            if (DispatchSomeIpMessageWithTcp(message, senders, eg_config.first, sent_to_list)) {
-              result.EmplaceValue();
-            }
-          } else {
-            if (DispatchSomeIpMessageWithUdp(message, senders, eg_config.first, sent_to_list)) {
-              result.EmplaceValue();
-            } else {
-              // Added a else block to make Bauhaus happy (M6.4.2)
-            }
-          }
-        }
-      } else {
-        // If no subscribers are found, still it is a valid usecase.
-        // Hence, no error is returned.
-        result.EmplaceValue();
-      }
-    }
-    return result;
+  ara::core::Result<void> DispatchSomeIpMessage(std::shared_ptr<someip_protocol::internal::SomeIpMessage> message,
+                                                configuration::types::SomeIpEventDeployment const& event,
+                                                UdpSenderImmutablePtr udp_mcast_sender) const noexcept {
+    return Dispatch(
+        event, udp_mcast_sender,
+        [&message](typename UdpSender::pointer const sender) { return sender->ForwardFromLocal(message); },
+        [&message](typename TcpSender::pointer const sender) { return sender->ForwardFromLocal(message); },
+        [&message](typename UdpSender::pointer const sender) { return sender->ForwardFromLocal(message); });
   }
 
   /*!
    * \brief Dispatches a PDU message via TCP to subscribers.
    * \param[in] message                  The PDU message.
-   * \param[in] senders                  A reference to a map with the event subscribers.
-   * \param[in] provided_eventgroup_map  A reference to eventgroup map configuration.
    * \param[in] event                    A reference to the current event.
    * \param[in] udp_mcast_sender         The UDP multicast sender.
    *
@@ -184,294 +229,254 @@ class EventMessageDispatcher final {
    * \error amsr::generic::GenErrc::kRuntimeConnectionTransmissionFailed if the event couldn't be
    *        forwarded.
    *
+   * \pre UpdateSubscriptions() has been called after the last change of the subscriptions.
    * \context Network
    * \reentrant FALSE
    * \steady TRUE
    *
    * \internal
-   * - For each eventgroup to which the event belongs
-   *  - Get the multicast configuration for th event
-   *  - If the event exist within the senders.
-   *    - If the event must be sent using multicast (it has a multicast configuration, threshold is valid, threshold is
-   *      lesser than the number of eventgroup's senders and udp multicast sender is not nullptr):
-   *      - If Dispatch the event using the multicast sender returns success,
-   *        - Emplace the value to the result.
-   *    - Else: send the event using unicast
-   *      - If the event is configured to use TCP protocol:
-   *        - If Dispatch the event using the TCP subscription returns success,
-   *        - Emplace the value to the result.
-   *      - Else: the event uses udp protocol
-   *        - If Dispatch the event using the UDP subscription (unicast) returns success,
-   *        - Emplace the value to the result.
-   *  - Else: Emplace the value to the result, if no subscribers are found.
+   * - Dispatch like DispatchSomeIpMessage(), forwarding the PDU message.
    * \endinternal
    */
-  static ara::core::Result<void> DispatchPduMessage(std::shared_ptr<someip_protocol::internal::PduMessage> message,
-                                                    SendersMap const& senders,
-                                                    ProvidedEventgroupMap const& provided_eventgroup_map,
-                                                    configuration::types::SomeIpEventDeployment const& event,
-                                                    UdpSenderImmutablePtr udp_mcast_sender) noexcept {
-    ara::core::Result<void> result{ara::core::ErrorCode{amsr::generic::GenErrc::kRuntimeConnectionTransmissionFailed}};
-    SentToSet sent_to_list{};
-
-    for (std::pair<someip_protocol::internal::EventgroupId,
-                   ara::core::Optional<configuration::types::MulticastEventgroupConfig>> const& eg_config :
-         EventToEventgroups(provided_eventgroup_map, event.event_id)) {
-      // Multicast threshold.
-      // Check availability to avoid std::out_of_range exception.
-      if (senders.count(eg_config.first) != 0) {
-        bool const send_via_multicast{(eg_config.second.has_value()) &&
-                                      (eg_config.second->multicast_threshold !=
-                                       configuration::Configuration::kEventMulticastThresholdUseOnlyUnicast) &&
-                                      (eg_config.second->multicast_threshold <= senders.at(eg_config.first).size()) &&
-                                      (udp_mcast_sender != nullptr)};
-
-        if (send_via_multicast) {
-          // Send via multicast
-          if (udp_mcast_sender->ForwardPduFromLocal(message)) {
-            result.EmplaceValue();
-          }
-        } else {
-          // Send via unicast
-          if (event.transport_protocol == configuration::types::TransportProtocol::kTCP) {
-            if (DispatchPduMessageWithTcp(message, senders, eg_config.first, sent_to_list)) {
-              result.EmplaceValue();
-            }
-          } else {
-            if (DispatchPduMessageWithUdp(message, senders, eg_config.first, sent_to_list)) {
-              result.EmplaceValue();
-            } else {
-              // Added a else block to make Bauhaus happy (M6.4.2)
-            }
-          }
-        }
-      } else {
-        // If no subscribers are found, still it is a valid usecase.
-        // Hence, no error is returned.
-        result.EmplaceValue();
-      }
-    }
-    return result;
+  ara::core::Result<void> DispatchPduMessage(std::shared_ptr<someip_protocol::internal::PduMessage> message,
+                                             configuration::types::SomeIpEventDeployment const& event,
+                                             UdpSenderImmutablePtr udp_mcast_sender) const noexcept {
+    return Dispatch(
+        event, udp_mcast_sender,
+        [&message](typename UdpSender::pointer const sender) { return sender->ForwardPduFromLocal(message); },
+        [&message](typename TcpSender::pointer const sender) { return sender->ForwardPduFromLocal(message); },
+        [&message](typename UdpSender::pointer const sender) { return sender->ForwardPduFromLocal(message); });
   }
 
  private:
   /*!
-   * \brief Search for all the eventgroups an event belongs to and return a container with their multicast
-   * configuration.
-   * \param[in] provided_eventgroup_map A map containing all the eventgroups.
-   * \param[in] event                   An event to look for in the eventgroup map.
-   *
-   * \return A vector of pairs, each containing the multicast configuration of the eventgroups where the event
-   * belongs to and its eventgroup id
-   *
-   * \steady TRUE
-   *
-   * \internal
-   *  - Create a vector of pairs, each containing eventgroup multicast configuration and eventgroup id.
-   *  - For every eventgroup:
-   *    - If the event exists within the eventgroup:
-   *      - Add the eventgroup multicast configuration and eventgroup id to the vector.
-   * \endinternal
+   * \brief An eventgroup an event belongs to.
    */
-  static ara::core::Vector<std::pair<someip_protocol::internal::EventgroupId,
-                                     ara::core::Optional<configuration::types::MulticastEventgroupConfig>>>
-  EventToEventgroups(ProvidedEventgroupMap const& provided_eventgroup_map,
-                     someip_protocol::internal::EventId const& event_id) noexcept {
-    // PTP-B-Configuration_EventToEventgroups
-    configuration::types::ProvidedSomeIpEventMap::const_iterator event_config;
-    ProvidedEventgroupMap::const_iterator eg;
-    ara::core::Vector<std::pair<someip_protocol::internal::EventgroupId,
-                                ara::core::Optional<configuration::types::MulticastEventgroupConfig>>>
-        eventgroup_config{};
-
-    for (eg = provided_eventgroup_map.cbegin(); eg != provided_eventgroup_map.cend(); ++eg) {
-      event_config = eg->second.events.find(event_id);
-      if (event_config != eg->second.events.cend()) {
-        eventgroup_config.emplace_back(eg->first, eg->second.multicast_eventgroup_config);
-      }
-    }
+  struct EventgroupSlot {
+    /*!
+     * \brief Eventgroup id.
+     */
+    someip_protocol::internal::EventgroupId eventgroup_id{};
 
-    // PTP-E-Configuration_EventToEventgroups
-    return eventgroup_config;
-  }
+    /*!
+     * \brief Multicast threshold of the eventgroup, empty if no multicast is configured.
+     */
+    ara::core::Optional<std::uint32_t> multicast_threshold{};
+
+    /*!
+     * \brief Number of subscribers of the eventgroup.
+     */
+    std::size_t subscriber_count{0U};
+
+    /*!
+     * \brief Flag that shows if the number of subscribers reached the multicast threshold of this eventgroup.
+     */
+    bool multicast_threshold_reached{false};
+  };
 
   /*!
-   * \brief Dispatches a SOME/IP message via TCP to subscribers.
-   * \param[in] message The SOME/IP message.
-   * \param[in] senders A reference to a map with the event subscribers.
-   * \param[in] egid The eventgroup id of the event to send.
-   * \param[in, out] sent_to_list A set containing all the IP addresses to which this event has already
-   *                         been sent, to avoid send duplication.
-   *
-   * \return false if a failure occurred while forwarding to one of the receivers,
-   *                   true otherwise.
-   *
-   * \context Network
-   * \reentrant FALSE
-   * \steady TRUE
-   *
-   * \internal
-   * - For each subscriber for the given eventgroup id
-   *   - If the subscriber has a registered TCP sender
-   *     - If the TCP sender has not been used yet to send this event
-   *       - Forward the event
-   *       - Add this sender to the list of used addresses
-   * \endinternal
+   * \brief A unique receiver of an event.
+   * \tparam SenderPtr Owning sender pointer type.
    */
-  static bool DispatchSomeIpMessageWithTcp(std::shared_ptr<someip_protocol::internal::SomeIpMessage> message,
-                                           SendersMap const& senders, someip_protocol::internal::EventgroupId egid,
-                                           SentToSet& sent_to_list) noexcept {
-    bool result{true};
-    // VECTOR NC AutosarC++17_10-A15.4.2: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    // VECTOR NC AutosarC++17_10-A15.5.3: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    for (EventgroupSubscriberType const& s : senders.at(egid)) {
-      if (s.tcp_sender != nullptr) {
-        // Skip sending same event multiple times to the same target
-        someip_daemon_core::IpAddress const& address{s.tcp_sender->GetRemoteAddress()};
-        amsr::net::ip::Port const port{s.tcp_sender->GetRemotePort()};
-        configuration::Configuration::SocketAddress const remote_socket_address{address, port};
-        if (sent_to_list.insert(remote_socket_address).second) {
-          bool const dispatch_outcome{s.tcp_sender->ForwardFromLocal(message)};
-          result = result && dispatch_outcome;
-        }
-      }
-    }
+  template <typename SenderPtr>
+  struct Receiver {
+    /*!
+     * \brief Sender, owned by the subscriptions.
+     */
+    typename SenderPtr::pointer sender;
 
-    return result;
-  }
+    /*!
+     * \brief Index of the eventgroup slot the receiver was found in first.
+     */
+    std::size_t slot_index;
+  };
 
   /*!
-   * \brief Dispatches a SOME/IP message via UDP to subscribers.
-   * \param[in] message The SOME/IP message.
-   * \param[in] senders A reference to a map with the event subscribers.
-   * \param[in] egid The eventgroup id of the event to send.
-   * \param[in, out] sent_to_list A set containing all the IP addresses to which this event has already
-   *                         been sent, to avoid send duplication.
-   *
-   * \return false if a failure occurred while forwarding to one of the receivers,
-   *                   true otherwise.
-   *
-   * \context Network
-   * \reentrant FALSE
-   * \steady TRUE
-   *
-   * \internal
-   * - For each subscriber for the given eventgroup id
-   *   - If the subscriber has a registered UDP sender
-   *     - If the UDP sender has not been used yet to send this event
-   *       - Forward the event
-   *       - Add this sender to the list of used addresses
-   * \endinternal
+   * \brief Deduplicated unicast receivers of an event.
    */
-  static bool DispatchSomeIpMessageWithUdp(std::shared_ptr<someip_protocol::internal::SomeIpMessage> message,
-                                           SendersMap const& senders, someip_protocol::internal::EventgroupId egid,
-                                           SentToSet& sent_to_list) noexcept {
-    bool result{true};
-    // VECTOR NC AutosarC++17_10-A15.4.2: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    // VECTOR NC AutosarC++17_10-A15.5.3: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    for (EventgroupSubscriberType const& s : senders.at(egid)) {
-      if (s.udp_sender != nullptr) {
-        // Skip sending same event multiple times to the same target
-        someip_daemon_core::IpAddress const& address{s.udp_sender->GetRemoteAddress()};
-        amsr::net::ip::Port const port{s.udp_sender->GetRemotePort()};
-        configuration::Configuration::SocketAddress const socket_address{address, port};
-        if (sent_to_list.insert(socket_address).second) {
-          bool const dispatch_outcome{s.udp_sender->ForwardFromLocal(message)};
-          result = result && dispatch_outcome;
-        }
+  struct UnicastReceivers {
+    /*!
+     * \brief Deduplicated TCP receivers.
+     */
+    ara::core::Vector<Receiver<TcpSender>> tcp_receivers{};
+
+    /*!
+     * \brief Deduplicated UDP receivers.
+     */
+    ara::core::Vector<Receiver<UdpSender>> udp_receivers{};
+
+    /*!
+     * \brief Addresses of the TCP receivers, only used while the lists are rebuilt.
+     */
+    SentToSet tcp_sent_to{};
+
+    /*!
+     * \brief Addresses of the UDP receivers, only used while the lists are rebuilt.
+     */
+    SentToSet udp_sent_to{};
+
+    /*!
+     * \brief Removes all receivers.
+     * \steady FALSE
+     */
+    void Clear() noexcept {
+      tcp_receivers.clear();
+      udp_receivers.clear();
+    }
+
+    /*!
+     * \brief Releases the receiver addresses once the lists are complete.
+     * \steady FALSE
+     */
+    void ReleaseSentTo() noexcept {
+      tcp_sent_to.clear();
+      udp_sent_to.clear();
+    }
+
+    /*!
+     * \brief     Adds the senders of a subscriber that are not yet contained.
+     * \param[in] subscriber Eventgroup subscriber.
+     * \param[in] slot_index Index of the eventgroup slot the subscriber belongs to.
+     * \steady    FALSE
+     */
+    void Add(EventgroupSubscriberType const& subscriber, std::size_t const slot_index) noexcept {
+      if ((subscriber.tcp_sender != nullptr) &&
+          tcp_sent_to
+              .insert(configuration::Configuration::SocketAddress{subscriber.tcp_sender->GetRemoteAddress(),
+                                                                  subscriber.tcp_sender->GetRemotePort()})
+              .second) {
+        tcp_receivers.emplace_back(Receiver<TcpSender>{subscriber.tcp_sender.get(), slot_index});
+      }
+      if ((subscriber.udp_sender != nullptr) &&
+          udp_sent_to
+              .insert(configuration::Configuration::SocketAddress{subscriber.udp_sender->GetRemoteAddress(),
+                                                                  subscriber.udp_sender->GetRemotePort()})
+              .second) {
+        udp_receivers.emplace_back(Receiver<UdpSender>{subscriber.udp_sender.get(), slot_index});
       }
     }
-    return result;
+  };
+
+  /*!
+   * \brief Index of the unicast receivers used if a multicast sender is available.
+   */
+  static constexpr std::size_t kWithMulticastSender{0U};
+
+  /*!
+   * \brief Index of the unicast receivers used if no multicast sender is available.
+   */
+  static constexpr std::size_t kWithoutMulticastSender{1U};
+
+  /*!
+   * \brief Precomputed fan-out of one event.
+   */
+  struct EventFanOut {
+    /*!
+     * \brief Event id.
+     */
+    someip_protocol::internal::EventId event_id{};
+
+    /*!
+     * \brief Eventgroups the event belongs to.
+     */
+    ara::core::Vector<EventgroupSlot> eventgroups{};
+
+    /*!
+     * \brief Unicast receivers, indexed by kWithMulticastSender and kWithoutMulticastSender.
+     */
+    ara::core::Array<UnicastReceivers, 2U> unicast_receivers{};
+  };
+
+  /*!
+   * \brief     Maps an eventgroup slot onto a bit of the failure mask. Slots beyond 63 share the last bit.
+   * \param[in] slot_index Eventgroup slot index.
+   * \return    Bit mask.
+   * \steady    TRUE
+   */
+  static std::uint64_t SlotBit(std::size_t const slot_index) noexcept {
+    constexpr std::size_t kLastBit{63U};
+    return static_cast<std::uint64_t>(1U) << std::min(slot_index, kLastBit);
   }
 
   /*!
-   * \brief Dispatches a PDU message via TCP to subscribers.
-   * \param[in] message The PDU message.
-   * \param[in] senders A reference to a map with the event subscribers.
-   * \param[in] egid The eventgroup id of the event to send.
-   * \param[in, out] sent_to_list A set containing all the IP addresses to which this event has already
-   *                         been sent, to avoid send duplication.
-   *
-   * \return false if a failure occurred while forwarding to one of the receivers,
-   *                   true otherwise.
-   *
-   * \context Network
-   * \reentrant FALSE
-   * \steady TRUE
-   *
-   * \internal
-   * - For each subscriber for the given eventgroup id
-   *   - If the subscriber has a registered TCP sender
-   *     - If the TCP sender has not been used yet to send this event
-   *       - Forward the event
-   *       - Add this sender to the list of used addresses
-   * \endinternal
+   * \brief     Forwards a message to the receivers of one protocol.
+   * \tparam    SenderPtr  Owning sender pointer type.
+   * \tparam    Forward    Function object with signature bool(typename SenderPtr::pointer).
+   * \param[in] receivers  Receivers.
+   * \param[in] forward    Forward function.
+   * \return    Mask of the eventgroup slots with a failed forward.
+   * \steady    TRUE
    */
-  static bool DispatchPduMessageWithTcp(std::shared_ptr<someip_protocol::internal::PduMessage> message,
-                                        SendersMap const& senders, someip_protocol::internal::EventgroupId egid,
-                                        SentToSet& sent_to_list) noexcept {
-    bool result{true};
-    // VECTOR NC AutosarC++17_10-A15.4.2: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    // VECTOR NC AutosarC++17_10-A15.5.3: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    for (EventgroupSubscriberType const& s : senders.at(egid)) {
-      if (s.tcp_sender != nullptr) {
-        // Skip sending same event multiple times to the same target
-        someip_daemon_core::IpAddress const& address{s.tcp_sender->GetRemoteAddress()};
-        amsr::net::ip::Port const port{s.tcp_sender->GetRemotePort()};
-        configuration::Configuration::SocketAddress const remote_socket_address{address, port};
-        if (sent_to_list.insert(remote_socket_address).second) {
-          bool const dispatch_outcome{s.tcp_sender->ForwardPduFromLocal(message)};
-          result = result && dispatch_outcome;
-        }
+  template <typename SenderPtr, typename Forward>
+  static std::uint64_t ForwardToReceivers(ara::core::Vector<Receiver<SenderPtr>> const& receivers,
+                                          Forward&& forward) noexcept {
+    std::uint64_t failed_slots{0U};
+    for (Receiver<SenderPtr> const& receiver : receivers) {
+      if (!forward(receiver.sender)) {
+        failed_slots |= SlotBit(receiver.slot_index);
       }
     }
-
-    return result;
+    return failed_slots;
   }
 
   /*!
-   * \brief Dispatches a PDU message via UDP to subscribers.
-   * \param[in] message The PDU message.
-   * \param[in] senders A reference to a map with the event subscribers.
-   * \param[in] egid The eventgroup id of the event to send.
-   * \param[in, out] sent_to_list A set containing all the IP addresses to which this event has already
-   *                         been sent, to avoid send duplication.
-   *
-   * \return false if a failure occurred while forwarding to one of the receivers,
-   *                   true otherwise.
-   *
-   * \context Network
-   * \reentrant FALSE
-   * \steady TRUE
-   *
-   * \internal
-   * - For each subscriber for the given eventgroup id
-   *   - If the subscriber has a registered UDP sender
-   *     - If the TCP sender has not been used yet to send this event
-   *       - Forward the event
-   *       - Add this sender to the list of used addresses
-   * \endinternal
+   * \brief     Dispatches a message through the fan-out list of an event.
+   * \param[in] event             The current event.
+   * \param[in] udp_mcast_sender  The UDP multicast sender.
+   * \param[in] forward_multicast Forward function for the multicast sender.
+   * \param[in] forward_tcp       Forward function for TCP receivers.
+   * \param[in] forward_udp       Forward function for UDP receivers.
+   * \return    A result with the value void if successful, with an error otherwise.
+   * \steady    TRUE
    */
-  static bool DispatchPduMessageWithUdp(std::shared_ptr<someip_protocol::internal::PduMessage> message,
-                                        SendersMap const& senders, someip_protocol::internal::EventgroupId egid,
-                                        SentToSet& sent_to_list) noexcept {
-    bool result{true};
-    // VECTOR NC AutosarC++17_10-A15.4.2: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    // VECTOR NC AutosarC++17_10-A15.5.3: MD_SomeIpDaemon_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
-    for (EventgroupSubscriberType const& s : senders.at(egid)) {
-      if (s.udp_sender != nullptr) {
-        // Skip sending same event multiple times to the same target
-        someip_daemon_core::IpAddress const& address{s.udp_sender->GetRemoteAddress()};
-        amsr::net::ip::Port const port{s.udp_sender->GetRemotePort()};
-        configuration::Configuration::SocketAddress const socket_address{address, port};
-        if (sent_to_list.insert(socket_address).second) {
-          bool const dispatch_outcome{s.udp_sender->ForwardPduFromLocal(message)};
-          result = result && dispatch_outcome;
+  template <typename ForwardMulticast, typename ForwardTcp, typename ForwardUdp>
+  ara::core::Result<void> Dispatch(configuration::types::SomeIpEventDeployment const& event,
+                                   UdpSenderImmutablePtr udp_mcast_sender, ForwardMulticast&& forward_multicast,
+                                   ForwardTcp&& forward_tcp, ForwardUdp&& forward_udp) const noexcept {
+    ara::core::Result<void> result{ara::core::ErrorCode{amsr::generic::GenErrc::kRuntimeConnectionTransmissionFailed}};
+    typename ara::core::Vector<EventFanOut>::const_iterator const entry{std::lower_bound(
+        fan_out_.cbegin(), fan_out_.cend(), event.event_id,
+        [](EventFanOut const& candidate, someip_protocol::internal::EventId const id) {
+          return candidate.event_id < id;
+        })};
+
+    if ((entry != fan_out_.cend()) && (entry->event_id == event.event_id)) {
+      bool const multicast_available{udp_mcast_sender != nullptr};
+      UnicastReceivers const& receivers{
+          entry->unicast_receivers[multicast_available ? kWithMulticastSender : kWithoutMulticastSender]};
+      std::uint64_t failed_slots{0U};
+      if (event.transport_protocol == configuration::types::TransportProtocol::kTCP) {
+        failed_slots = ForwardToReceivers(receivers.tcp_receivers, forward_tcp);
+      } else {
+        failed_slots = ForwardToReceivers(receivers.udp_receivers, forward_udp);
+      }
+
+      for (std::size_t slot_index{0U}; slot_index < entry->eventgroups.size(); ++slot_index) {
+        EventgroupSlot const& slot{entry->eventgroups[slot_index]};
+        if (slot.subscriber_count == 0U) {
+          // If no subscribers are found, still it is a valid usecase.
+          // Hence, no error is returned.
+          result.EmplaceValue();
+        } else if (slot.multicast_threshold_reached && multicast_available) {
+          // Send via multicast
+          if (forward_multicast(udp_mcast_sender)) {
+            result.EmplaceValue();
+          }
+        } else if ((failed_slots & SlotBit(slot_index)) == 0U) {
+          // All receivers first found in this eventgroup have been served.
+          result.EmplaceValue();
+        } else {
+          // Added a else block to make Bauhaus happy (M6.4.2)
         }
       }
     }
     return result;
   }
+
+  /*!
+   * \brief Fan-out entries of all provided events, sorted by event id.
+   */
+  ara::core::Vector<EventFanOut> fan_out_{};
 };
 
 }  // namespace eventgroup
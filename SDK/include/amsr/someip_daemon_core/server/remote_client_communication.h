@@ -353,6 +353,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
                   }));
         }
       }
+      UpdateEventFanOut();
     } else {
       logger_.LogDebug([](ara::log::LogStream& s) noexcept { s << "Service already offered"; },
                        static_cast<char const*>(__func__), __LINE__);
@@ -368,6 +369,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
    *
    * \internal
    * - Clear event group subscriptions.
+   * - Rebuild the event fan-out.
    * - Set as false is_service_offered flag.
    * \endinternal
    */
@@ -381,6 +383,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
     is_service_offered_ = false;
 
     eventgroup_subscriptions_.clear();
+    UpdateEventFanOut();
   }
 
   /*!
@@ -410,6 +413,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
    *    get UDP sender from the connection manager.
    *  - If service has been already offered, send initial field events for every new subscriber.
    *  - Register the subscriber in the container of subscriptions.
+   *  - Rebuild the event fan-out.
    * - Else:
    *  - Log an error.
    * \endinternal
@@ -492,6 +496,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
 
         // Register the subscriber in the container of subscriptions
         eventgroup_subscriptions_[eventgroup_id].emplace_back(std::move(subscriber));
+        UpdateEventFanOut();
         logger_.LogDebug(
             [this, &tcp_endpoint, &udp_endpoint, &eventgroup_id](ara::log::LogStream& s) {
               std::size_t const subscriptions_count{eventgroup_subscriptions_.at(eventgroup_id).size()};
@@ -552,6 +557,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
    *   - Check if the UDP entry of the subscription matches the given address and port
    *   - If both TCP and UDP addresses are matching: subscription found
    * - If subscription found, delete it from the subscription container
+   * - Rebuild the event fan-out
    * \endinternal
    */
   void UnsubscribeEventgroup(
@@ -580,6 +586,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
     EventgroupSubscriberContainer& eventgroup_subscriptions{eventgroup_subscriptions_[eventgroup_id]};
 
     static_cast<void>(eventgroup_subscriptions.erase(it));
+    UpdateEventFanOut();
 
     std::size_t const subscriptions_count{eventgroup_subscriptions_.at(eventgroup_id).size()};
     logger_.LogDebug(
@@ -705,8 +712,8 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
       // Add the accumulation timeout
       packet->SetAccumulationTimeout(GetMessageAccumulationTimeout(event_id, event_message_accumulation_timeouts_));
       // In case the service is offered and transmission succeeded, we must return success
-      result = event_message_dispatcher_.DispatchSomeIpMessage(
-          packet, eventgroup_subscriptions_, provided_eventgroup_map_, event_config.Value(), udp_mcast_sender_.get());
+      result =
+          event_message_dispatcher_.DispatchSomeIpMessage(packet, event_config.Value(), udp_mcast_sender_.get());
     }
     return result;
   }
@@ -764,8 +771,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
     if (event_config.HasValue()) {
       // Add the accumulation timeout
       packet->SetAccumulationTimeout(GetMessageAccumulationTimeout(event_id, event_message_accumulation_timeouts_));
-      result = event_message_dispatcher_.DispatchPduMessage(packet, eventgroup_subscriptions_, provided_eventgroup_map_,
-                                                            event_config.Value(), udp_mcast_sender_.get());
+      result = event_message_dispatcher_.DispatchPduMessage(packet, event_config.Value(), udp_mcast_sender_.get());
     }
 
     return result;
@@ -933,6 +939,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
    *     - If the TCP connection is disconnected
    *       - Trigger the event manager to cancel the subscription
    * - Delete all subscriptions with a broken connection
+   * - Rebuild the event fan-out
    * \endinternal
    */
   void CleanupSubscriptions() noexcept {
@@ -960,6 +967,17 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
         static_cast<void>(eventgroup_subscriptions_[eventgroup_id].erase(new_begin_to_erase, iter_end));
       }
     }
+    UpdateEventFanOut();
+  }
+
+  /*!
+   * \brief             Rebuilds the precomputed event fan-out after a change of the subscriptions.
+   * \context           Network, App, Timer
+   * \reentrant         FALSE
+   * \steady            FALSE
+   */
+  void UpdateEventFanOut() noexcept {
+    event_message_dispatcher_.UpdateSubscriptions(eventgroup_subscriptions_);
   }
 
   // VECTOR NC AutosarC++17_10-M0.1.8: MD_SomeIpDaemon_AutosarC++17_10-M0.1.8_functions_with_no_side_effects
@@ -1351,7 +1369,7 @@ class RemoteClientCommunication : public connection_manager::ConnectionStateChan
   /*!
    * \brief Used to dispatch event messages to subscribers via TCP and UDP senders or UDP multicast.
    */
-  eventgroup::EventMessageDispatcher<TcpSenderPtr, UdpSenderPtr> const event_message_dispatcher_{};
+  eventgroup::EventMessageDispatcher<TcpSenderPtr, UdpSenderPtr> event_message_dispatcher_{provided_eventgroup_map_};
 
   /*!
    * \brief The logger.
@@ -27,6 +27,7 @@
  *********************************************************************************************************************/
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include "amsr/shared_ptr.h"
 #include "amsr/shared_ptr_resource.h"
@@ -604,8 +605,11 @@ class Future final {
       // Since the fut_cont pointer can only ever be nullptr if shared_state_ is nullptr,
       // checking shared_state_ in valid() is enough to place the assert here (to please VCA).
       assert(fut_cont.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-      std::lock_guard<std::mutex> const lock{fut_cont->GetCallBackMutex()};
+      std::unique_lock<std::mutex> lock{fut_cont->GetCallBackMutex()};
       if (is_ready()) {
+        // The Promise does not change a ready Future any more. Release the call back mutex before the callable runs, so
+        // a callable executed inline may call then() again.
+        lock.unlock();
         // Call the function if Future state is ready.
         // checking shared_state_ in valid() is enough to place the assert here (to please VCA).
         assert(fut_cont.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
@@ -971,8 +975,11 @@ class Future<void, E> final {
       // Since the fut_cont pointer can only ever be nullptr if shared_state_ is nullptr,
       // checking shared_state_ in valid() is enough to place the assert here (to please VCA).
       assert(fut_cont.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-      std::lock_guard<std::mutex> const lock{fut_cont->GetCallBackMutex()};
+      std::unique_lock<std::mutex> lock{fut_cont->GetCallBackMutex()};
       if (is_ready()) {
+        // The Promise does not change a ready Future any more. Release the call back mutex before the callable runs, so
+        // a callable executed inline may call then() again.
+        lock.unlock();
         // Call the function if Future state is ready.
         // checking shared_state_ in valid() is enough to place the assert here (to please VCA).
         assert(fut_cont.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
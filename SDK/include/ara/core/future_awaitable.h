@@ -0,0 +1,167 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  C++20 coroutine awaitable for ara::core::Future.
+ *         \unit  VaCommonLib::LanguageSupport::AsynchronousOperations::Future
+ *
+ *      \details  Allows to co_await an ara::core::Future from a coroutine. The coroutine is resumed from the
+ *                continuation of the Future, i.e. in the context of the execution context set on the Future (see
+ *                Future::SetExecutionContext()), or in the context which completes the Promise if none is set. No
+ *                thread is blocked while waiting. The content of this file is only available if the compiler supports
+ *                C++20 coroutines.
+ *********************************************************************************************************************/
+
+#ifndef LIB_VAC_INCLUDE_ARA_CORE_FUTURE_AWAITABLE_H_
+#define LIB_VAC_INCLUDE_ARA_CORE_FUTURE_AWAITABLE_H_
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && defined(__has_include)
+#if __has_include(<coroutine>)
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <coroutine>
+#include <utility>
+#include "amsr/core/optional.h"
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+
+namespace ara {
+namespace core {
+
+/*!
+ * \brief   Awaitable wrapping a Future, to be used with co_await.
+ * \details If the Future is ready (or not valid) the coroutine is not suspended. Otherwise a continuation is registered
+ *          using Future::then() which stores the result and resumes the coroutine. If the continuation is executed
+ *          before the coroutine has finished suspending, the suspension is cancelled instead.
+ *          The result of co_await is the Result of the Future, an invalid Future yields future_errc::no_state.
+ * \tparam  T The value type of the Future.
+ * \tparam  E The error type of the Future.
+ * \vpublic
+ */
+template <typename T, typename E>
+class FutureAwaitable final {
+ public:
+  /*! \brief Type alias for the awaited Future. */
+  using FutureType = Future<T, E>;
+
+  /*! \brief Type alias for the Result delivered by co_await. */
+  using ResultType = Result<T, E>;
+
+  /*!
+   * \brief     Construct an awaitable from a Future.
+   * \param[in] future The Future to await.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit FutureAwaitable(FutureType&& future) noexcept : future_{std::move(future)} {}
+
+  /*! \brief Default destructor. */
+  ~FutureAwaitable() noexcept = default;
+
+  /*! \brief Deleted copy constructor. */
+  FutureAwaitable(FutureAwaitable const&) = delete;
+
+  /*! \brief Deleted move constructor. */
+  FutureAwaitable(FutureAwaitable&&) = delete;
+
+  /*! \brief Deleted copy assignment. */
+  FutureAwaitable& operator=(FutureAwaitable const&) & = delete;
+
+  /*! \brief Deleted move assignment. */
+  FutureAwaitable& operator=(FutureAwaitable&&) & = delete;
+
+  /*!
+   * \brief  Check whether the coroutine can continue without suspension.
+   * \return True if the Future is ready or not valid, false otherwise.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  bool await_ready() const noexcept { return (!future_.valid()) || future_.is_ready(); }
+
+  /*!
+   * \brief     Register the continuation which resumes the coroutine.
+   * \param[in] handle Handle of the suspended coroutine.
+   * \return    True if the coroutine stays suspended, false if the Future got ready in the meantime.
+   * \spec
+   *   requires true;
+   * \endspec
+   * \internal
+   * - Register a continuation on the Future which
+   *   - stores the result,
+   *   - and resumes the coroutine, if the suspension has already completed.
+   * - Mark the suspension as completed and keep the coroutine suspended, if the continuation has not been executed yet.
+   * \endinternal
+   */
+  bool await_suspend(std::coroutine_handle<> handle) noexcept {
+    handle_ = handle;
+    static_cast<void>(future_.then([this](FutureType ready_future) noexcept {
+      result_.emplace(ready_future.GetResult());
+      if (rendezvous_.exchange(true, std::memory_order_acq_rel)) {
+        handle_.resume();
+      }
+    }));
+    // Once the exchange is done, *this may be destroyed by the resumed coroutine and must not be accessed anymore.
+    return !rendezvous_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  /*!
+   * \brief  Get the result of the awaited Future.
+   * \return The value or the error of the Future.
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  ResultType await_resume() noexcept { return result_.has_value() ? std::move(*result_) : future_.GetResult(); }
+
+ private:
+  /*! \brief The awaited Future. Invalid once the continuation has been registered. */
+  FutureType future_;
+
+  /*! \brief The result stored by the continuation. */
+  ::amsr::core::Optional<ResultType> result_{};
+
+  /*! \brief Handle of the suspended coroutine. */
+  std::coroutine_handle<> handle_{};
+
+  /*! \brief Set by the first of await_suspend() and the continuation, the second one resumes the coroutine. */
+  std::atomic<bool> rendezvous_{false};
+};
+
+/*!
+ * \brief     Make a Future awaitable with co_await.
+ * \tparam    T The value type of the Future.
+ * \tparam    E The error type of the Future.
+ * \param[in] future The Future to await.
+ * \return    The awaitable for the Future.
+ * \spec
+ *   requires true;
+ * \endspec
+ * \vpublic
+ */
+template <typename T, typename E>
+FutureAwaitable<T, E> operator co_await(Future<T, E>&& future) noexcept {
+  return FutureAwaitable<T, E>{std::move(future)};
+}
+
+}  // namespace core
+}  // namespace ara
+
+#endif  // __has_include(<coroutine>)
+#endif  // defined(__cpp_impl_coroutine)
+
+#endif  // LIB_VAC_INCLUDE_ARA_CORE_FUTURE_AWAITABLE_H_
@@ -370,6 +370,8 @@ class FutureContinuation final {
     // VCA_VAC_STD_FUNC_FULFILL_CONTRACT
     call_back_ = std::make_unique<CallBackHolder<T, E, U, T2, E2>>(std::move(new_promise), std::move(fut),
                                                                    std::forward<Func>(handler));
+    // A callback registered from within a callback of this continuation is executed as well.
+    call_back_ready_ = true;
     if (is_ready) {
       ExecuteCallBack();
     }
@@ -412,46 +414,58 @@ class FutureContinuation final {
    * \endspec
    */
   void ExecuteCallBack() noexcept {
-    if (IsCallBackSet()) {
-      // VCA_VAC_STD_FUNC_FULFILL_CONTRACT
-      call_back_ready_ = false;  // VCA_VAC_VALID_NONSTATIC_METHOD
-      if (ec_) {
-        // VECTOR Next Construct VectorC++-V5.0.1: MD_VAC_V5.0.1_UnsequencedFunctionCalls
-        // VECTOR Next Construct AutosarC++17_10-A5.0.1: MD_VAC_A5.0.1_functionOrderIsNotRelevant
-        // VECTOR Next Construct AutosarC++17_10-M6.2.1: MD_VAC_M6.2.1_AssignmentOperatorsShallNotBeUsedInSubExpressions
-        // VECTOR Next Construct AutosarC++17_10-M9.3.3: MD_VAC_M9.3.3_methodCanBeDeclaredConst
-        // VCA_VAC_VALID_FUNC_CALL_RUN_TIME_CHECK
-        ec_->SubmitWork([call_back = std::move(call_back_)]() mutable noexcept { call_back->ExecuteCallBack(); });
-      } else {
-        assert(this->call_back_ != nullptr);  // COV_MSR_INV_STATE_ASSERT
-        call_back_->ExecuteCallBack();        // VCA_VAC_VALID_FUNC_CALL_RUN_TIME_CHECK
-      }
+    if (ClaimCallBack()) {
+      RunClaimedCallBack();
     }
   }
 
   /*!
-   * \brief  Get the call_back_mutex.
-   * \pre    -
+   * \brief   Claims the callback for execution.
+   * \details The Promise claims the callback while it holds the call back mutex and runs it with RunClaimedCallBack()
+   *          after it has released the mutex. A callback executed inline may then call Future::then() again.
+   * \pre     -
    * \spec
    *   requires true;
    * \endspec
-   * \return The call back mutex.
+   * \return True if the callback is registered and has not been claimed before, false otherwise.
    */
-  std::mutex& GetCallBackMutex() noexcept { return call_back_mutex_; }
+  bool ClaimCallBack() noexcept {
+    // VCA_VAC_STD_FUNC_FULFILL_CONTRACT
+    return (call_back_ != nullptr) && call_back_ready_.exchange(false);  // VCA_VAC_VALID_NONSTATIC_METHOD
+  }
 
- private:
   /*!
-   * \brief  Returns the registered state of the call back.
-   * \pre    -
+   * \brief Runs the callback claimed by ClaimCallBack(), in the execution context if one is set.
+   * \pre   ClaimCallBack() returned true.
    * \spec
    *   requires true;
    * \endspec
-   * \return True if the callback is registered, false otherwise.
    */
-  bool IsCallBackSet() const noexcept {  // Comment to force line-break. See TAR-22835.
-    return (call_back_ != nullptr) && call_back_ready_;
+  void RunClaimedCallBack() noexcept {
+    if (ec_) {
+      // VECTOR Next Construct VectorC++-V5.0.1: MD_VAC_V5.0.1_UnsequencedFunctionCalls
+      // VECTOR Next Construct AutosarC++17_10-A5.0.1: MD_VAC_A5.0.1_functionOrderIsNotRelevant
+      // VECTOR Next Construct AutosarC++17_10-M6.2.1: MD_VAC_M6.2.1_AssignmentOperatorsShallNotBeUsedInSubExpressions
+      // VECTOR Next Construct AutosarC++17_10-M9.3.3: MD_VAC_M9.3.3_methodCanBeDeclaredConst
+      // VCA_VAC_VALID_FUNC_CALL_RUN_TIME_CHECK
+      ec_->SubmitWork([call_back = std::move(call_back_)]() mutable noexcept { call_back->ExecuteCallBack(); });
+    } else {
+      assert(this->call_back_ != nullptr);  // COV_MSR_INV_STATE_ASSERT
+      call_back_->ExecuteCallBack();        // VCA_VAC_VALID_FUNC_CALL_RUN_TIME_CHECK
+    }
   }
 
+  /*!
+   * \brief  Get the call_back_mutex.
+   * \pre    -
+   * \spec
+   *   requires true;
+   * \endspec
+   * \return The call back mutex.
+   */
+  std::mutex& GetCallBackMutex() noexcept { return call_back_mutex_; }
+
+ private:
   /*! \brief A mutex to prevent setting a value while a call back is being set and vice versa. */
   std::mutex call_back_mutex_{};
 
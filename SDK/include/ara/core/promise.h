@@ -461,16 +461,23 @@ class Promise final {
     // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
     FutureContinuationPtr const fut_cont{future_continuation_};
 
-    Optional<std::lock_guard<std::mutex>> lock{};
-    GetLock(lock, fut_cont);
-    // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
-    SharedStatePtr const shared_state_local_copy{shared_state_};
-    // See justification comment in AbandonSharedState().
-    assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-    shared_state_local_copy->SetData(r);
-    if (fut_cont != nullptr) {
+    bool call_back_claimed{false};
+    {
+      Optional<std::lock_guard<std::mutex>> lock{};
+      GetLock(lock, fut_cont);
+      // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
+      SharedStatePtr const shared_state_local_copy{shared_state_};
+      // See justification comment in AbandonSharedState().
+      assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
+      shared_state_local_copy->SetData(r);
+      // VCA_VAC_VALID_NONSTATIC_METHOD
+      call_back_claimed = (fut_cont != nullptr) && fut_cont->ClaimCallBack();
+    }
+    // The call back runs after the call back mutex has been released, so a call back executed inline may call
+    // Future::then() again.
+    if (call_back_claimed) {
       // VCA_VAC_VALID_NONSTATIC_METHOD
-      fut_cont->ExecuteCallBack();
+      fut_cont->RunClaimedCallBack();
     }
   }
 
@@ -488,16 +495,22 @@ class Promise final {
     // See SetValueAndExecuteCallBack(R const&) for details.
     // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
     FutureContinuationPtr const fut_cont{future_continuation_};
-    Optional<std::lock_guard<std::mutex>> lock{};
-    GetLock(lock, fut_cont);
-    // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
-    SharedStatePtr const shared_state_local_copy{shared_state_};
-    // See justification comment in AbandonSharedState().
-    assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-    shared_state_local_copy->SetData(std::move(r));
-    if (fut_cont != nullptr) {
+    bool call_back_claimed{false};
+    {
+      Optional<std::lock_guard<std::mutex>> lock{};
+      GetLock(lock, fut_cont);
+      // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
+      SharedStatePtr const shared_state_local_copy{shared_state_};
+      // See justification comment in AbandonSharedState().
+      assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
+      shared_state_local_copy->SetData(std::move(r));
+      // VCA_VAC_VALID_NONSTATIC_METHOD
+      call_back_claimed = (fut_cont != nullptr) && fut_cont->ClaimCallBack();
+    }
+    // See SetValueAndExecuteCallBack(R const&) for why the call back runs after the mutex has been released.
+    if (call_back_claimed) {
       // VCA_VAC_VALID_NONSTATIC_METHOD
-      fut_cont->ExecuteCallBack();
+      fut_cont->RunClaimedCallBack();
     }
   }
 
@@ -902,14 +915,20 @@ class Promise<void, E> final {
     FutureContinuationPtr const fut_cont{future_continuation_};
     // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
     SharedStatePtr const shared_state_local_copy{shared_state_};
-    Optional<std::lock_guard<std::mutex>> lock{};
-    GetLock(lock, fut_cont);
-    // See justification comment in AbandonSharedState().
-    assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-    shared_state_local_copy->SetData(r);
-    if (fut_cont != nullptr) {
+    bool call_back_claimed{false};
+    {
+      Optional<std::lock_guard<std::mutex>> lock{};
+      GetLock(lock, fut_cont);
+      // See justification comment in AbandonSharedState().
+      assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
+      shared_state_local_copy->SetData(r);
       // VCA_VAC_VALID_NONSTATIC_METHOD
-      fut_cont->ExecuteCallBack();
+      call_back_claimed = (fut_cont != nullptr) && fut_cont->ClaimCallBack();
+    }
+    // See the non void Promise definition of SetValueAndExecuteCallBack(R const&) for why the call back runs unlocked.
+    if (call_back_claimed) {
+      // VCA_VAC_VALID_NONSTATIC_METHOD
+      fut_cont->RunClaimedCallBack();
     }
   }
 
@@ -927,16 +946,22 @@ class Promise<void, E> final {
     // See the non void Promise definition of SetValueAndExecuteCallBack(R const&) for details.
     // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
     FutureContinuationPtr const fut_cont{future_continuation_};
-    Optional<std::lock_guard<std::mutex>> lock{};
-    GetLock(lock, fut_cont);
-    // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
-    SharedStatePtr const shared_state_local_copy{shared_state_};
-    // See justification comment in AbandonSharedState().
-    assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
-    shared_state_local_copy->SetData(std::move(r));
-    if (fut_cont != nullptr) {
+    bool call_back_claimed{false};
+    {
+      Optional<std::lock_guard<std::mutex>> lock{};
+      GetLock(lock, fut_cont);
+      // VECTOR Next Line AutosarC++17_10-A18.5.8: MD_VAC_A18.5.8_localObjectsShallBeAllocatedOnStack
+      SharedStatePtr const shared_state_local_copy{shared_state_};
+      // See justification comment in AbandonSharedState().
+      assert(shared_state_local_copy.Get() != nullptr);  // COV_MSR_INV_STATE_ASSERT
+      shared_state_local_copy->SetData(std::move(r));
+      // VCA_VAC_VALID_NONSTATIC_METHOD
+      call_back_claimed = (fut_cont != nullptr) && fut_cont->ClaimCallBack();
+    }
+    // See SetValueAndExecuteCallBack(R const&) for why the call back runs after the mutex has been released.
+    if (call_back_claimed) {
       // VCA_VAC_VALID_NONSTATIC_METHOD
-      fut_cont->ExecuteCallBack();
+      fut_cont->RunClaimedCallBack();
     }
   }
 
@@ -24,9 +24,9 @@
 
 #include <algorithm>
 #include <memory>
-#include <mutex>
 #include <utility>
 
+#include "amsr/memory/container/overwriting_spsc_queue.h"
 #include "vac/container/static_list.h"
 
 #include "ipc_binding_core/internal/ipc_protocol/message.h"
@@ -46,6 +46,9 @@ using vac::container::literals::operator""_sv;
 
 /*!
  * \brief Generic template class representing a container of NotificationMessages.
+ * \details The Reactor (producer) and the application (consumer) exchange samples over a lock-free
+ *          OverwritingSpscQueue, so neither side blocks the other. The application cache is only accessed by the
+ *          application.
  *
  * \tparam SampleType  Type of stored sample.
  *
@@ -100,26 +103,24 @@ class InvisibleSampleCache final {
   /*!
    * \brief Clear the caches.
    *
-   * \pre         -
+   * \pre         Neither Enqueue() nor GetSamples() is called concurrently. The proxy event backend ensures this by
+   *              only enqueueing while a subscriber is registered under its subscriber lock.
    * \context     App
-   * \threadsafe  TRUE
+   * \threadsafe  FALSE
    * \reentrant   FALSE
    * \synchronous TRUE
    * \vprivate
    * \steady      TRUE
    *
    * \internal
-   * - Create lock for cache_mutex.
    * - Set the capacity to zero.
    * - Clear app and reactor cache.
    * \endinternal
    */
   void Clear() {
-    std::lock_guard<std::mutex> const cache_lock{cache_mutex_};
-
     capacity_ = 0;
     app_cache_.clear();
-    reactor_cache_.clear();
+    reactor_cache_.Reset(0U);
   }
 
   /*!
@@ -127,26 +128,24 @@ class InvisibleSampleCache final {
    *
    * \param[in] capacity  The amount of elements that can be cached.
    *
-   * \pre         -
+   * \pre         Neither Enqueue() nor GetSamples() is called concurrently. The proxy event backend ensures this by
+   *              only enqueueing while a subscriber is registered under its subscriber lock.
    * \context     App
-   * \threadsafe  TRUE
+   * \threadsafe  FALSE
    * \reentrant   FALSE
    * \synchronous TRUE
    * \vprivate
    * \steady      TRUE
    *
    * \internal
-   * - Create lock for cache_mutex.
    * - Update the capacity.
    * - Resize app and reactor cache.
    * \endinternal
    */
   void Resize(std::size_t capacity) {
-    std::lock_guard<std::mutex> const cache_lock{cache_mutex_};
-
     capacity_ = capacity;
     app_cache_.reserve(capacity);
-    reactor_cache_.reserve(capacity);
+    reactor_cache_.Reset(capacity);
   }
 
   /*!
@@ -166,11 +165,8 @@ class InvisibleSampleCache final {
    * \steady      TRUE
    *
    * \internal
-   * - Create lock for cache_mutex.
-   * - When the cache has a capacity greater than zero.
-   *   - Check if the cache is full.
-   *     - Remove the oldest cache entry.
-   *   - Create new entry within cache.
+   * - Enqueue the entry into the reactor cache, which drops the oldest entry if the cache is full.
+   * - Log if an entry was dropped.
    * \endinternal
    */
   auto Enqueue(NotificationMessage&& notification_message) -> bool {
@@ -178,20 +174,14 @@ class InvisibleSampleCache final {
     logger_.LogDebug([](::ara::log::LogStream const&) {},
                      Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
 
-    bool cache_updated{false};
-    std::lock_guard<std::mutex> const cache_lock{cache_mutex_};
-
-    if (capacity_ != 0U) {
-      if (reactor_cache_.size() == capacity_) {
-        reactor_cache_.pop_front();
-        logger_.LogDebug([](::ara::log::LogStream& s) { s << "Old sample dropped during notification"; },
-                         Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
-      }
+    ReactorCache::EnqueueResult const enqueue_result{reactor_cache_.Enqueue(std::move(notification_message))};
 
-      reactor_cache_.emplace_back(std::move(notification_message));
-      cache_updated = true;
+    if (enqueue_result == ReactorCache::EnqueueResult::kEnqueuedOldestDropped) {
+      logger_.LogDebug([](::ara::log::LogStream& s) { s << "Old sample dropped during notification"; },
+                       Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
     }
-    return cache_updated;
+    return (enqueue_result == ReactorCache::EnqueueResult::kEnqueued) ||
+           (enqueue_result == ReactorCache::EnqueueResult::kEnqueuedOldestDropped);
   }
 
   /*!
@@ -234,7 +224,6 @@ class InvisibleSampleCache final {
    * \steady      TRUE
    *
    * \internal
-   * - Create lock for cache_mutex.
    * - Calculate the number of stored samples within app cache and reactor cache.
    * - If this is greater than the capacity.
    *   - Drop excess from app cache.
@@ -247,11 +236,10 @@ class InvisibleSampleCache final {
     // VECTOR NC AutosarC++17_10-M0.1.8: MD_IPCBINDING_AutosarC++17_10_M0.1.8_Function_has_side_effect_logging
     logger_.LogDebug([](::ara::log::LogStream const&) {},
                      Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
-    std::lock_guard<std::mutex> const cache_lock{cache_mutex_};
 
     // Drop samples which are pushed out of the buffer
 
-    std::size_t const total_cache_size{reactor_cache_.size() + app_cache_.size()};
+    std::size_t const total_cache_size{reactor_cache_.Size() + app_cache_.size()};
     if (total_cache_size > capacity_) {
       std::size_t const samples_to_drop{total_cache_size - capacity_};
       // VECTOR NL AutosarC++17_10-A6.5.1: MD_IPCBINDING_AutosarC++17_10-A6.5.1_loop_counter
@@ -269,13 +257,14 @@ class InvisibleSampleCache final {
     if (cleaned_app_cache_size < requested_sample_count) {
       std::size_t const missing_samples{requested_sample_count - cleaned_app_cache_size};
 
-      std::size_t const samples_to_move{std::min(missing_samples, reactor_cache_.size())};
       // VECTOR NL AutosarC++17_10-A6.5.1: MD_IPCBINDING_AutosarC++17_10-A6.5.1_loop_counter
-      for (std::size_t move_index{0}; move_index < samples_to_move; ++move_index) {
+      for (std::size_t move_index{0}; move_index < missing_samples; ++move_index) {
+        ::amsr::core::Optional<NotificationMessage> sample{reactor_cache_.Dequeue()};
+        if (!sample.has_value()) {
+          break;  // Reactor cache is empty.
+        }
         // VCA_IPCB_CALLED_FUNCTION_OUTSIDE_COMPONENT
-        app_cache_.push_back(std::move(reactor_cache_.front()));
-
-        reactor_cache_.pop_front();
+        app_cache_.push_back(std::move(*sample));
       }
     }
 
@@ -294,14 +283,14 @@ class InvisibleSampleCache final {
   vac::container::StaticList<NotificationMessage> app_cache_{};
 
   /*!
-   * \brief Event storage for new events coming from the reactor.
+   * \brief Type of the storage for new events coming from the reactor.
    */
-  vac::container::StaticList<NotificationMessage> reactor_cache_{};
+  using ReactorCache = ::amsr::memory::container::OverwritingSpscQueue<NotificationMessage>;
 
   /*!
-   * \brief Mutex to protect invisible sample cache.
+   * \brief Event storage for new events coming from the reactor.
    */
-  mutable std::mutex cache_mutex_{};
+  ReactorCache reactor_cache_{};
 
   /*!
    * \brief Type alias for the user logger.
@@ -321,26 +310,6 @@ class InvisibleSampleCache final {
 
 #endif  // LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_EVENTS_INVISIBLE_SAMPLE_CACHE_H_
 
-// clang-format off
-/*!
- * \exclusivearea ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::cache_mutex_,
- *                Used for protecting parallel access to the invisible sample cache by App (read) and Reactor (write).
- *
- * \protects ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::app_cache_,
- *           ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::reactor_cache_,
- *           ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::capacity_,
- *           are the protected resources of an InvisibleSampleCache object.
- *
- * \usedin ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::Enqueue
- * \usedin ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::GetSamples
- * \usedin ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::Clear
- * \usedin ::amsr::ipc_binding_core::internal::events::InvisibleSampleCache::Resize
- * \exclude User threads/Reactor thread from accessing a variable that is already in access.
- * \length Small smaples are only moved from one list to another.
- * \endexclusivearea
- */
-// clang-format on
-
 // COV_JUSTIFICATION_BEGIN
 // \ID COV_IpcBinding_CoverageComponentOverall_trivial_utility
 //   \ACCEPT  XX
@@ -32,6 +32,8 @@
 #include "ara/core/vector.h"
 #include "vac/memory/non_zeroing_allocator.h"
 
+#include "ipc_binding_core/internal/ipc_protocol/ipc_packet_pool.h"
+
 namespace amsr {
 namespace ipc_binding_core {
 namespace internal {
@@ -52,7 +54,13 @@ using PacketBuffer =
 using PacketSpan = ara::core::Span<PacketBuffer::value_type const>;
 
 /*!
- * \brief Represents a shared pointer to a IPC Packet.
+ * \brief   Represents a shared pointer to a IPC Packet.
+ * \details amsr::SharedPtr instead of an intrusive vac::memory::IntrusiveSharedPtr:
+ *          - The type is part of the virtual Send() / AddToSendQueue() signatures of the connection interfaces that are
+ *            implemented in the IpcBinding library, so changing it would break the library interface.
+ *          - IpcPacketSharedConstructFromPool() uses amsr::AllocateShared(), which already places the reference counter
+ *            next to the PacketBuffer in one block of the IpcPacketPool. An intrusive counter would not save an
+ *            allocation.
  */
 using IpcPacketShared = amsr::SharedPtr<PacketBuffer>;
 
@@ -82,6 +90,37 @@ auto IpcPacketSharedConstruct(Args&&... args) noexcept -> IpcPacketShared {
   return amsr::MakeShared<PacketBuffer>(std::forward<Args>(args)..., alloc).Value();
 }
 
+/*!
+ * \brief   Construct IpcPacketShared from the IPC packet pool.
+ * \details Like IpcPacketSharedConstruct(), but the shared state (reference counter and PacketBuffer object) and the
+ *          packet payload are allocated from the IpcPacketPool returned by GetIpcPacketPool(), falling back to the
+ *          default resource if the pool is exhausted.
+ *          IpcPacketSharedConstruct() itself is unchanged, because it is also instantiated in the prebuilt IpcBinding
+ *          library. Only the header-only packet creation sites of the IPC binding use this function.
+ *
+ * \tparam Args  Argument type list for constructing the managed object.
+ *
+ * \param[in] args  Arguments to be passed to the managed object's constructor.
+ *
+ * \return A IpcPacketShared.
+ *
+ * \pre        -
+ * \context    ANY
+ * \threadsafe TRUE
+ * \reentrant  TRUE
+ * \steady     TRUE
+ *
+ * \spec requires true; \endspec
+ */
+template <typename... Args>
+auto IpcPacketSharedConstructFromPool(Args&&... args) noexcept -> IpcPacketShared {
+  IpcPacketPool& pool{GetIpcPacketPool()};
+  PacketBuffer::allocator_type alloc{&pool};
+  return amsr::AllocateShared<PacketBuffer>(ara::core::PolymorphicAllocator<char>{&pool}, std::forward<Args>(args)...,
+                                            alloc)
+      .Value();
+}
+
 }  // namespace ipc_protocol
 }  // namespace internal
 }  // namespace ipc_binding_core
@@ -0,0 +1,533 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Size-classed, preallocated memory pool for IPC packets.
+ *        \unit   IpcBinding::IpcBindingCore::IpcPacket
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_IPC_PROTOCOL_IPC_PACKET_POOL_H_
+#define LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_IPC_PROTOCOL_IPC_PACKET_POOL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "ara/core/memory_resource.h"
+#include "ara/core/span.h"
+#include "ara/core/vector.h"
+
+namespace amsr {
+namespace ipc_binding_core {
+namespace internal {
+namespace ipc_protocol {
+
+/*!
+ * \brief   Size-classed, preallocated memory pool for IPC packets.
+ * \details The pool owns one contiguous block storage per size class, allocated once at construction. Each size class
+ *          tracks its free blocks in a bitmap of atomic words, so blocks can be acquired and released from any thread
+ *          without locking. An allocation is served from the smallest size class with a free block that fits. Requests
+ *          that no size class can serve are forwarded to the upstream memory resource and counted as misses.
+ *
+ *          IpcPacketSharedConstructFromPool() allocates the shared state of a packet (reference counter and
+ *          PacketBuffer object in one block) and the packet payload from this pool, so a packet round trip does not
+ *          touch the heap as long as the pool has free blocks.
+ *
+ * \unit IpcBinding::IpcBindingCore::IpcPacket
+ */
+class IpcPacketPool final : public ::ara::core::MemoryResource {
+ public:
+  /*!
+   * \brief Configuration of one size class.
+   */
+  struct SizeClassConfig {
+    /*!
+     * \brief Size of each block in bytes. Rounded up to a multiple of the maximum fundamental alignment.
+     */
+    std::size_t block_size;
+
+    /*!
+     * \brief Number of preallocated blocks.
+     */
+    std::size_t block_count;
+  };
+
+  /*!
+   * \brief Pool usage statistics.
+   */
+  struct Statistics {
+    /*!
+     * \brief Number of allocations served from the pool.
+     */
+    std::uint64_t hit_count;
+
+    /*!
+     * \brief Number of allocations forwarded to the upstream memory resource.
+     */
+    std::uint64_t miss_count;
+  };
+
+  /*!
+   * \brief Number of size classes of the default configuration.
+   */
+  static constexpr std::size_t kNumberOfDefaultSizeClasses{5U};
+
+  /*!
+   * \brief Type of the default size class configuration.
+   */
+  using DefaultSizeClasses = std::array<SizeClassConfig, kNumberOfDefaultSizeClasses>;
+
+  /*!
+   * \brief   Returns the default size class configuration.
+   * \details The smallest size class holds the shared state of a packet together with small payloads, the larger size
+   *          classes cover typical method and event payloads.
+   *
+   * \return The default size class configuration, sorted by ascending block size.
+   *
+   * \pre         -
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   */
+  static constexpr auto GetDefaultSizeClasses() noexcept -> DefaultSizeClasses {
+    return DefaultSizeClasses{{{128U, 512U}, {512U, 128U}, {2048U, 64U}, {8192U, 16U}, {32768U, 4U}}};
+  }
+
+  /*!
+   * \brief Construct the pool and preallocate all blocks.
+   *
+   * \param[in] size_classes  Size class configuration, sorted by ascending block size.
+   * \param[in] upstream      Memory resource used for the block storage and for all allocations the pool cannot
+   *                          serve. Must outlive the pool.
+   *
+   * \pre         -
+   * \context     Init
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      FALSE
+   *
+   * \internal
+   * - For each configured size class:
+   *   - Round the block size up to the maximum fundamental alignment.
+   *   - Allocate the block storage and mark all blocks as free.
+   * \endinternal
+   */
+  explicit IpcPacketPool(::ara::core::Span<SizeClassConfig const> size_classes,
+                         ::ara::core::MemoryResource* upstream = ::ara::core::GetDefaultResource()) noexcept
+      : ::ara::core::MemoryResource{},
+        upstream_{upstream},
+        size_classes_{::ara::core::PolymorphicAllocator<SizeClass>{upstream}} {
+    size_classes_.reserve(size_classes.size());
+    for (SizeClassConfig const& config : size_classes) {
+      std::size_t const block_size{((config.block_size + kBlockAlignment) - 1U) / kBlockAlignment * kBlockAlignment};
+      size_classes_.emplace_back(block_size, config.block_count, upstream);
+    }
+  }
+
+  /*!
+   * \brief Destroy the pool and release the block storage.
+   *
+   * \pre         All blocks handed out by the pool have been released.
+   * \context     Shutdown
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      FALSE
+   */
+  ~IpcPacketPool() noexcept final = default;
+
+  IpcPacketPool(IpcPacketPool const&) = delete;
+  IpcPacketPool(IpcPacketPool&&) = delete;
+  auto operator=(IpcPacketPool const&) & -> IpcPacketPool& = delete;
+  auto operator=(IpcPacketPool&&) & -> IpcPacketPool& = delete;
+
+  /*!
+   * \brief   Returns the pool usage statistics.
+   * \details Each packet accounts for two allocations: its shared state and its payload.
+   *
+   * \return Number of allocations served from the pool and forwarded to the upstream memory resource.
+   *
+   * \pre         -
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \vprivate
+   * \steady      TRUE
+   */
+  auto GetStatistics() const noexcept -> Statistics {
+    return Statistics{hit_count_.load(std::memory_order_relaxed), miss_count_.load(std::memory_order_relaxed)};
+  }
+
+ private:
+  /*!
+   * \brief Alignment of every block.
+   */
+  static constexpr std::size_t kBlockAlignment{alignof(std::max_align_t)};
+
+  /*!
+   * \brief Type of one word of the free block bitmap.
+   */
+  using Word = std::uint64_t;
+
+  /*!
+   * \brief Number of bits in one word of the free block bitmap.
+   */
+  static constexpr std::size_t kBitsPerWord{64U};
+
+  /*!
+   * \brief Storage unit of the block storage, guarantees the block alignment.
+   */
+  using StorageUnit = std::aligned_storage<kBlockAlignment, kBlockAlignment>::type;
+
+  /*!
+   * \brief Preallocated blocks of one size.
+   */
+  struct SizeClass {
+    /*!
+     * \brief     Allocate the block storage and mark all blocks as free.
+     * \param[in] size         Block size in bytes, a multiple of kBlockAlignment.
+     * \param[in] count        Number of blocks.
+     * \param[in] upstream     Memory resource for the block storage.
+     */
+    SizeClass(std::size_t size, std::size_t count, ::ara::core::MemoryResource* upstream) noexcept
+        : block_size{size},
+          block_count{count},
+          storage((size / kBlockAlignment) * count, ::ara::core::PolymorphicAllocator<StorageUnit>{upstream}),
+          free_blocks(((count + kBitsPerWord) - 1U) / kBitsPerWord,
+                      ::ara::core::PolymorphicAllocator<std::atomic<Word>>{upstream}) {
+      // VECTOR NL AutosarC++17_10-A6.5.1: MD_IPCBINDING_AutosarC++17_10-A6.5.1_loop_counter
+      for (std::size_t word_index{0U}; word_index < free_blocks.size(); ++word_index) {
+        std::size_t const first_block{word_index * kBitsPerWord};
+        std::size_t const blocks_in_word{((count - first_block) < kBitsPerWord) ? (count - first_block)
+                                                                                 : kBitsPerWord};
+        Word const all_free{(blocks_in_word == kBitsPerWord) ? ~Word{0U} : ((Word{1U} << blocks_in_word) - 1U)};
+        free_blocks[word_index].store(all_free, std::memory_order_relaxed);
+      }
+    }
+
+    /*!
+     * \brief Block size in bytes.
+     */
+    std::size_t block_size;
+
+    /*!
+     * \brief Number of blocks.
+     */
+    std::size_t block_count;
+
+    /*!
+     * \brief Contiguous storage of all blocks.
+     */
+    ::ara::core::Vector<StorageUnit, ::ara::core::PolymorphicAllocator<StorageUnit>> storage;
+
+    /*!
+     * \brief Bitmap of the free blocks, bit i of word w belongs to block w * kBitsPerWord + i.
+     */
+    ::ara::core::Vector<std::atomic<Word>, ::ara::core::PolymorphicAllocator<std::atomic<Word>>> free_blocks;
+  };
+
+  /*!
+   * \brief   Returns the index of the lowest set bit.
+   *
+   * \param[in] word  Word with at least one bit set.
+   *
+   * \return Index of the lowest set bit.
+   */
+  static auto LowestSetBit(Word word) noexcept -> std::size_t {
+    // De Bruijn sequence lookup of the isolated lowest bit.
+    static constexpr Word kDeBruijn{0x03F79D71B4CB0A89U};
+    static constexpr std::array<std::uint8_t, kBitsPerWord> kIndex{
+        {0U,  1U,  48U, 2U,  57U, 49U, 28U, 3U,  61U, 58U, 50U, 42U, 38U, 29U, 17U, 4U,
+         62U, 55U, 59U, 36U, 53U, 51U, 43U, 22U, 45U, 39U, 33U, 30U, 24U, 18U, 12U, 5U,
+         63U, 47U, 56U, 27U, 60U, 41U, 37U, 16U, 54U, 35U, 52U, 21U, 44U, 32U, 23U, 11U,
+         46U, 26U, 40U, 15U, 34U, 20U, 31U, 10U, 25U, 14U, 19U, 9U,  13U, 8U,  7U,  6U}};
+    Word const lowest_bit{word & (~word + 1U)};
+    return kIndex[static_cast<std::size_t>((lowest_bit * kDeBruijn) >> 58U)];
+  }
+
+  /*!
+   * \brief   Try to acquire a free block of the given size class.
+   *
+   * \param[in,out] size_class  The size class.
+   *
+   * \return Pointer to the acquired block, nullptr if no block is free.
+   *
+   * \internal
+   * - For each word of the free block bitmap:
+   *   - While the word has a free block, try to clear its bit. On success return the block.
+   * \endinternal
+   */
+  static auto TryAcquireBlock(SizeClass& size_class) noexcept -> void* {
+    void* block{nullptr};
+    // VECTOR NL AutosarC++17_10-A6.5.1: MD_IPCBINDING_AutosarC++17_10-A6.5.1_loop_counter
+    for (std::size_t word_index{0U}; (block == nullptr) && (word_index < size_class.free_blocks.size());
+         ++word_index) {
+      std::atomic<Word>& free_word{size_class.free_blocks[word_index]};
+      Word bits{free_word.load(std::memory_order_relaxed)};
+      while ((block == nullptr) && (bits != 0U)) {
+        std::size_t const bit_index{LowestSetBit(bits)};
+        if (free_word.compare_exchange_weak(bits, bits & ~(Word{1U} << bit_index), std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+          std::size_t const block_index{(word_index * kBitsPerWord) + bit_index};
+          block = &size_class.storage[block_index * (size_class.block_size / kBlockAlignment)];
+        }
+      }
+    }
+    return block;
+  }
+
+  /*!
+   * \brief   Allocate a block from the smallest fitting size class or from the upstream memory resource.
+   *
+   * \param[in] bytes      The number of bytes to allocate.
+   * \param[in] alignment  The alignment of the allocated storage.
+   *
+   * \return Pointer to the allocated storage.
+   *
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \steady      TRUE
+   *
+   * \internal
+   * - If the alignment is supported, try all size classes large enough for the request in ascending order.
+   * - If a block was acquired count a hit, otherwise count a miss and allocate from upstream.
+   * \endinternal
+   */
+  auto DoAllocate(std::size_t bytes, std::size_t alignment) noexcept -> void* final {
+    void* result{nullptr};
+    if (alignment <= kBlockAlignment) {
+      for (SizeClass& size_class : size_classes_) {
+        if ((result == nullptr) && (bytes <= size_class.block_size)) {
+          result = TryAcquireBlock(size_class);
+        }
+      }
+    }
+    if (result != nullptr) {
+      hit_count_.fetch_add(1U, std::memory_order_relaxed);
+    } else {
+      miss_count_.fetch_add(1U, std::memory_order_relaxed);
+      result = upstream_->allocate(bytes, alignment);
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Return a block to its size class or release the storage to the upstream memory resource.
+   *
+   * \param[in] p          Pointer to the storage to deallocate.
+   * \param[in] bytes      The number of bytes to deallocate.
+   * \param[in] alignment  The alignment of the storage to deallocate.
+   *
+   * \context     ANY
+   * \threadsafe  TRUE
+   * \steady      TRUE
+   *
+   * \internal
+   * - If p lies within the block storage of a size class, set the free bit of its block.
+   * - Otherwise release p to upstream.
+   * \endinternal
+   */
+  void DoDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept final {
+    bool released{false};
+    StorageUnit const* const unit{static_cast<StorageUnit const*>(p)};
+    for (SizeClass& size_class : size_classes_) {
+      StorageUnit const* const begin{size_class.storage.data()};
+      StorageUnit const* const end{begin + size_class.storage.size()};
+      if ((!released) && (std::less_equal<StorageUnit const*>{}(begin, unit)) &&
+          (std::less<StorageUnit const*>{}(unit, end))) {
+        std::size_t const block_index{static_cast<std::size_t>(unit - begin) /
+                                      (size_class.block_size / kBlockAlignment)};
+        static_cast<void>(size_class.free_blocks[block_index / kBitsPerWord].fetch_or(
+            Word{1U} << (block_index % kBitsPerWord), std::memory_order_release));
+        released = true;
+      }
+    }
+    if (!released) {
+      upstream_->deallocate(p, bytes, alignment);
+    }
+  }
+
+  /*!
+   * \brief     Checks for equality with another memory resource.
+   * \param[in] other  Other memory resource.
+   * \return    true if other is this pool.
+   */
+  auto DoIsEqual(::ara::core::MemoryResource const& other) const noexcept -> bool final { return this == &other; }
+
+  /*!
+   * \brief Memory resource for the block storage and for allocations the pool cannot serve.
+   */
+  ::ara::core::MemoryResource* upstream_;
+
+  /*!
+   * \brief The size classes, sorted by ascending block size.
+   */
+  ::ara::core::Vector<SizeClass, ::ara::core::PolymorphicAllocator<SizeClass>> size_classes_;
+
+  /*!
+   * \brief Number of allocations served from the pool.
+   */
+  std::atomic<std::uint64_t> hit_count_{0U};
+
+  /*!
+   * \brief Number of allocations forwarded to the upstream memory resource.
+   */
+  std::atomic<std::uint64_t> miss_count_{0U};
+};
+
+/*!
+ * \brief   State of the process-wide IPC packet pool.
+ * \details Holds the size class configuration until the pool is created on first use.
+ *
+ * \unit IpcBinding::IpcBindingCore::IpcPacket
+ */
+struct IpcPacketPoolState {
+  /*!
+   * \brief Type of the size class configuration.
+   */
+  using SizeClasses = ::ara::core::Vector<IpcPacketPool::SizeClassConfig>;
+
+  /*!
+   * \brief Protects the configuration and the creation of the pool.
+   */
+  std::mutex lock{};
+
+  /*!
+   * \brief Size class configuration of the pool, the default configuration unless ConfigureIpcPacketPool() was called.
+   */
+  SizeClasses size_classes{};
+
+  /*!
+   * \brief The pool, nullptr until first use.
+   */
+  std::atomic<IpcPacketPool*> pool{nullptr};
+
+  /*!
+   * \brief Storage of the pool.
+   */
+  std::aligned_storage<sizeof(IpcPacketPool), alignof(IpcPacketPool)>::type pool_storage{};
+};
+
+/*!
+ * \brief   Returns the state of the process-wide IPC packet pool.
+ * \details The state is never destroyed, because packets may be released during static destruction after any other
+ *          static object has been destroyed.
+ *
+ * \return The state of the process-wide IPC packet pool.
+ *
+ * \pre         -
+ * \context     ANY
+ * \threadsafe  TRUE
+ * \reentrant   TRUE
+ * \synchronous TRUE
+ * \vprivate
+ * \steady      TRUE
+ */
+inline auto GetIpcPacketPoolState() noexcept -> IpcPacketPoolState& {
+  static std::aligned_storage<sizeof(IpcPacketPoolState), alignof(IpcPacketPoolState)>::type state_storage{};
+  static IpcPacketPoolState* const state{[]() {
+    IpcPacketPoolState* const new_state{new (&state_storage) IpcPacketPoolState{}};
+    IpcPacketPool::DefaultSizeClasses const default_size_classes{IpcPacketPool::GetDefaultSizeClasses()};
+    new_state->size_classes.assign(default_size_classes.cbegin(), default_size_classes.cend());
+    return new_state;
+  }()};
+  return *state;
+}
+
+/*!
+ * \brief   Sets the size class configuration of the process-wide IPC packet pool.
+ * \details The pool preallocates all blocks when the first pooled packet is created. The default configuration
+ *          returned by IpcPacketPool::GetDefaultSizeClasses() preallocates 512 KiB. Applications that send larger or
+ *          more packets concurrently, or that need less memory, call this function during initialization.
+ *
+ * \param[in] size_classes  Size class configuration, sorted by ascending block size. An empty configuration disables
+ *                          the pool, all packets are then allocated from the default resource.
+ *
+ * \return True if the configuration was applied, false if the pool is already in use.
+ *
+ * \pre         -
+ * \context     Init
+ * \threadsafe  TRUE
+ * \reentrant   FALSE
+ * \synchronous TRUE
+ * \vprivate
+ * \steady      FALSE
+ */
+inline auto ConfigureIpcPacketPool(::ara::core::Span<IpcPacketPool::SizeClassConfig const> size_classes) noexcept
+    -> bool {
+  IpcPacketPoolState& state{GetIpcPacketPoolState()};
+  std::lock_guard<std::mutex> const guard{state.lock};
+  bool const configurable{state.pool.load(std::memory_order_relaxed) == nullptr};
+  if (configurable) {
+    state.size_classes.assign(size_classes.cbegin(), size_classes.cend());
+  }
+  return configurable;
+}
+
+/*!
+ * \brief   Returns the process-wide IPC packet pool.
+ * \details The pool is created on first use with the configuration set by ConfigureIpcPacketPool(), or with the
+ *          default size classes. It is never destroyed, because packets may be released during static destruction
+ *          after any other static object has been destroyed.
+ *
+ * \return The process-wide IPC packet pool.
+ *
+ * \pre         -
+ * \context     ANY
+ * \threadsafe  TRUE
+ * \reentrant   TRUE
+ * \synchronous TRUE
+ * \vprivate
+ * \steady      TRUE
+ *
+ * \internal
+ * - If the pool does not exist yet, create it under the state lock with the configured size classes.
+ * \endinternal
+ */
+inline auto GetIpcPacketPool() noexcept -> IpcPacketPool& {
+  IpcPacketPoolState& state{GetIpcPacketPoolState()};
+  IpcPacketPool* pool{state.pool.load(std::memory_order_acquire)};
+  if (pool == nullptr) {
+    std::lock_guard<std::mutex> const guard{state.lock};
+    pool = state.pool.load(std::memory_order_relaxed);
+    if (pool == nullptr) {
+      pool = new (&state.pool_storage) IpcPacketPool{::ara::core::Span<IpcPacketPool::SizeClassConfig const>{
+          state.size_classes.data(), state.size_classes.size()}};
+      state.pool.store(pool, std::memory_order_release);
+    }
+  }
+  return *pool;
+}
+
+}  // namespace ipc_protocol
+}  // namespace internal
+}  // namespace ipc_binding_core
+}  // namespace amsr
+
+#endif  // LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_IPC_PROTOCOL_IPC_PACKET_POOL_H_
@@ -24,6 +24,8 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <atomic>
+#include <cstddef>
 #include <mutex>
 #include <utility>
 
@@ -35,6 +37,7 @@
 #include "ipc_binding_core/internal/memory.h"
 #include "ipc_binding_core/internal/methods/destruction_action.h"
 #include "ipc_binding_core/internal/methods/pending_request_map_interface.h"
+#include "ipc_binding_core/internal/methods/pending_request_slot_table.h"
 
 namespace amsr {
 namespace ipc_binding_core {
@@ -43,8 +46,12 @@ namespace methods {
 
 /*!
  * \brief   Provides functionality to store method requests into a map and restore requests on asynchronous response.
- * \details The map that stores the pending requests is protected from concurrent access, so that multiple requests can
- *          be triggered in parallel or a request and response at the same time.
+ * \details Pending requests are stored in a fixed-capacity PendingRequestSlotTable indexed by session ID, which is
+ *          accessed lock-free from the calling and the reactor threads. Only if the slot of a session ID is still
+ *          occupied (more outstanding requests than slots, or a future of an earlier request is still alive), the
+ *          request is stored in an overflow map protected by a mutex.
+ *          The slot table is created with the first stored request, so methods that are never called do not allocate
+ *          it.
  *
  * \tparam Output  Type of the response value that will be wrapped in a promise.
  *
@@ -69,9 +76,17 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
    */
   using OptionalMapEntry = typename PendingRequestMapInterface<Output>::OptionalMapEntry;
 
+  /*!
+   * \brief Default number of slots of the slot table.
+   */
+  static constexpr std::size_t kDefaultSlotCapacity{256U};
+
   /*!
    * \brief Construct a pending request map.
    *
+   * \param[in] slot_capacity  Number of requests that can be stored without using the overflow map. Must not be zero.
+   *                           The slot table is allocated by the first StoreRequest() call.
+   *
    * \pre         -
    * \context     App
    * \threadsafe  FALSE
@@ -79,7 +94,10 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
    * \synchronous TRUE
    * \steady      FALSE
    */
-  PendingRequestMap() noexcept = default;
+  explicit PendingRequestMap(std::size_t slot_capacity = kDefaultSlotCapacity) noexcept
+      : PendingRequestMapInterface<Output>{},
+        amsr::EnableSharedFromThis<PendingRequestMap<Output>>{},
+        slot_capacity_{slot_capacity} {}
 
   PendingRequestMap(PendingRequestMap&&) noexcept = delete;
   auto operator=(PendingRequestMap&&) noexcept -> PendingRequestMap& = delete;
@@ -87,7 +105,9 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
   auto operator=(PendingRequestMap const&) noexcept -> PendingRequestMap& = delete;
 
   /*!
-   * \brief Destroy the pending request map.
+   * \brief   Destroy the pending request map.
+   * \details All pending requests are dropped. The slot table itself is destroyed once no future references it any
+   *          more.
    *
    * \pre         -
    * \context     App
@@ -96,19 +116,127 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
    * \synchronous TRUE
    * \steady      FALSE
    */
-  ~PendingRequestMap() noexcept final = default;  // VCA_IPCB_COMPILER_GENERATED_DESTRUCTOR
+  ~PendingRequestMap() noexcept final {
+    if (slot_table_created_.load(std::memory_order_acquire)) {
+      OptionalMapEntry entry{slot_table_->TryTakeNext()};
+      while (entry.has_value()) {
+        entry = slot_table_->TryTakeNext();
+      }
+    }
+  }
 
   /*!
    * \copydoc PendingRequestMapInterface::StoreRequest()
    *
    * \internal
-   * - Prevent the request map from concurrent access.
-   *   - Try to emplace a new promise object into the pending requests map.
-   *   - If promise is successfully emplaced in pending request map:
+   * - Create the slot table if this is the first stored request.
+   * - If the session ID is already stored in the overflow map, reject the request.
+   * - Otherwise try to store the request in the slot table.
+   * - If the slot is occupied and the session ID is not stored in the slot table:
+   *   - Prevent the overflow map from concurrent access.
+   *   - Try to emplace a new promise object into the overflow map.
+   *   - If promise is successfully emplaced in the overflow map:
    *     - Construct a new future associated with the emplaced promise including a DestructionAction used.
    * \endinternal
    */
   auto StoreRequest(SessionId const session_id) noexcept -> ::amsr::core::Optional<::amsr::core::Future<Output>> final {
+    // VCA_IPCB_STD_FUNCTION_CALLED
+    std::call_once(slot_table_once_, [this]() {
+      slot_table_ = SlotTable::Create(slot_capacity_);
+      slot_table_created_.store(true, std::memory_order_release);
+    });
+    ::amsr::core::Optional<::amsr::core::Future<Output>> result{};
+    if (!IsOverflowRequest(session_id)) {
+      result = slot_table_->TryStore(session_id.value);
+      if ((!result.has_value()) && (!slot_table_->Contains(session_id.value))) {
+        result = StoreOverflowRequest(session_id);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc PendingRequestMapInterface::MoveOutRequest()
+   *
+   * \internal
+   * - If the slot table has been created, try to take the request out of the slot table.
+   * - If it is not found there and the overflow map is not empty, take it out of the overflow map.
+   * \endinternal
+   */
+  auto MoveOutRequest(SessionId const session_id) noexcept -> ::amsr::core::Optional<Promise> final {
+    ::amsr::core::Optional<Promise> optional_promise{};
+    if (slot_table_created_.load(std::memory_order_acquire)) {
+      optional_promise = slot_table_->TryTake(session_id.value);
+    }
+    if ((!optional_promise.has_value()) && (overflow_size_.load(std::memory_order_acquire) != 0U)) {
+      optional_promise = MoveOutOverflowRequest(session_id);
+    }
+    return optional_promise;
+  }
+
+  /*!
+   * \copydoc PendingRequestMapInterface::MoveOutNextRequest()
+   *
+   * \internal
+   * - If the slot table has been created, try to take any request out of the slot table.
+   * - If none is found there, take the next request out of the overflow map.
+   * \endinternal
+   */
+  auto MoveOutNextRequest() noexcept -> OptionalMapEntry final {
+    OptionalMapEntry next_entry{};
+    if (slot_table_created_.load(std::memory_order_acquire)) {
+      next_entry = slot_table_->TryTakeNext();
+    }
+    if (!next_entry.has_value()) {
+      next_entry = MoveOutNextOverflowRequest();
+    }
+    return next_entry;
+  }
+
+ private:
+  /*!
+   * \brief Type of the slot table.
+   */
+  using SlotTable = PendingRequestSlotTable<Output>;
+
+  /*!
+   * \brief   Check whether a request with the given session ID is stored in the overflow map.
+   *
+   * \param[in] session_id  Session ID used as map key.
+   *
+   * \return True if the overflow map contains the session ID, false otherwise.
+   *
+   * \internal
+   * - If the overflow map is not empty:
+   *   - Prevent the overflow map from concurrent access.
+   *   - Search for the session ID in the overflow map.
+   * \endinternal
+   */
+  auto IsOverflowRequest(SessionId const session_id) noexcept -> bool {
+    bool found{false};
+    if (overflow_size_.load(std::memory_order_acquire) != 0U) {
+      std::lock_guard<std::mutex> const pending_requests_guard{pending_requests_lock_};
+      found = pending_requests_.find(session_id.value) != pending_requests_.end();
+    }
+    return found;
+  }
+
+  /*!
+   * \brief   Store a request in the overflow map.
+   *
+   * \param[in] session_id  Session ID used as map key.
+   *
+   * \return An optional future for the stored promise, empty if the session ID is already stored.
+   *
+   * \internal
+   * - Prevent the overflow map from concurrent access.
+   *   - Try to emplace a new promise object into the overflow map.
+   *   - If promise is successfully emplaced in the overflow map:
+   *     - Construct a new future associated with the emplaced promise including a DestructionAction used.
+   * \endinternal
+   */
+  auto StoreOverflowRequest(SessionId const session_id) noexcept
+      -> ::amsr::core::Optional<::amsr::core::Future<Output>> {
     ::amsr::core::Optional<::amsr::core::Future<Output>> result{};
 
     std::lock_guard<std::mutex> const pending_requests_guard{pending_requests_lock_};
@@ -129,24 +257,29 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
           // VECTOR NC AutosarC++17_10-A5.1.5: MD_IPCBINDING_AutosarC++17_10-A5.1.5_false_positive
           // VCA_IPCB_PROXY_REQUEST_HANDLER_CALL_OF_DESTRUCTION_ACTION_FUNCTOR
           [destruction_action = std::move(destruction_action)]() { (*destruction_action)(); }));
+      static_cast<void>(overflow_size_.fetch_add(1U, std::memory_order_release));
     }
 
     return result;
   }
 
   /*!
-   * \copydoc PendingRequestMapInterface::MoveOutRequest()
+   * \brief Take a request out of the overflow map.
+   *
+   * \param[in] session_id  Session ID to identify the pending request promise.
+   *
+   * \return An Optional containing the promise corresponding to the request key, if it was found.
    *
    * \internal
-   * - Prevent the request map from concurrent access.
-   * - Search for the request with specific key in the pending requests.
+   * - Prevent the overflow map from concurrent access.
+   * - Search for the request with specific key in the overflow map.
    * - Check if a request was found.
    *   - Store the promise of the found request.
    *   - Delete the entry of the request in the pending request map.
    * - Return a pair of promise and a bool indicating the success/failure.
    * \endinternal
    */
-  auto MoveOutRequest(SessionId const session_id) noexcept -> ::amsr::core::Optional<Promise> final {
+  auto MoveOutOverflowRequest(SessionId const session_id) noexcept -> ::amsr::core::Optional<Promise> {
     std::lock_guard<std::mutex> const pending_requests_guard{pending_requests_lock_};
 
     typename MapType::iterator const request_entry{pending_requests_.find(session_id.value)};
@@ -162,23 +295,26 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
       // entry needs to be removed completely.
       // VCA_IPCB_STD_FUNCTION_CALLED
       static_cast<void>(pending_requests_.erase(request_entry));
+      static_cast<void>(overflow_size_.fetch_sub(1U, std::memory_order_release));
     }
 
     return optional_promise;
   }
 
   /*!
-   * \copydoc PendingRequestMapInterface::MoveOutNextRequest()
+   * \brief Take the next request out of the overflow map.
+   *
+   * \return The key and promise of the next request, if there is one.
    *
    * \internal
-   * - Prevent the request map from concurrent access.
-   * - Search for the next request in the pending requests.
+   * - Prevent the overflow map from concurrent access.
+   * - Search for the next request in the overflow map.
    * - Check if a request was found.
    *   - Store the key and promise of the found request.
    *   - Delete the entry of the request in the pending request map.
    * \endinternal
    */
-  auto MoveOutNextRequest() noexcept -> OptionalMapEntry final {
+  auto MoveOutNextOverflowRequest() noexcept -> OptionalMapEntry {
     std::lock_guard<std::mutex> const pending_requests_guard{pending_requests_lock_};
 
     OptionalMapEntry next_entry{};
@@ -191,23 +327,48 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
       // entry needs to be removed completely.
       // VCA_IPCB_STD_FUNCTION_CALLED
       static_cast<void>(pending_requests_.erase(request_entry));
+      static_cast<void>(overflow_size_.fetch_sub(1U, std::memory_order_release));
     }
     return next_entry;
   }
 
- private:
   /*!
-   * \brief Type of the underlying map for storage of the pending requests.
+   * \brief Type of the underlying map for storage of the overflowing pending requests.
    */
   using MapType = ::ara::core::Map<typename SessionId::type, Promise>;
 
   /*!
-   * \brief Holds all the pending requests.
+   * \brief Number of slots of the slot table.
+   */
+  std::size_t const slot_capacity_;
+
+  /*!
+   * \brief Holds the pending requests. Created by the first StoreRequest() call.
+   */
+  typename SlotTable::Ptr slot_table_{};
+
+  /*!
+   * \brief Ensures that the slot table is created only once.
+   */
+  std::once_flag slot_table_once_{};
+
+  /*!
+   * \brief Set once slot_table_ has been created, allows the reactor thread to skip the table before the first request.
+   */
+  std::atomic<bool> slot_table_created_{false};
+
+  /*!
+   * \brief Holds the pending requests whose slot in the slot table was occupied.
    */
   MapType pending_requests_{};
 
   /*!
-   * \brief Used to protect from concurrent access to the pending requests map:
+   * \brief Number of requests in the overflow map, allows skipping the lock while the overflow map is empty.
+   */
+  std::atomic<std::size_t> overflow_size_{0U};
+
+  /*!
+   * \brief Used to protect from concurrent access to the overflow map:
    *        - If requests and responses are handled at the same time.
    *        - If multiple requests are triggered in parallel.
    */
@@ -224,13 +385,14 @@ class PendingRequestMap final : public PendingRequestMapInterface<Output>,
 // clang-format off
 /*!
  * \exclusivearea amsr::ipc_binding_core::internal:::methods::PendingRequestMap::pending_requests_lock_
- *                Ensures consistency while read and write access to the map of pending requests.
+ *                Ensures consistency while read and write access to the overflow map of pending requests.
  *
  * \protects amsr::ipc_binding_core::internal:::methods::PendingRequestMap::pending_requests_
  *
- * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::StoreRequest
- * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::MoveOutRequest
- * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::MoveOutNextRequest
+ * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::IsOverflowRequest
+ * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::StoreOverflowRequest
+ * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::MoveOutOverflowRequest
+ * \usedin amsr::ipc_binding_core::internal:::methods::PendingRequestMap::MoveOutNextOverflowRequest
  *
  * \length MEDIUM   Limited to a map lookup, an emplacement if a request is added to the map or a removal of a request
  *                  entry from the map if a response was received. The exclusive area starts and ends always in the
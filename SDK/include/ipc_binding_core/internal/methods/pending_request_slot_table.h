@@ -0,0 +1,471 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Fixed-capacity, session ID indexed table of pending method requests.
+ *
+ *      \details -
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_METHODS_PENDING_REQUEST_SLOT_TABLE_H_
+#define LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_METHODS_PENDING_REQUEST_SLOT_TABLE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "amsr/core/abort.h"
+#include "amsr/core/future.h"
+#include "amsr/core/optional.h"
+#include "amsr/core/promise.h"
+#include "ara/core/memory_resource.h"
+#include "ara/core/vector.h"
+#include "vac/memory/intrusive_shared_ptr.h"
+
+#include "ipc_binding_core/internal/ipc_protocol/ipc_protocol_types.h"
+
+namespace amsr {
+namespace ipc_binding_core {
+namespace internal {
+namespace methods {
+
+/*!
+ * \brief   Fixed-capacity table of pending method requests, indexed by session ID.
+ * \details The request with session ID s is stored in slot (s % capacity). Each slot owns preallocated storage for one
+ *          promise and an atomic state word holding the session ID and the slot flags, so storing and restoring a
+ *          request is a sequence of compare-exchange operations without locking or heap allocation for the slot.
+ *          Including the session ID in the state word makes every transition specific to one request, so a response
+ *          for an old request can never take the promise of a newer request reusing the slot.
+ *
+ *          A slot stays occupied while its promise is stored or while the cleanup callable of the associated future is
+ *          alive. The cleanup callable holds an intrusive reference to its slot, and every such reference keeps the
+ *          table alive, so futures may outlive the owner of the table.
+ *
+ * \tparam Output  Type of the response value that will be wrapped in a promise.
+ *
+ * \unit IpcBinding::IpcBindingCore::ProxyMethod
+ */
+template <typename Output>
+class PendingRequestSlotTable final : public ::vac::memory::IntrusiveShared<PendingRequestSlotTable<Output>> {
+ public:
+  /*!
+   * \brief Type of the session ID value.
+   */
+  using SessionIdType = ::amsr::ipc_binding_core::internal::ipc_protocol::SessionId::type;
+
+  /*!
+   * \brief Type-alias for the stored promise.
+   */
+  using Promise = ::amsr::core::Promise<Output>;
+
+  /*!
+   * \brief Optional pair of session ID and promise.
+   */
+  using OptionalEntry = ::amsr::core::Optional<std::pair<SessionIdType, Promise>>;
+
+  /*!
+   * \brief Shared pointer type of the table.
+   */
+  using Ptr = ::vac::memory::IntrusiveSharedPtr<PendingRequestSlotTable>;
+
+  /*!
+   * \brief   Create a table.
+   *
+   * \param[in] capacity  Number of slots. Must not be zero.
+   *
+   * \return Shared pointer to the created table.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \steady      FALSE
+   */
+  static auto Create(std::size_t capacity) noexcept -> Ptr {
+    if (capacity == 0U) {
+      ::amsr::core::Abort("PendingRequestSlotTable: The capacity must not be zero.");
+    }
+    Allocator allocator{};
+    PendingRequestSlotTable* const table{AllocatorTraits::allocate(allocator, 1U)};
+    AllocatorTraits::construct(allocator, table, capacity);
+    return Ptr{*table};
+  }
+
+  /*!
+   * \brief Construct a table. Use Create() instead.
+   *
+   * \param[in] capacity  Number of slots.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \steady      FALSE
+   */
+  explicit PendingRequestSlotTable(std::size_t capacity) noexcept
+      : ::vac::memory::IntrusiveShared<PendingRequestSlotTable<Output>>{}, slots_(capacity) {
+    for (Slot& slot : slots_) {
+      slot.table_ = this;
+    }
+  }
+
+  PendingRequestSlotTable(PendingRequestSlotTable const&) = delete;
+  PendingRequestSlotTable(PendingRequestSlotTable&&) = delete;
+  auto operator=(PendingRequestSlotTable const&) -> PendingRequestSlotTable& = delete;
+  auto operator=(PendingRequestSlotTable&&) -> PendingRequestSlotTable& = delete;
+
+  /*!
+   * \brief Destroy the table.
+   *
+   * \pre         No slot is referenced any more.
+   * \context     ANY
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \steady      FALSE
+   */
+  ~PendingRequestSlotTable() noexcept final = default;
+
+  /*!
+   * \brief   Create a promise in the slot of the session ID and return a future associated with the promise.
+   * \details The future releases the slot when it is destroyed and drops the request if it is destroyed before the
+   *          response arrived, same as a DestructionAction.
+   *
+   * \param[in] session_id  Session ID of the request.
+   *
+   * \return The future for the stored promise, or an empty optional if the slot is occupied.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \steady      TRUE
+   *
+   * \internal
+   * - If the slot is free, claim it for the session ID.
+   *   - Take a table reference for the future and emplace the promise.
+   *   - Get the future with a cleanup callable referencing the slot.
+   *   - Publish the promise.
+   * \endinternal
+   */
+  auto TryStore(SessionIdType session_id) noexcept -> ::amsr::core::Optional<::amsr::core::Future<Output>> {
+    ::amsr::core::Optional<::amsr::core::Future<Output>> result{};
+    Slot& slot{GetSlot(session_id)};
+    StateWord expected{slot.state_.load(std::memory_order_relaxed)};
+    if ((expected & kFlagsMask) == 0U) {
+      StateWord const claimed{MakeState(session_id, kPromiseBusy | kFutureHeld)};
+      if (slot.state_.compare_exchange_strong(expected, claimed, std::memory_order_acquire,
+                                              std::memory_order_relaxed)) {
+        static_cast<void>(this->IncrementReferenceCount());
+        slot.promise_.emplace();
+        // VCA_IPCB_PROXY_REQUEST_HANDLER_OPTIONAL_SET
+        result.emplace(slot.promise_->get_future(FutureCleanup{typename Slot::Ptr{slot}}));
+        static_cast<void>(slot.state_.fetch_xor(kPromiseBusy | kPromiseReady, std::memory_order_release));
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Take the promise of the given session ID out of its slot.
+   *
+   * \param[in] session_id  Session ID of the request.
+   *
+   * \return The promise, or an empty optional if no request with the session ID is stored in the table.
+   *
+   * \pre         -
+   * \context     App | Reactor
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \steady      TRUE
+   */
+  auto TryTake(SessionIdType session_id) noexcept -> ::amsr::core::Optional<Promise> {
+    return TakeFromSlot(GetSlot(session_id), session_id);
+  }
+
+  /*!
+   * \brief Take the promise of any stored request out of its slot.
+   *
+   * \return The session ID and promise, or an empty optional if no request is stored in the table.
+   *
+   * \pre         -
+   * \context     App | Reactor
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \steady      TRUE
+   */
+  auto TryTakeNext() noexcept -> OptionalEntry {
+    OptionalEntry result{};
+    for (Slot& slot : slots_) {
+      if (!result.has_value()) {
+        StateWord const state{slot.state_.load(std::memory_order_acquire)};
+        if ((state & kPromiseReady) != 0U) {
+          SessionIdType const session_id{GetSessionId(state)};
+          ::amsr::core::Optional<Promise> promise{TakeFromSlot(slot, session_id)};
+          if (promise.has_value()) {
+            result.emplace(session_id, std::move(*promise));
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Check whether the slot of the given session ID holds a request with this session ID.
+   *
+   * \param[in] session_id  Session ID of the request.
+   *
+   * \return True if the request is stored, false otherwise.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  TRUE
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \steady      TRUE
+   */
+  auto Contains(SessionIdType session_id) const noexcept -> bool {
+    StateWord const state{GetSlot(session_id).state_.load(std::memory_order_acquire)};
+    return (GetSessionId(state) == session_id) && ((state & (kPromiseBusy | kPromiseReady)) != 0U);
+  }
+
+ private:
+  /*!
+   * \brief Type of the slot state word: session ID in the upper half, flags in the lower half.
+   */
+  using StateWord = std::uint64_t;
+
+  /*!
+   * \brief Flag: The promise storage is being written or read.
+   */
+  static constexpr StateWord kPromiseBusy{0x1U};
+
+  /*!
+   * \brief Flag: The promise storage holds a pending request.
+   */
+  static constexpr StateWord kPromiseReady{0x2U};
+
+  /*!
+   * \brief Flag: The cleanup callable of the future is alive.
+   */
+  static constexpr StateWord kFutureHeld{0x4U};
+
+  /*!
+   * \brief Mask of all flags. A slot is free if no flag is set.
+   */
+  static constexpr StateWord kFlagsMask{0xFFFFFFFFU};
+
+  /*!
+   * \brief Number of bits the session ID is shifted in the state word.
+   */
+  static constexpr std::uint32_t kSessionIdShift{32U};
+
+  /*!
+   * \brief Allocator type of the table.
+   */
+  using Allocator = ::ara::core::PolymorphicAllocator<PendingRequestSlotTable>;
+
+  /*!
+   * \brief Allocator traits of the table.
+   */
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+
+  /*!
+   * \brief One slot of the table.
+   */
+  class Slot final : public ::vac::memory::IntrusiveShared<Slot> {
+   public:
+    /*!
+     * \brief Shared pointer type of a slot.
+     */
+    using Ptr = ::vac::memory::IntrusiveSharedPtr<Slot>;
+
+    /*!
+     * \brief Construct a free slot.
+     */
+    Slot() noexcept = default;
+
+    Slot(Slot const&) = delete;
+    Slot(Slot&&) = delete;
+    auto operator=(Slot const&) -> Slot& = delete;
+    auto operator=(Slot&&) -> Slot& = delete;
+
+    /*!
+     * \brief Destroy the slot.
+     */
+    ~Slot() noexcept final = default;
+
+    /*!
+     * \brief Release the slot for the future when its last reference is gone.
+     */
+    void CallDeleter() noexcept final { table_->ReleaseFuture(*this); }
+
+    /*!
+     * \brief Table owning this slot.
+     */
+    PendingRequestSlotTable* table_{nullptr};
+
+    /*!
+     * \brief State word of the slot.
+     */
+    std::atomic<StateWord> state_{0U};
+
+    /*!
+     * \brief Storage of the promise.
+     */
+    ::amsr::core::Optional<Promise> promise_{};
+  };
+
+  /*!
+   * \brief Cleanup callable of a future returned by TryStore().
+   * \details Fits into the local buffer of the future's cleanup function, so handing it over does not allocate.
+   */
+  class FutureCleanup final {
+   public:
+    /*!
+     * \brief     Construct the cleanup callable.
+     * \param[in] slot  Reference to the slot of the request.
+     */
+    explicit FutureCleanup(typename Slot::Ptr&& slot) noexcept : slot_{std::move(slot)} {}
+
+    /*!
+     * \brief Drop the request, called if the future is destroyed before the response arrived.
+     */
+    void operator()() noexcept {
+      PendingRequestSlotTable* const table{slot_->table_};
+      StateWord const state{slot_->state_.load(std::memory_order_acquire)};
+      static_cast<void>(table->TakeFromSlot(*slot_, GetSessionId(state)));
+    }
+
+   private:
+    /*!
+     * \brief Reference to the slot of the request.
+     */
+    typename Slot::Ptr slot_;
+  };
+
+  /*!
+   * \brief   Returns the slot of a session ID.
+   * \param[in] session_id  The session ID.
+   * \return  The slot.
+   */
+  auto GetSlot(SessionIdType session_id) noexcept -> Slot& {
+    return slots_[static_cast<std::size_t>(session_id) % slots_.size()];
+  }
+
+  /*!
+   * \copydoc GetSlot()
+   */
+  auto GetSlot(SessionIdType session_id) const noexcept -> Slot const& {
+    return slots_[static_cast<std::size_t>(session_id) % slots_.size()];
+  }
+
+  /*!
+   * \brief   Build a state word.
+   * \param[in] session_id  The session ID.
+   * \param[in] flags       The flags.
+   * \return  The state word.
+   */
+  static constexpr auto MakeState(SessionIdType session_id, StateWord flags) noexcept -> StateWord {
+    return (static_cast<StateWord>(session_id) << kSessionIdShift) | flags;
+  }
+
+  /*!
+   * \brief   Returns the session ID of a state word.
+   * \param[in] state  The state word.
+   * \return  The session ID.
+   */
+  static constexpr auto GetSessionId(StateWord state) noexcept -> SessionIdType {
+    return static_cast<SessionIdType>(state >> kSessionIdShift);
+  }
+
+  /*!
+   * \brief   Take the promise of the given session ID out of a slot.
+   *
+   * \param[in,out] slot        The slot.
+   * \param[in]     session_id  The session ID.
+   *
+   * \return The promise, or an empty optional if the slot does not hold a pending request with the session ID.
+   *
+   * \internal
+   * - While the slot holds a published promise for the session ID, try to mark the promise storage busy.
+   *   - On success move the promise out and release the promise storage.
+   * \endinternal
+   */
+  auto TakeFromSlot(Slot& slot, SessionIdType session_id) noexcept -> ::amsr::core::Optional<Promise> {
+    ::amsr::core::Optional<Promise> result{};
+    StateWord state{slot.state_.load(std::memory_order_acquire)};
+    bool done{false};
+    while (!done) {
+      if ((GetSessionId(state) == session_id) && ((state & (kPromiseBusy | kPromiseReady)) == kPromiseReady)) {
+        // Only kFutureHeld may change concurrently, a failed exchange reloads the state and retries.
+        if (slot.state_.compare_exchange_weak(state, state ^ (kPromiseBusy | kPromiseReady),
+                                              std::memory_order_acquire, std::memory_order_acquire)) {
+          // VCA_IPCB_PROMISE_SAFE_FUNCTION, VCA_IPCB_VALID_PROMISE_ARGUMENT
+          result.emplace(std::move(*slot.promise_));
+          slot.promise_.reset();
+          static_cast<void>(slot.state_.fetch_and(~kPromiseBusy, std::memory_order_release));
+          done = true;
+        }
+      } else {
+        done = true;
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Release the slot for the future and the table reference taken for it.
+   * \details The table may be destroyed by this call.
+   *
+   * \param[in,out] slot  The slot.
+   */
+  void ReleaseFuture(Slot& slot) noexcept {
+    static_cast<void>(slot.state_.fetch_and(~kFutureHeld, std::memory_order_release));
+    static_cast<void>(this->DecrementReferenceCount());
+  }
+
+  /*!
+   * \brief Destroy the table when the last reference is gone.
+   */
+  void CallDeleter() noexcept final {
+    Allocator allocator{};
+    PendingRequestSlotTable* const table{this};
+    AllocatorTraits::destroy(allocator, table);
+    AllocatorTraits::deallocate(allocator, table, 1U);
+  }
+
+  /*!
+   * \brief The slots.
+   */
+  ::ara::core::Vector<Slot> slots_;
+};
+
+}  // namespace methods
+}  // namespace internal
+}  // namespace ipc_binding_core
+}  // namespace amsr
+
+#endif  // LIB_IPC_BINDING_CORE_INCLUDE_IPC_BINDING_CORE_INTERNAL_METHODS_PENDING_REQUEST_SLOT_TABLE_H_
@@ -232,7 +232,7 @@ class ProxyRequestHandler final {
                                  ipc_protocol::kRequestMessageHeaderLength + payload_size};
 
     // Creation of a buffer to serialize the generic protocol header, the request header and the payload.
-    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstruct(alloc_size)};
+    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstructFromPool(alloc_size)};
     ::amsr::someip_protocol::internal::serialization::BufferView const body_view{*packet};
     ::amsr::someip_protocol::internal::serialization::Writer writer{body_view};
     // Serialize IPC request message header
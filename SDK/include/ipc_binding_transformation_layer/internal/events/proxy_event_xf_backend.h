@@ -30,6 +30,7 @@
 #include <utility>
 
 #include "amsr/core/optional.h"
+#include "amsr/core/span.h"
 #include "amsr/core/string_view.h"
 #include "amsr/shared_ptr.h"
 #include "amsr/socal/internal/events/event_subscriber_interface.h"
@@ -266,11 +267,11 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
    *   - Lock guard to protect event manager storage (against parallel Subscriptions or Un-subscriptions).
    *   - Check if event backend doesn't store already a pointer to an event manager.
    *     - Set the cache capacity.
+   *     - Update size of invisible sample cache with requested cache_size.
    *     - Save the subscriber pointer (used to forward back notifications).
    *   - Otherwise
    *     - Log Fatal message and abort.
    *   - Free guard against parallel Subscriptions or Un-subscriptions.
-   *   - Update size of invisible sample cache with requested cache_size.
    *   - Update size of visible sample cache with requested cache_size and an extra element.
    *   - Create memory for event samples in sample cache.
    *   - Update the subscriber with the current subscription state.
@@ -305,9 +306,11 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
       {
         std::lock_guard<std::mutex> const subscriber_guard{subscriber_lock_};
 
-        // No need to lock against reactor, before subscription it is not allowed to receive any events.
         if (subscriber_ == nullptr) {
           cache_capacity_ = cache_size;
+          // Size the reactor ring before publishing the subscriber. OnNotificationReceived() only enqueues while
+          // subscriber_ is set and holds subscriber_lock_, so the ring is never reset under a running Enqueue().
+          invisible_sample_cache_.Resize(cache_capacity_);
           subscriber_ = event;
           subscription_status_ = ::ara::com::SubscriptionState::kSubscriptionPending;
         } else {
@@ -329,7 +332,6 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
         // Allocate visible cache with one additional spare slot (see AUTOSAR_EXP_ARAComAPI for the rationale).
         std::size_t const nr_samples_to_allocate{cache_capacity_ + 1};
 
-        invisible_sample_cache_.Resize(cache_capacity_);
         // VCA_IPCB_STD_FUNCTION_CALLED
         visible_sample_cache_ =
             // VCA_IPCB_STD_FUNCTION_CALLED
@@ -475,7 +477,8 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
             Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
       }
 
-      // Clear invisible and visible cache and reset size
+      // Clear invisible and visible cache and reset size.
+      // subscriber_ is already reset under subscriber_lock_, so OnNotificationReceived() no longer enqueues.
       invisible_sample_cache_.Clear();
       // VCA_IPCB_STD_FUNCTION_CALLED_WITHOUT_PARAMETER
       visible_sample_cache_.reset();
@@ -632,40 +635,42 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
    */
   auto ReadSamples(SizeType const max_samples, CallableReadSamplesResult const& callable_sample_result) noexcept
       -> ReadSamplesResult final {
-    if (subscriber_ == nullptr) {
-      constexpr char const* error_message{"ReadSamples() called while not being subscribed!"};
-      logger_.TerminateOnViolation(  // COV_IpcBinding_CodeCoverageComponentOverall_logger_call_in_terminating_branch
-          error_message, [](::ara::log::LogStream& s) { s << error_message; },
-          Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
-    }
-
-    ::ara::com::ComErrorDomain::SupportDataType const no_support_data_provided{0};
-    ReadSamplesResult result{ReadSamplesResult::FromError(
-        ::ara::com::MakeErrorCode(::ara::com::ComErrc::kMaxSamplesReached, no_support_data_provided,
-                                  "Application holds more SamplePtrs than committed in Subscribe"))};
-
-    // VCA_IPCB_VALID_SAMPLE_CACHE_POINTER_ACCESS
-    if (visible_sample_cache_->GetFreeSampleCount() > 0) {
-      SizeType valid_events_processed{0};
-
-      SampleCacheContainer& invisible_app_cache_container{invisible_sample_cache_.GetSamples(max_samples)};
-
-      // Note: the returned cache might have size equal, greater
-      // than or less than max_samples.
-      // In case more samples than requested exist, do not
-      // process the additional samples
+    return ReadSamplesWithSink(max_samples, callable_sample_result);
+  }
 
-      if (!invisible_app_cache_container.empty()) {
-        valid_events_processed =
-            ReadSamplesInternal(invisible_app_cache_container, max_samples, callable_sample_result);
-      } else {  // No samples were available in invisible cache
-        logger_.LogVerbose(
-            [](::ara::log::LogStream& s) { s << "No new samples available in invisible sample cache to process."; },
-            Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
-      }
-      result.EmplaceValue(valid_events_processed);
-    }
-    return result;
+  /*!
+   * \brief   Reads the serialized samples from underlying receive buffers into a caller provided buffer.
+   * \details Same semantics as ReadSamples(). The samples are moved into the buffer directly, without the per-sample
+   *          CallableReadSamplesResult invocation of the default implementation.
+   *
+   * \param[in]  max_samples  Maximum number of samples that can be processed within this call.
+   * \param[out] samples      Buffer the samples are stored into, starting at the first element. At most
+   *                          min(max_samples, samples.size()) samples are read.
+   *
+   * \return An amsr::core::Result containing the number of samples stored into the buffer or an error.
+   *
+   * \error ara::com::ComErrc::kMaxSamplesReached  If all slots from visible sample cache are used at the beginning of
+   *                                               the call.
+   *
+   * \pre         Event must be subscribed.
+   * \context     App
+   * \threadsafe  FALSE for same class instance, TRUE for different instances. TRUE against GetE2EResult and
+   *              GetFreeSampleCount when invoked on same/different class instances.
+   * \reentrant   FALSE for same class instance, TRUE for different instances.
+   * \synchronous TRUE
+   *
+   * \internal
+   * - Read up to min(max_samples, samples.size()) samples and move every sample into the next buffer element.
+   * \endinternal
+   */
+  auto ReadSamplesBatch(std::size_t const max_samples, ::amsr::core::Span<SampleData> samples) noexcept
+      -> ReadSamplesResult final {
+    std::size_t stored_samples{0U};
+    return ReadSamplesWithSink(std::min(max_samples, samples.size()),
+                               [&samples, &stored_samples](SampleData&& sample_data) {
+                                 samples[stored_samples] = std::move(sample_data);
+                                 ++stored_samples;
+                               });
   }
 
   /*!
@@ -965,13 +970,83 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
     }
   }
 
+  /*!
+   * \brief Reads the serialized samples from underlying receive buffers, deserializes them and passes them to a sink.
+   *
+   * \tparam SampleSink  Callable with the signature void(SampleData&&).
+   *
+   * \param[in] max_samples  Maximum number of samples that can be processed within this call.
+   * \param[in] sample_sink  Sink to be invoked on successful deserialization.
+   *
+   * \return An amsr::core::Result containing the number of events successfully processed within this call or an error.
+   *
+   * \error ara::com::ComErrc::kMaxSamplesReached  If all slots from visible sample cache are used at the beginning of
+   *                                               the call.
+   *
+   * \pre         -
+   * \context     App
+   * \threadsafe  FALSE
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   *
+   * \internal
+   * - If no subscriber is registered.
+   *   - Log fatal and call Abort().
+   * - Create a result with an error ComErrc::kMaxSamplesReached.
+   * - If there are sample pointers available in the visible sample cache.
+   *   - If there are events available in the invisible cache.
+   *     - Call ReadSamplesInternal.
+   *   - Emplace number of processed events in result.
+   *   - Return result.
+   * \endinternal
+   */
+  template <typename SampleSink>
+  auto ReadSamplesWithSink(SizeType const max_samples, SampleSink&& sample_sink) noexcept -> ReadSamplesResult {
+    if (subscriber_ == nullptr) {
+      constexpr char const* error_message{"ReadSamples() called while not being subscribed!"};
+      logger_.TerminateOnViolation(  // COV_IpcBinding_CodeCoverageComponentOverall_logger_call_in_terminating_branch
+          error_message, [](::ara::log::LogStream& s) { s << error_message; },
+          Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
+    }
+
+    ::ara::com::ComErrorDomain::SupportDataType const no_support_data_provided{0};
+    ReadSamplesResult result{ReadSamplesResult::FromError(
+        ::ara::com::MakeErrorCode(::ara::com::ComErrc::kMaxSamplesReached, no_support_data_provided,
+                                  "Application holds more SamplePtrs than committed in Subscribe"))};
+
+    // VCA_IPCB_VALID_SAMPLE_CACHE_POINTER_ACCESS
+    if (visible_sample_cache_->GetFreeSampleCount() > 0) {
+      SizeType valid_events_processed{0};
+
+      SampleCacheContainer& invisible_app_cache_container{invisible_sample_cache_.GetSamples(max_samples)};
+
+      // Note: the returned cache might have size equal, greater
+      // than or less than max_samples.
+      // In case more samples than requested exist, do not
+      // process the additional samples
+
+      if (!invisible_app_cache_container.empty()) {
+        valid_events_processed = ReadSamplesInternal(invisible_app_cache_container, max_samples, sample_sink);
+      } else {  // No samples were available in invisible cache
+        logger_.LogVerbose(
+            [](::ara::log::LogStream& s) { s << "No new samples available in invisible sample cache to process."; },
+            Logger::LogLocation{static_cast<char const*>(__func__), __LINE__});
+      }
+      result.EmplaceValue(valid_events_processed);
+    }
+    return result;
+  }
+
   /*!
    * \brief Reads serialized samples from the given sample cache container, deserializes them and calls the provided
    *        callback function.
    *
+   * \tparam SampleSink  Callable with the signature void(SampleData&&).
+   *
    * \param[in] invisible_app_cache_container  Container which has the enqueued event samples cache entries.
    * \param[in] max_samples                    Maximum number of samples to process.
-   * \param[in] callable_sample_result         Callable to be invoked on successful deserialization.
+   * \param[in] sample_sink                    Sink with the signature void(SampleData&&) to be invoked on successful
+   *                                           deserialization.
    *
    * \return The number of event samples which were successfully deserialized and processed.
    *
@@ -993,15 +1068,16 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
    *     - If deserialization is successful.
    *       - Increase the number of successfully processed events.
    *       - Notify the trace sink of the ReadSample call.
-   *       - Invoke callable_sample_result with wrapped, deserialized sample, the e2e check status and time stamp.
+   *       - Invoke sample_sink with wrapped, deserialized sample, the e2e check status and time stamp.
    *     - Otherwise
    *       - Return the visible cache slot.
    *   - Otherwise
    *     - Stop further processing of samples.
    * \endinternal
    */
+  template <typename SampleSink>
   auto ReadSamplesInternal(SampleCacheContainer& invisible_app_cache_container, std::size_t const max_samples,
-                           CallableReadSamplesResult const& callable_sample_result) const noexcept -> std::size_t {
+                           SampleSink& sample_sink) const noexcept -> std::size_t {
     std::size_t nr_valid_events_processed{0U};
     std::size_t const samples_to_process{std::min(max_samples, invisible_app_cache_container.size())};
 
@@ -1027,7 +1103,7 @@ class ProxyEventXfBackend final : public ::amsr::socal::internal::events::ProxyE
               ::ara::com::E2E_state_machine::E2ECheckStatus::NotAvailable};
           ::amsr::core::Optional<TimeStamp> const timestamp{TimeStamp{}};
           // VCA_IPCB_EXTERNAL_SAFE_FUNCTION_WITH_PARAMETERS
-          callable_sample_result(typename ProxyEventBackendInterface::SampleData{
+          sample_sink(typename ProxyEventBackendInterface::SampleData{
               std::move(next_visible_cache_slot), visible_sample_cache_, check_status, timestamp});
         } else {
           // VCA_IPCB_VALID_SAMPLE_CACHE_POINTER_ACCESS
@@ -487,7 +487,7 @@ class SkeletonEventXfBackend final : public ::amsr::socal::internal::events::Ske
     NotificationMessageHeader const header{provided_service_instance_id_.ServiceId(),
                                            provided_service_instance_id_.InstanceId(),
                                            provided_service_instance_id_.MajorVersion(), event_id_, session_id};
-    NotificationMessage notification_msg{header, ipc_protocol::IpcPacketSharedConstruct(packet_size)};
+    NotificationMessage notification_msg{header, ipc_protocol::IpcPacketSharedConstructFromPool(packet_size)};
 
     ::amsr::someip_protocol::internal::serialization::Writer writer{*notification_msg.GetPacket()};
 
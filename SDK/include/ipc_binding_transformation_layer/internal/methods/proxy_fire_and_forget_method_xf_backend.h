@@ -334,7 +334,7 @@ auto ProxyFireAndForgetMethodXfBackend<RequestSerializer, InputArgsT...>::Handle
     std::size_t const alloc_size{ipc_protocol::kProtocolMessageHeaderLength +
                                  ipc_protocol::kRequestNoReturnMessageHeaderLength + payload_size};
     // Creation of a buffer to serialize the generic protocol header, the request header and the payload.
-    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstruct(alloc_size)};
+    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstructFromPool(alloc_size)};
 
     ::amsr::someip_protocol::internal::serialization::BufferView const body_view{*packet};
     ::amsr::someip_protocol::internal::serialization::Writer writer{body_view};
@@ -24,6 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -112,6 +113,9 @@ class ProxyMethodXfBackend final
    *                                          must be reset. If the value is not set explicitly then the wrap around of
    *                                          session will happen when usual max limit of the SessionId::type is
    *                                          reached.
+   * \param[in] pending_request_slot_capacity Number of outstanding requests the pending request map stores in its
+   *                                          lock-free slot table. Further outstanding requests are stored in its
+   *                                          mutex protected overflow map. Must not be zero.
    *
    * \pre     Proxy router pointer must be valid for the whole lifetime of the ProxyMethodXfBackend.
    * \context App
@@ -121,7 +125,8 @@ class ProxyMethodXfBackend final
                        std::unique_ptr<TraceMethodSinkInterface> trace_sink,  // IGNORE_BLACKLIST BSOCIAL-8805
                        ProxyRouterInterface& proxy_router,
                        ApplicationErrorBuilder::ApplicationErrorMap application_errors,
-                       ::amsr::ipc_binding_core::internal::ipc_protocol::SessionId::type max_limit_session = 0) noexcept
+                       ::amsr::ipc_binding_core::internal::ipc_protocol::SessionId::type max_limit_session = 0,
+                       std::size_t pending_request_slot_capacity = PendingRequestMap::kDefaultSlotCapacity) noexcept
       : ::amsr::ipc_binding_core::internal::ProxyMethodBackendInterface{},
         // () is used to initialize the base class to suppress doxygen issue.
         ::amsr::socal::internal::methods::ProxyMethodBackendInterface<Output, InputArgsT...>(),
@@ -133,7 +138,8 @@ class ProxyMethodXfBackend final
         client_id_{client_id},
         method_id_{method_id},
         trace_sink_{std::move(trace_sink)},                                   // VCA_IPCB_VALID_TRACE_SINK
-        pending_request_map_{amsr::MakeShared<PendingRequestMap>().Value()},  // VCA_IPCB_MAKE_SHARED_SAFE_FUNCTION
+        // VCA_IPCB_MAKE_SHARED_SAFE_FUNCTION
+        pending_request_map_{amsr::MakeShared<PendingRequestMap>(pending_request_slot_capacity).Value()},
         proxy_router_{proxy_router},
         // VCA_IPCB_VALID_TRACE_SINK
         request_handler_{logger_,      pending_request_map_, provided_service_instance_id,
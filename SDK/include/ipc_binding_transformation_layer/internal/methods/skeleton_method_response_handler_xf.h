@@ -163,7 +163,7 @@ class SkeletonMethodResponseHandlerXf final
                                  ipc_protocol::kResponseMessageHeaderLength + payload_size};
 
     // Creation of a buffer to serialize the generic protocol header, the request header and the payload.
-    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstruct(alloc_size)};
+    ipc_protocol::IpcPacketShared packet{ipc_protocol::IpcPacketSharedConstructFromPool(alloc_size)};
     someip_marshalling::Writer writer{someip_marshalling::BufferView{*packet}};
 
     // Serialize IPC response message header
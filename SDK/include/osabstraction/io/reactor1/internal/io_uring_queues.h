@@ -0,0 +1,417 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  libosabstraction-linux/include/osabstraction/io/reactor1/internal/io_uring_queues.h
+ *        \brief  Thin wrapper around the submission and completion queues of a Linux io_uring instance.
+ *        \unit   osabstraction::IoUringReactor1_Linux
+ *
+ *      \details  The io_uring system calls are used directly (no liburing dependency). Only the subset required by
+ *                IoUringReactor1 is provided.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_INTERNAL_IO_URING_QUEUES_H_
+#define LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_INTERNAL_IO_URING_QUEUES_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "amsr/core/result.h"
+#include "osabstraction/internal/errors.h"
+#include "osabstraction/io/file_descriptor.h"
+#include "osabstraction/osab_error_domain.h"
+
+namespace osabstraction {
+namespace io {
+namespace reactor1 {
+namespace internal {
+
+/*!
+ * \brief   io_uring features that are mandatory for IoUringReactor1.
+ *
+ * \details - IORING_FEAT_SINGLE_MMAP: SQ and CQ ring share one mapping (Linux 5.4).
+ *          - IORING_FEAT_NODROP: Completions are never dropped on CQ overflow (Linux 5.5).
+ *          - IORING_FEAT_EXT_ARG: io_uring_enter() accepts a timeout (Linux 5.11).
+ */
+constexpr std::uint32_t kIoUringRequiredFeatures{IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG};
+
+/*!
+ * \brief   Wraps the io_uring_setup() system call.
+ *
+ * \param[in]     entries Requested number of submission queue entries.
+ * \param[in,out] params  Setup parameters; filled with the ring layout by the kernel.
+ *
+ * \return  The io_uring file descriptor or -1 on failure (errno is set).
+ */
+inline int IoUringSetup(std::uint32_t entries, struct io_uring_params* params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+/*!
+ * \brief   Wraps the io_uring_enter() system call.
+ *
+ * \param[in] ring_fd      io_uring file descriptor.
+ * \param[in] to_submit    Number of SQEs to submit.
+ * \param[in] min_complete Minimum number of completions to wait for.
+ * \param[in] flags        IORING_ENTER_* flags.
+ * \param[in] arg          Extended argument (only with IORING_ENTER_EXT_ARG), may be nullptr.
+ * \param[in] arg_size     Size of arg.
+ *
+ * \return  Number of consumed SQEs or -1 on failure (errno is set).
+ */
+inline int IoUringEnter(int ring_fd, std::uint32_t to_submit, std::uint32_t min_complete, std::uint32_t flags,
+                        void const* arg, std::size_t arg_size) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, arg, arg_size));
+}
+
+/*!
+ * \brief   Wraps the io_uring_register() system call.
+ *
+ * \param[in] ring_fd  io_uring file descriptor.
+ * \param[in] opcode   IORING_REGISTER_* opcode.
+ * \param[in] arg      Opcode specific argument.
+ * \param[in] nr_args  Opcode specific argument count.
+ *
+ * \return  Opcode specific return value or -1 on failure (errno is set).
+ */
+inline int IoUringRegister(int ring_fd, std::uint32_t opcode, void const* arg, std::uint32_t nr_args) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+/*!
+ * \brief   Completion queue entry copied out of the shared CQ ring.
+ */
+struct IoUringCompletion {
+  /*!
+   * \brief User data of the SQE that caused this completion.
+   */
+  std::uint64_t user_data;
+
+  /*!
+   * \brief Result of the operation (negative errno on failure).
+   */
+  std::int32_t res;
+
+  /*!
+   * \brief IORING_CQE_F_* flags.
+   */
+  std::uint32_t flags;
+};
+
+/*!
+ * \brief    Owns the memory mappings of the submission and completion queues of one io_uring instance.
+ *
+ * \details  The object is not threadsafe. The submission side must be serialized by the user, the completion side
+ *           must only be consumed by one thread.
+ *
+ * \vprivate pes internal API
+ */
+class IoUringQueues final {
+ public:
+  /*!
+   * \brief       Sets up an io_uring instance and maps its queues.
+   *
+   * \param[in]   sq_entries  Requested number of submission queue entries. The kernel rounds it up to a power of two.
+   * \param[in]   cq_entries  Requested number of completion queue entries. Must be at least sq_entries.
+   *
+   * \return      The set up queues.
+   *
+   * \error       osabstraction::OsabErrc::kResource    Not enough system resources to create the io_uring instance.
+   * \error       osabstraction::OsabErrc::kApiError    The kernel does not support io_uring or lacks one of the
+   *                                                    features in kIoUringRequiredFeatures.
+   *
+   * \context     ANY
+   * \pre         -
+   * \reentrant   TRUE
+   * \synchronous TRUE
+   * \threadsafe  TRUE
+   * \steady      FALSE
+   *
+   * \vprivate    pes internal API
+   */
+  static ::amsr::core::Result<IoUringQueues> Create(std::uint32_t sq_entries, std::uint32_t cq_entries) noexcept {
+    ::amsr::core::Result<IoUringQueues> result{MakeErrorCode(OsabErrc::kResource, "io_uring_setup() failed.")};
+    struct io_uring_params params {};
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+    params.cq_entries = cq_entries;
+
+    int const ring_fd{IoUringSetup(sq_entries, &params)};
+    if (::osabstraction::internal::HasSystemCallFailed(ring_fd)) {
+      ::osabstraction::internal::OsErrorNumber const error{::osabstraction::internal::GetErrorNumber()};
+      if ((error.value == ENOSYS) || (error.value == EPERM) || (error.value == EINVAL)) {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kApiError, error.value, "io_uring is not supported."));
+      } else {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kResource, error.value, "io_uring_setup() failed."));
+      }
+    } else {
+      IoUringQueues queues{FileDescriptor{ring_fd}, params};
+      if ((params.features & kIoUringRequiredFeatures) != kIoUringRequiredFeatures) {
+        result.EmplaceError(
+            MakeErrorCode(OsabErrc::kApiError, "io_uring of the running kernel lacks mandatory features."));
+      } else if (queues.Map()) {
+        result.EmplaceValue(std::move(queues));
+      } else {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kResource, ::osabstraction::internal::GetErrorNumber().value,
+                                          "Mapping io_uring queues failed."));
+      }
+    }
+    return result;
+  }
+
+  IoUringQueues() = delete;
+  IoUringQueues(IoUringQueues const&) = delete;
+  IoUringQueues& operator=(IoUringQueues const&) = delete;
+  IoUringQueues& operator=(IoUringQueues&&) = delete;
+
+  /*!
+   * \brief       Move constructs the queues. The moved from object does not own any mapping afterwards.
+   *
+   * \param[in]   other Queues to move from.
+   *
+   * \steady      FALSE
+   */
+  IoUringQueues(IoUringQueues&& other) noexcept
+      : ring_fd_{std::move(other.ring_fd_)},
+        params_{other.params_},
+        ring_{std::exchange(other.ring_, nullptr)},
+        ring_size_{std::exchange(other.ring_size_, 0U)},
+        sqes_{std::exchange(other.sqes_, nullptr)},
+        sqes_size_{std::exchange(other.sqes_size_, 0U)},
+        sq_head_{other.sq_head_},
+        sq_tail_{other.sq_tail_},
+        sq_mask_{other.sq_mask_},
+        sq_array_{other.sq_array_},
+        cq_head_{other.cq_head_},
+        cq_tail_{other.cq_tail_},
+        cq_mask_{other.cq_mask_},
+        cqes_{other.cqes_} {}
+
+  /*!
+   * \brief       Unmaps the queues. The io_uring file descriptor is closed by its FileDescriptor member.
+   *
+   * \steady      FALSE
+   */
+  ~IoUringQueues() noexcept {
+    if (sqes_ != nullptr) {
+      static_cast<void>(::munmap(sqes_, sqes_size_));
+    }
+    if (ring_ != nullptr) {
+      static_cast<void>(::munmap(ring_, ring_size_));
+    }
+  }
+
+  /*!
+   * \brief   Returns the io_uring file descriptor.
+   * \return  The io_uring file descriptor.
+   * \steady  TRUE
+   */
+  NativeHandle GetRingFd() const noexcept { return ring_fd_.Get(); }
+
+  /*!
+   * \brief   Returns the number of entries of the completion queue.
+   * \return  Number of CQ entries.
+   * \steady  TRUE
+   */
+  std::uint32_t GetCqEntries() const noexcept { return params_.cq_entries; }
+
+  /*!
+   * \brief       Acquires the next free submission queue entry.
+   *
+   * \details     The entry is zero initialized. It becomes visible to the kernel with the next io_uring_enter() call.
+   *
+   * \return      Pointer to the SQE or nullptr if the submission queue is full.
+   *
+   * \context     ANY
+   * \pre         Access to the submission side is serialized by the caller.
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \threadsafe  FALSE
+   * \steady      TRUE
+   */
+  struct io_uring_sqe* AcquireSqe() noexcept {
+    struct io_uring_sqe* sqe{nullptr};
+    std::uint32_t const head{Load(sq_head_, std::memory_order_acquire)};
+    std::uint32_t const tail{Load(sq_tail_, std::memory_order_relaxed)};
+    if ((tail - head) < params_.sq_entries) {
+      std::uint32_t const index{tail & *sq_mask_};
+      sqe = &sqes_[index];
+      static_cast<void>(std::memset(sqe, 0, sizeof(struct io_uring_sqe)));
+      sq_array_[index] = index;
+      Store(sq_tail_, tail + 1U, std::memory_order_release);
+    }
+    return sqe;
+  }
+
+  /*!
+   * \brief       Copies all available completions out of the completion queue and releases the CQ slots.
+   *
+   * \param[out]  completions Buffer for the completions. Must be able to hold GetCqEntries() elements.
+   *
+   * \return      Number of copied completions.
+   *
+   * \context     HandleEvents()
+   * \pre         -
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \threadsafe  FALSE
+   * \steady      TRUE
+   */
+  std::uint32_t ReapCompletions(IoUringCompletion* completions) noexcept {
+    std::uint32_t head{Load(cq_head_, std::memory_order_relaxed)};
+    std::uint32_t const tail{Load(cq_tail_, std::memory_order_acquire)};
+    std::uint32_t count{0};
+    while (head != tail) {
+      struct io_uring_cqe const& cqe{cqes_[head & *cq_mask_]};
+      completions[count] = IoUringCompletion{cqe.user_data, cqe.res, cqe.flags};
+      ++count;
+      ++head;
+    }
+    Store(cq_head_, head, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  /*!
+   * \brief       Constructs the queues object for an already set up io_uring instance.
+   * \param[in]   ring_fd  io_uring file descriptor.
+   * \param[in]   params   Parameters returned by io_uring_setup().
+   * \steady      FALSE
+   */
+  IoUringQueues(FileDescriptor ring_fd, struct io_uring_params const& params) noexcept
+      : ring_fd_{std::move(ring_fd)}, params_(params) {}
+
+  /*!
+   * \brief   Maps SQ/CQ ring and the SQE array into the address space.
+   * \return  true on success, false otherwise (errno is set).
+   * \steady  FALSE
+   */
+  bool Map() noexcept {
+    std::size_t const sq_ring_size{params_.sq_off.array + (params_.sq_entries * sizeof(std::uint32_t))};
+    std::size_t const cq_ring_size{params_.cq_off.cqes + (params_.cq_entries * sizeof(struct io_uring_cqe))};
+    std::size_t const ring_size{(sq_ring_size > cq_ring_size) ? sq_ring_size : cq_ring_size};
+    std::size_t const sqes_size{params_.sq_entries * sizeof(struct io_uring_sqe)};
+    bool success{false};
+
+    void* const ring{::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_.Get(),
+                            IORING_OFF_SQ_RING)};
+    if (ring != MAP_FAILED) {
+      ring_ = ring;
+      ring_size_ = ring_size;
+      void* const sqes{::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_.Get(),
+                              IORING_OFF_SQES)};
+      if (sqes != MAP_FAILED) {
+        sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+        sqes_size_ = sqes_size;
+        // VECTOR Next Line AutosarC++17_10-M5.2.8: MD_OSA_M5.2.8_StaticCastVoidPointerToBytePointer
+        std::uint8_t* const base{static_cast<std::uint8_t*>(ring_)};
+        // VECTOR Disable AutosarC++17_10-A5.2.4: MD_OSA_A5.2.4_MemoryTypedViewReinterpretCast
+        sq_head_ = reinterpret_cast<std::uint32_t*>(base + params_.sq_off.head);
+        sq_tail_ = reinterpret_cast<std::uint32_t*>(base + params_.sq_off.tail);
+        sq_mask_ = reinterpret_cast<std::uint32_t*>(base + params_.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<std::uint32_t*>(base + params_.sq_off.array);
+        cq_head_ = reinterpret_cast<std::uint32_t*>(base + params_.cq_off.head);
+        cq_tail_ = reinterpret_cast<std::uint32_t*>(base + params_.cq_off.tail);
+        cq_mask_ = reinterpret_cast<std::uint32_t*>(base + params_.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<struct io_uring_cqe*>(base + params_.cq_off.cqes);
+        // VECTOR Enable AutosarC++17_10-A5.2.4
+        success = true;
+      }
+    }
+    return success;
+  }
+
+  /*!
+   * \brief   Atomically loads a ring index shared with the kernel.
+   * \param[in] index  Pointer to the index.
+   * \param[in] order  Memory order.
+   * \return  The loaded value.
+   * \steady  TRUE
+   */
+  static std::uint32_t Load(std::uint32_t const* index, std::memory_order order) noexcept {
+    return __atomic_load_n(index, (order == std::memory_order_acquire) ? __ATOMIC_ACQUIRE : __ATOMIC_RELAXED);
+  }
+
+  /*!
+   * \brief   Atomically stores a ring index shared with the kernel.
+   * \param[in] index  Pointer to the index.
+   * \param[in] value  Value to store.
+   * \param[in] order  Memory order.
+   * \steady  TRUE
+   */
+  static void Store(std::uint32_t* index, std::uint32_t value, std::memory_order order) noexcept {
+    __atomic_store_n(index, value, (order == std::memory_order_release) ? __ATOMIC_RELEASE : __ATOMIC_RELAXED);
+  }
+
+  /*!
+   * \brief io_uring file descriptor.
+   */
+  FileDescriptor ring_fd_;
+
+  /*!
+   * \brief Parameters returned by io_uring_setup().
+   */
+  struct io_uring_params params_;
+
+  /*!
+   * \brief Shared mapping of SQ and CQ ring.
+   */
+  void* ring_{nullptr};
+
+  /*!
+   * \brief Size of the ring mapping.
+   */
+  std::size_t ring_size_{0};
+
+  /*!
+   * \brief Mapping of the SQE array.
+   */
+  struct io_uring_sqe* sqes_{nullptr};
+
+  /*!
+   * \brief Size of the SQE array mapping.
+   */
+  std::size_t sqes_size_{0};
+
+  /*! \brief SQ head index (written by kernel). */
+  std::uint32_t* sq_head_{nullptr};
+  /*! \brief SQ tail index (written by user). */
+  std::uint32_t* sq_tail_{nullptr};
+  /*! \brief SQ ring mask. */
+  std::uint32_t* sq_mask_{nullptr};
+  /*! \brief SQ index array. */
+  std::uint32_t* sq_array_{nullptr};
+  /*! \brief CQ head index (written by user). */
+  std::uint32_t* cq_head_{nullptr};
+  /*! \brief CQ tail index (written by kernel). */
+  std::uint32_t* cq_tail_{nullptr};
+  /*! \brief CQ ring mask. */
+  std::uint32_t* cq_mask_{nullptr};
+  /*! \brief CQE array. */
+  struct io_uring_cqe* cqes_{nullptr};
+};
+
+}  // namespace internal
+}  // namespace reactor1
+}  // namespace io
+}  // namespace osabstraction
+
+#endif  // LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_INTERNAL_IO_URING_QUEUES_H_
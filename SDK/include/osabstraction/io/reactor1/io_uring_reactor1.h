@@ -0,0 +1,1181 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  libosabstraction-linux/include/osabstraction/io/reactor1/io_uring_reactor1.h
+ *        \brief  io_uring based implementation of the Reactor1 interface for Linux.
+ *        \unit   osabstraction::IoUringReactor1_Linux
+ *
+ *      \details  Alternative to the epoll based Reactor1. All IO sources are added to the fixed file table of the
+ *                io_uring instance and monitored with poll requests. Poll requests that completed are re-armed in a
+ *                batch together with waiting for the next completions, so one HandleEvents() iteration costs exactly
+ *                one io_uring_enter() system call independent of the number of ready IO sources. The unblock eventfd
+ *                is drained by an asynchronous read request so no extra read() system call is needed to unblock.
+ *
+ *                Poll requests are one-shot and are re-armed after the callback has been executed. This keeps the
+ *                level-triggered semantic of the epoll based Reactor1: a callback that does not consume all data is
+ *                called again in the next iteration. Users (amsr::net sockets, amsr::ipc, steady timer) therefore do
+ *                not need to be changed.
+ *
+ *                The kernel must support io_uring with the features listed in internal::kIoUringRequiredFeatures
+ *                (Linux 5.11 or newer). Preconstruct() reports kApiError otherwise and the user shall fall back to
+ *                Reactor1.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_IO_URING_REACTOR1_H_
+#define LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_IO_URING_REACTOR1_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "amsr/core/result.h"
+#include "ara/core/vector.h"
+#include "osabstraction/internal/errors.h"
+#include "osabstraction/io/file_descriptor.h"
+#include "osabstraction/io/reactor1/internal/io_uring_queues.h"
+#include "osabstraction/io/reactor1/reactor1_interface.h"
+#include "osabstraction/osab_error_domain.h"
+
+namespace osabstraction {
+namespace io {
+namespace reactor1 {
+
+namespace internal {
+
+/*!
+ * \brief Maximum number of callbacks an IoUringReactor1 can handle.
+ */
+constexpr std::uint16_t kIoUringMaxNumCallbacks{8191};
+
+/*!
+ * \brief   Callback entry index used in the user data of requests whose completions are ignored.
+ * \details Used for poll remove requests.
+ */
+constexpr std::uint16_t kIoUringIgnoredIndex{0xFFFEU};
+
+/*!
+ * \brief Callback entry index used in the user data of the unblock eventfd read request.
+ */
+constexpr std::uint16_t kIoUringUnblockIndex{0xFFFFU};
+
+/*!
+ * \brief   Packs a callback handle.
+ * \details Bits 0-15 hold the entry index, bits 16-63 the sequence number of the entry.
+ * \param[in] index         Index of the callback entry.
+ * \param[in] sequence_num  Sequence number of the callback entry.
+ * \return  Packed callback handle.
+ */
+inline CallbackHandle PackIoUringCallbackHandle(std::uint16_t index, std::uint64_t sequence_num) noexcept {
+  return (sequence_num << 16U) | static_cast<std::uint64_t>(index);
+}
+
+/*!
+ * \brief   Extracts the entry index of a callback handle.
+ * \param[in] handle  Packed callback handle.
+ * \return  Entry index.
+ */
+inline std::uint16_t IoUringCallbackHandleIndex(CallbackHandle handle) noexcept {
+  return static_cast<std::uint16_t>(handle & 0xFFFFU);
+}
+
+/*!
+ * \brief   Extracts the sequence number of a callback handle.
+ * \param[in] handle  Packed callback handle.
+ * \return  Sequence number.
+ */
+inline std::uint64_t IoUringCallbackHandleSequenceNum(CallbackHandle handle) noexcept { return handle >> 16U; }
+
+/*!
+ * \brief   Packs the user data of a poll request.
+ * \details Bits 0-15 hold the entry index, bits 16-31 the arm generation and bits 32-63 the lower part of the sequence
+ *          number. Completions of requests that were armed for an older registration or an older event mask are
+ *          recognized by a mismatch and dropped.
+ * \param[in] index         Index of the callback entry.
+ * \param[in] generation    Arm generation of the callback entry.
+ * \param[in] sequence_num  Sequence number of the callback entry.
+ * \return  Packed user data.
+ */
+inline std::uint64_t PackIoUringUserData(std::uint16_t index, std::uint16_t generation,
+                                         std::uint64_t sequence_num) noexcept {
+  return ((sequence_num & 0xFFFFFFFFU) << 32U) | (static_cast<std::uint64_t>(generation) << 16U) |
+         static_cast<std::uint64_t>(index);
+}
+
+/*!
+ * \brief   Structure for storing a callback of the IoUringReactor1.
+ *
+ * \details An entry is unused if both flags valid and in_callback are false.
+ */
+struct IoUringCallbackEntry {
+  /*!
+   * \brief File descriptor for which the callback is registered.
+   */
+  NativeHandle io_source{kInvalidNativeHandle};
+
+  /*!
+   * \brief Registered event types.
+   */
+  EventTypes registered_events{};
+
+  /*!
+   * \brief Callback function object.
+   */
+  CallbackType callback;
+
+  /*!
+   * \brief Flag that shows if the callback is valid.
+   */
+  bool valid{false};
+
+  /*!
+   * \brief Flag that shows if the entry is registered for a software event.
+   */
+  bool software_event{false};
+
+  /*!
+   * \brief Flag that shows if a software event has been triggered but not yet executed.
+   */
+  bool triggered{false};
+
+  /*!
+   * \brief Flag that shows if the callback is currently executing.
+   */
+  bool in_callback{false};
+
+  /*!
+   * \brief Flag that shows if a poll request is outstanding for the IO source.
+   */
+  bool armed{false};
+
+  /*!
+   * \brief Flag that shows if the IO source shall be closed once the callback has returned.
+   */
+  bool close_on_release{false};
+
+  /*!
+   * \brief   Arm generation.
+   * \details Increased whenever an outstanding poll request is cancelled.
+   */
+  std::uint16_t arm_generation{0};
+
+  /*!
+   * \brief   Sequence number of the callback entry.
+   * \details Increased every time a new callback is registered in this entry.
+   */
+  std::uint64_t sequence_num{0};
+
+  /*!
+   * \brief Mutex that protects the callback entry.
+   */
+  mutable std::mutex mutex;
+};
+
+}  // namespace internal
+
+// VECTOR Next Construct Metric-OO.WMC.One: MD_OSA_Metric-OO.WMC.One_Reactor
+/*!
+ * \brief    io_uring based implementation of the Reactor1 interface for Linux.
+ *
+ * \details  Drop-in replacement for Reactor1 with the same threadsafety guarantees. All functions of
+ *           Reactor1Interface may be called from any thread and from callbacks.
+ *
+ * \vprivate pes internal API
+ */
+class IoUringReactor1 final : public Reactor1Interface {
+ public:
+  /*!
+   * \brief    Construction token for IoUringReactor1.
+   *
+   * \details  By creating a ConstructionToken the resources for an IoUringReactor1 object are acquired so that the
+   *           IoUringReactor1 constructor can be exceptionless.
+   *
+   * \vprivate pes internal API
+   */
+  class ConstructionToken final {
+   public:
+    /*!
+     * \brief       Builds a ConstructionToken from the preconstructed resources.
+     *
+     * \param[in]   num_callbacks    Number of callbacks that the reactor should be able to handle.
+     * \param[in]   queues           Set up io_uring instance.
+     * \param[in]   unblock_event_fd Handle for the unblock eventfd instance.
+     *
+     * \context     IoUringReactor1::Preconstruct()
+     * \pre         -
+     * \reentrant   TRUE for different objects
+     * \synchronous TRUE
+     * \threadsafe  FALSE
+     * \steady      TRUE
+     *
+     * \vprivate    pes internal API
+     */
+    ConstructionToken(std::uint16_t num_callbacks, internal::IoUringQueues&& queues,
+                      FileDescriptor unblock_event_fd) noexcept
+        : num_callbacks_{num_callbacks}, queues_{std::move(queues)}, unblock_event_fd_{std::move(unblock_event_fd)} {}
+
+    ConstructionToken() = delete;
+    ConstructionToken(ConstructionToken const&) = delete;
+    ConstructionToken& operator=(ConstructionToken const&) = delete;
+    ConstructionToken& operator=(ConstructionToken&&) = delete;
+
+    /*!
+     * \brief       Move constructs a ConstructionToken.
+     * \param[in]   other   ConstructionToken that should be move constructed.
+     * \steady      TRUE
+     * \vprivate    pes internal API
+     */
+    ConstructionToken(ConstructionToken&& other) noexcept = default;
+
+    /*!
+     * \brief Releases not extracted resources.
+     * \steady FALSE
+     */
+    ~ConstructionToken() noexcept = default;
+
+    /*!
+     * \brief   Get number of callbacks.
+     * \return  Number of callbacks.
+     * \steady  TRUE
+     */
+    std::uint16_t GetNumCallbacks() const noexcept { return num_callbacks_; }
+
+    /*!
+     * \brief   Extract the io_uring queues. The token does not own them anymore after calling this function.
+     * \return  io_uring queues.
+     * \steady  TRUE
+     */
+    internal::IoUringQueues ExtractQueues() noexcept { return std::move(queues_); }
+
+    /*!
+     * \brief   Extract the unblock eventfd. The token does not own it anymore after calling this function.
+     * \return  Unblock eventfd.
+     * \steady  TRUE
+     */
+    FileDescriptor ExtractUnblockEventFd() noexcept { return std::move(unblock_event_fd_); }
+
+   private:
+    /*!
+     * \brief Number of callbacks the reactor should be able to handle.
+     */
+    std::uint16_t num_callbacks_;
+
+    /*!
+     * \brief io_uring instance.
+     */
+    internal::IoUringQueues queues_;
+
+    /*!
+     * \brief Handle for the unblock eventfd.
+     */
+    FileDescriptor unblock_event_fd_;
+  };
+
+  /*!
+   * \brief       Creates an IoUringReactor1 construction token.
+   *
+   * \details     If Preconstruct() returns an error, the user message describes which system call failed and the
+   *              support data is set to the POSIX error code of the failed system call.
+   *
+   * \param[in]   num_callbacks     Number of callbacks that the reactor should be able to handle. Valid range: 0 to
+   *                                8191.
+   *
+   * \return      Created ConstructionToken.
+   *
+   * \error       osabstraction::OsabErrc::kResource    Required resources could not be allocated.
+   * \error       osabstraction::OsabErrc::kApiError    num_callbacks is out of range, or io_uring is not available
+   *                                                    or lacks required features. In the latter case the epoll
+   *                                                    based Reactor1 shall be used instead.
+   *
+   * \context     ANY
+   * \pre         -
+   * \reentrant   FALSE
+   * \synchronous TRUE
+   * \threadsafe  TRUE
+   * \steady      FALSE
+   *
+   * \vprivate    pes internal API
+   */
+  static ::amsr::core::Result<ConstructionToken> Preconstruct(std::uint16_t num_callbacks) noexcept {
+    // Every callback has at most one outstanding poll request and one outstanding poll remove request, the unblock
+    // eventfd has one outstanding read request.
+    std::uint32_t const max_in_flight{(2U * static_cast<std::uint32_t>(num_callbacks)) + 2U};
+    return (num_callbacks > internal::kIoUringMaxNumCallbacks)
+               ? ::amsr::core::Result<ConstructionToken>{MakeErrorCode(
+                     OsabErrc::kApiError, "Number of callbacks exceeds the maximum of IoUringReactor1.")}
+               : internal::IoUringQueues::Create(max_in_flight, 2U * max_in_flight)
+                     .AndThen([num_callbacks](internal::IoUringQueues&& queues)
+                                  -> ::amsr::core::Result<ConstructionToken> {
+                       return CreateToken(num_callbacks, queues);
+                     });
+  }
+
+  /*!
+   * \brief       Constructs an IoUringReactor1.
+   *
+   * \param[in]   token    Construction token used to create the reactor.
+   *
+   * \context     ANY
+   * \pre         -
+   * \reentrant   TRUE for different ConstructionTokens
+   * \synchronous TRUE
+   * \threadsafe  FALSE
+   * \steady      FALSE
+   *
+   * \vprivate    pes internal API
+   */
+  explicit IoUringReactor1(ConstructionToken&& token) noexcept
+      : queues_{token.ExtractQueues()},
+        unblock_event_fd_{token.ExtractUnblockEventFd()},
+        callbacks_(token.GetNumCallbacks()),
+        completions_(queues_.GetCqEntries()) {
+    triggered_software_events_.reserve(callbacks_.size());
+    pending_software_events_.reserve(callbacks_.size());
+    {
+      std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+      static_cast<void>(FileUpdateLocked(UnblockFixedFileIndex(), unblock_event_fd_.Get()));
+      ArmUnblockReadLocked();
+      FlushSubmissionsLocked();
+    }
+  }
+
+  /*!
+   * \brief   Destroys the reactor. Closes the IO sources of callbacks that were unregistered with kCloseHandle.
+   * \steady  FALSE
+   */
+  ~IoUringReactor1() noexcept final = default;
+
+  IoUringReactor1(IoUringReactor1&&) = delete;
+  IoUringReactor1(IoUringReactor1 const&) = delete;
+  IoUringReactor1& operator=(IoUringReactor1&&) = delete;
+  IoUringReactor1& operator=(IoUringReactor1 const&) = delete;
+
+  /*!
+   * \copydoc Reactor1Interface::Register()
+   */
+  ::amsr::core::Result<CallbackHandle> Register(NativeHandle io_source, EventTypes events,
+                                                CallbackType&& callback) noexcept final {
+    ::amsr::core::Result<CallbackHandle> result{MakeErrorCode(OsabErrc::kResource, "No free callback entry.")};
+    if (events.HasSoftwareEvent() || (io_source == kInvalidNativeHandle)) {
+      result.EmplaceError(MakeErrorCode(OsabErrc::kApiError, "Invalid IO source or events."));
+    } else {
+      std::lock_guard<std::mutex> const registration_lock{registration_mutex_};
+      if (IsIoSourceRegisteredLocked(io_source)) {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kApiError, "A callback is already registered for the IO source."));
+      } else {
+        std::size_t const index{FindFreeEntryLocked()};
+        if (index < callbacks_.size()) {
+          internal::IoUringCallbackEntry& entry{callbacks_[index]};
+          std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+          std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+          ::amsr::core::Result<void> const update_result{
+              FileUpdateLocked(static_cast<std::uint32_t>(index), io_source)};
+          if (update_result.HasValue()) {
+            ++entry.sequence_num;
+            entry.io_source = io_source;
+            entry.registered_events = events;
+            entry.callback = std::move(callback);
+            entry.valid = true;
+            entry.software_event = false;
+            entry.close_on_release = false;
+            ArmPollLocked(static_cast<std::uint16_t>(index), entry);
+            FlushSubmissionsLocked();
+            result.EmplaceValue(internal::PackIoUringCallbackHandle(static_cast<std::uint16_t>(index),
+                                                                    entry.sequence_num));
+          } else {
+            result.EmplaceError(update_result.Error());
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::RegisterSoftwareEvent()
+   */
+  ::amsr::core::Result<CallbackHandle> RegisterSoftwareEvent(CallbackType&& callback) noexcept final {
+    ::amsr::core::Result<CallbackHandle> result{MakeErrorCode(OsabErrc::kResource, "No free callback entry.")};
+    std::lock_guard<std::mutex> const registration_lock{registration_mutex_};
+    std::size_t const index{FindFreeEntryLocked()};
+    if (index < callbacks_.size()) {
+      internal::IoUringCallbackEntry& entry{callbacks_[index]};
+      std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+      ++entry.sequence_num;
+      entry.io_source = kInvalidNativeHandle;
+      entry.registered_events = EventTypes{}.SetSoftwareEvent(true);
+      entry.callback = std::move(callback);
+      entry.valid = true;
+      entry.software_event = true;
+      entry.triggered = false;
+      result.EmplaceValue(internal::PackIoUringCallbackHandle(static_cast<std::uint16_t>(index), entry.sequence_num));
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::SetMonitoredEvents()
+   */
+  ::amsr::core::Result<void> SetMonitoredEvents(CallbackHandle callback_handle, EventTypes events) noexcept final {
+    return ModifyMonitoredEvents(callback_handle, [events](EventTypes) { return events; }, events);
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::AddMonitoredEvents()
+   */
+  ::amsr::core::Result<void> AddMonitoredEvents(CallbackHandle callback_handle, EventTypes events) noexcept final {
+    return ModifyMonitoredEvents(
+        callback_handle,
+        [events](EventTypes current) {
+          return current.SetReadEvent(current.HasReadEvent() || events.HasReadEvent())
+              .SetWriteEvent(current.HasWriteEvent() || events.HasWriteEvent())
+              .SetErrorEvent(current.HasErrorEvent() || events.HasErrorEvent());
+        },
+        events);
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::RemoveMonitoredEvents()
+   */
+  ::amsr::core::Result<void> RemoveMonitoredEvents(CallbackHandle callback_handle, EventTypes events) noexcept final {
+    return ModifyMonitoredEvents(
+        callback_handle,
+        [events](EventTypes current) {
+          return current.SetReadEvent(current.HasReadEvent() && (!events.HasReadEvent()))
+              .SetWriteEvent(current.HasWriteEvent() && (!events.HasWriteEvent()))
+              .SetErrorEvent(current.HasErrorEvent() && (!events.HasErrorEvent()));
+        },
+        events);
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::SetCallbackTarget()
+   */
+  ::amsr::core::Result<void> SetCallbackTarget(CallbackHandle callback_handle, CallbackType callback) noexcept final {
+    ::amsr::core::Result<void> result{MakeErrorCode(OsabErrc::kApiError, "Invalid callback handle.")};
+    internal::IoUringCallbackEntry* const entry{LookupEntry(callback_handle)};
+    if (entry != nullptr) {
+      std::lock_guard<std::mutex> const entry_lock{entry->mutex};
+      if (IsEntryMatching(*entry, callback_handle) && (!entry->in_callback)) {
+        entry->callback = std::move(callback);
+        result.EmplaceValue();
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::TriggerSoftwareEvent()
+   */
+  ::amsr::core::Result<void> TriggerSoftwareEvent(CallbackHandle callback_handle) noexcept final {
+    ::amsr::core::Result<void> result{MakeErrorCode(OsabErrc::kApiError, "Invalid software event callback handle.")};
+    internal::IoUringCallbackEntry* const entry{LookupEntry(callback_handle)};
+    if (entry != nullptr) {
+      bool newly_triggered{false};
+      {
+        std::lock_guard<std::mutex> const entry_lock{entry->mutex};
+        if (IsEntryMatching(*entry, callback_handle) && entry->software_event) {
+          result.EmplaceValue();
+          if (!entry->triggered) {
+            entry->triggered = true;
+            newly_triggered = true;
+            std::lock_guard<std::mutex> const triggered_lock{triggered_software_events_mutex_};
+            triggered_software_events_.push_back(callback_handle);
+          }
+        }
+      }
+      if (newly_triggered && (!IsThisThreadHandlingEvents())) {
+        UnblockInternal();
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::Unregister()
+   */
+  ::amsr::core::Result<void> Unregister(CallbackHandle callback_handle,
+                                        CloseOnUnregister close_file_handle) noexcept final {
+    ::amsr::core::Result<void> result{MakeErrorCode(OsabErrc::kApiError, "Invalid IO callback handle.")};
+    std::uint16_t const index{internal::IoUringCallbackHandleIndex(callback_handle)};
+    internal::IoUringCallbackEntry* const entry{LookupEntry(callback_handle)};
+    if (entry != nullptr) {
+      std::lock_guard<std::mutex> const entry_lock{entry->mutex};
+      if (IsEntryMatching(*entry, callback_handle) && (!entry->software_event)) {
+        std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+        CancelPollLocked(index, *entry);
+        entry->valid = false;
+        entry->close_on_release = (close_file_handle == CloseOnUnregister::kCloseHandle);
+        if (!entry->in_callback) {
+          ReleaseEntryLocked(index, *entry);
+        }
+        FlushSubmissionsLocked();
+        result.EmplaceValue();
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::UnregisterSoftwareEvent()
+   */
+  ::amsr::core::Result<void> UnregisterSoftwareEvent(CallbackHandle callback_handle) noexcept final {
+    ::amsr::core::Result<void> result{MakeErrorCode(OsabErrc::kApiError, "Invalid software event callback handle.")};
+    internal::IoUringCallbackEntry* const entry{LookupEntry(callback_handle)};
+    if (entry != nullptr) {
+      std::lock_guard<std::mutex> const entry_lock{entry->mutex};
+      if (IsEntryMatching(*entry, callback_handle) && entry->software_event) {
+        entry->valid = false;
+        entry->triggered = false;
+        if (!entry->in_callback) {
+          entry->callback = CallbackType{};
+        }
+        result.EmplaceValue();
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::IsInUse()
+   */
+  bool IsInUse(CallbackHandle callback_handle) const noexcept final {
+    bool in_use{false};
+    std::size_t const index{internal::IoUringCallbackHandleIndex(callback_handle)};
+    if (index < callbacks_.size()) {
+      internal::IoUringCallbackEntry const& entry{callbacks_[index]};
+      std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+      in_use = (entry.sequence_num == internal::IoUringCallbackHandleSequenceNum(callback_handle)) &&
+               (entry.valid || entry.in_callback);
+    }
+    return in_use;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::HandleEvents()
+   *
+   * \details     Pending poll re-arm requests are submitted with the same io_uring_enter() call that waits for the
+   *              next completions. Positive timeouts have nanosecond granularity.
+   */
+  ::amsr::core::Result<UnblockReason> HandleEvents(std::chrono::nanoseconds timeout) noexcept final {
+    handle_events_tid_.store(std::this_thread::get_id());
+    bool const software_events_handled{HandleSoftwareEvents()};
+    std::chrono::nanoseconds const effective_timeout{software_events_handled ? std::chrono::nanoseconds::zero()
+                                                                             : timeout};
+    ::amsr::core::Result<UnblockReason> result{WaitForCompletions(effective_timeout)};
+    if (result.HasValue()) {
+      std::uint32_t const num_completions{HandleCompletions()};
+      if (software_events_handled || (num_completions != 0U)) {
+        result.EmplaceValue(UnblockReason::kEventsHandledOrUnblock);
+      } else if (result.Value() == UnblockReason::kEventsHandledOrUnblock) {
+        // io_uring_enter() reports the number of submitted requests instead of -ETIME if requests were submitted.
+        result.EmplaceValue(UnblockReason::kTimeout);
+      } else {
+        // Keep kTimeout or kSignal.
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::HandleEventsLoop()
+   */
+  void HandleEventsLoop() noexcept final {
+    while (!external_unblock_request_.exchange(false)) {
+      ::amsr::core::Result<UnblockReason> const result{HandleEvents(kInfinity)};
+      if (!result.HasValue()) {
+        ::amsr::core::Abort("IoUringReactor1::HandleEventsLoop(): Unrecoverable io_uring error.");
+      }
+    }
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::Unblock()
+   */
+  void Unblock() noexcept final {
+    external_unblock_request_.store(true);
+    UnblockInternal();
+  }
+
+  /*!
+   * \copydoc Reactor1Interface::GetOsParameters()
+   */
+  OsParameters GetOsParameters() noexcept final { return OsParameters{}; }
+
+  /*!
+   * \copydoc Reactor1Interface::IsThisThreadHandlingEvents()
+   */
+  bool IsThisThreadHandlingEvents() noexcept final { return handle_events_tid_.load() == std::this_thread::get_id(); }
+
+ private:
+  /*!
+   * \brief   Creates the unblock eventfd and the fixed file table and builds the construction token.
+   * \param[in]     num_callbacks Number of callbacks that the reactor should be able to handle.
+   * \param[in,out] queues        Set up io_uring instance, moved into the token on success.
+   * \return  Created ConstructionToken.
+   * \error   osabstraction::OsabErrc::kResource Required resources could not be allocated.
+   */
+  static ::amsr::core::Result<ConstructionToken> CreateToken(std::uint16_t num_callbacks,
+                                                             internal::IoUringQueues& queues) noexcept {
+    ::amsr::core::Result<ConstructionToken> result{MakeErrorCode(OsabErrc::kResource)};
+    ara::core::Vector<int> const sparse_files(static_cast<std::size_t>(num_callbacks) + 1U, -1);
+    int const event_fd{::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)};
+    if (::osabstraction::internal::HasSystemCallFailed(event_fd)) {
+      result.EmplaceError(MakeErrorCode(OsabErrc::kResource, ::osabstraction::internal::GetErrorNumber().value,
+                                        "eventfd() failed."));
+    } else if (::osabstraction::internal::HasSystemCallFailed(
+                   internal::IoUringRegister(queues.GetRingFd(), IORING_REGISTER_FILES, sparse_files.data(),
+                                             static_cast<std::uint32_t>(sparse_files.size())))) {
+      FileDescriptor const closer{event_fd};
+      result.EmplaceError(MakeErrorCode(OsabErrc::kResource, ::osabstraction::internal::GetErrorNumber().value,
+                                        "Registering io_uring file table failed."));
+    } else {
+      result.EmplaceValue(num_callbacks, std::move(queues), FileDescriptor{event_fd});
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Returns the fixed file table index used for the unblock eventfd.
+   * \return  Fixed file index.
+   */
+  std::uint32_t UnblockFixedFileIndex() const noexcept { return static_cast<std::uint32_t>(callbacks_.size()); }
+
+  /*!
+   * \brief   Returns the callback entry a handle refers to if the index is in range.
+   * \param[in] callback_handle Callback handle.
+   * \return  Pointer to the entry or nullptr. The sequence number still needs to be checked under the entry lock.
+   */
+  internal::IoUringCallbackEntry* LookupEntry(CallbackHandle callback_handle) noexcept {
+    std::size_t const index{internal::IoUringCallbackHandleIndex(callback_handle)};
+    return (index < callbacks_.size()) ? &callbacks_[index] : nullptr;
+  }
+
+  /*!
+   * \brief   Checks that an entry holds a valid registration for the handle.
+   * \param[in] entry           Callback entry, locked by the caller.
+   * \param[in] callback_handle Callback handle.
+   * \return  true if the registration is valid.
+   */
+  static bool IsEntryMatching(internal::IoUringCallbackEntry const& entry, CallbackHandle callback_handle) noexcept {
+    return entry.valid && (entry.sequence_num == internal::IoUringCallbackHandleSequenceNum(callback_handle));
+  }
+
+  /*!
+   * \brief   Finds an unused callback entry.
+   * \return  Index of the entry or callbacks_.size() if all entries are in use.
+   * \pre     registration_mutex_ is locked.
+   */
+  std::size_t FindFreeEntryLocked() const noexcept {
+    std::size_t index{0};
+    for (; index < callbacks_.size(); ++index) {
+      std::lock_guard<std::mutex> const entry_lock{callbacks_[index].mutex};
+      if ((!callbacks_[index].valid) && (!callbacks_[index].in_callback)) {
+        break;
+      }
+    }
+    return index;
+  }
+
+  /*!
+   * \brief   Checks whether a callback is already registered for an IO source.
+   * \param[in] io_source IO source.
+   * \return  true if a valid registration exists.
+   * \pre     registration_mutex_ is locked.
+   */
+  bool IsIoSourceRegisteredLocked(NativeHandle io_source) const noexcept {
+    bool registered{false};
+    for (internal::IoUringCallbackEntry const& entry : callbacks_) {
+      std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+      if (entry.valid && (!entry.software_event) && (entry.io_source == io_source)) {
+        registered = true;
+        break;
+      }
+    }
+    return registered;
+  }
+
+  /*!
+   * \brief   Shared implementation of Set/Add/RemoveMonitoredEvents().
+   * \param[in] callback_handle Callback handle.
+   * \param[in] compute         Computes the new event mask from the current one.
+   * \param[in] events          Events passed by the user.
+   * \return  Empty result or kApiError.
+   */
+  template <typename ComputeEvents>
+  ::amsr::core::Result<void> ModifyMonitoredEvents(CallbackHandle callback_handle, ComputeEvents compute,
+                                                   EventTypes events) noexcept {
+    ::amsr::core::Result<void> result{MakeErrorCode(OsabErrc::kApiError, "Invalid IO callback handle or events.")};
+    std::uint16_t const index{internal::IoUringCallbackHandleIndex(callback_handle)};
+    internal::IoUringCallbackEntry* const entry{LookupEntry(callback_handle)};
+    if ((entry != nullptr) && (!events.HasSoftwareEvent())) {
+      std::lock_guard<std::mutex> const entry_lock{entry->mutex};
+      if (IsEntryMatching(*entry, callback_handle) && (!entry->software_event)) {
+        EventTypes const new_events{compute(entry->registered_events)};
+        if (new_events != entry->registered_events) {
+          std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+          CancelPollLocked(index, *entry);
+          entry->registered_events = new_events;
+          // A running callback re-arms its entry after it returns.
+          if (!entry->in_callback) {
+            ArmPollLocked(index, *entry);
+          }
+          FlushSubmissionsLocked();
+        }
+        result.EmplaceValue();
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Converts event types to a poll mask.
+   * \param[in] events Event types.
+   * \return  poll() event mask.
+   */
+  static std::uint32_t ToPollMask(EventTypes events) noexcept {
+    std::uint32_t mask{0};
+    if (events.HasReadEvent()) {
+      mask |= static_cast<std::uint32_t>(POLLIN | POLLPRI | POLLRDHUP);
+    }
+    if (events.HasWriteEvent()) {
+      mask |= static_cast<std::uint32_t>(POLLOUT);
+    }
+    if (events.HasErrorEvent()) {
+      mask |= static_cast<std::uint32_t>(POLLERR | POLLHUP);
+    }
+    return mask;
+  }
+
+  /*!
+   * \brief   Converts a poll result mask to event types filtered by the monitored events.
+   * \param[in] revents   poll() result mask.
+   * \param[in] monitored Monitored event types.
+   * \return  Occurred event types.
+   */
+  static EventTypes FromPollMask(std::uint32_t revents, EventTypes monitored) noexcept {
+    EventTypes events{};
+    static_cast<void>(events.SetReadEvent(monitored.HasReadEvent() &&
+                                          ((revents & static_cast<std::uint32_t>(POLLIN | POLLPRI | POLLRDHUP |
+                                                                                 POLLHUP)) != 0U)));
+    static_cast<void>(
+        events.SetWriteEvent(monitored.HasWriteEvent() && ((revents & static_cast<std::uint32_t>(POLLOUT)) != 0U)));
+    // Like epoll, errors are always reported.
+    static_cast<void>(events.SetErrorEvent((revents & static_cast<std::uint32_t>(POLLERR | POLLHUP)) != 0U));
+    return events;
+  }
+
+  /*!
+   * \brief   Queues a poll request for an entry if any IO event is monitored.
+   * \param[in]     index Entry index.
+   * \param[in,out] entry Callback entry, locked by the caller.
+   * \pre     submission_mutex_ is locked.
+   */
+  void ArmPollLocked(std::uint16_t index, internal::IoUringCallbackEntry& entry) noexcept {
+    if (entry.valid && (!entry.armed) && entry.registered_events.HasAnyIoEvent()) {
+      struct io_uring_sqe* const sqe{AcquireSqeLocked()};
+      sqe->opcode = IORING_OP_POLL_ADD;
+      sqe->flags = IOSQE_FIXED_FILE;
+      sqe->fd = static_cast<std::int32_t>(index);
+      sqe->poll32_events = ToPollMask(entry.registered_events);
+      sqe->user_data = internal::PackIoUringUserData(index, entry.arm_generation, entry.sequence_num);
+      entry.armed = true;
+    }
+  }
+
+  /*!
+   * \brief   Queues a poll remove request for an entry if a poll request is outstanding.
+   * \details The completion of the removed poll request is dropped because the arm generation is increased.
+   * \param[in]     index Entry index.
+   * \param[in,out] entry Callback entry, locked by the caller.
+   * \pre     submission_mutex_ is locked.
+   */
+  void CancelPollLocked(std::uint16_t index, internal::IoUringCallbackEntry& entry) noexcept {
+    if (entry.armed) {
+      struct io_uring_sqe* const sqe{AcquireSqeLocked()};
+      sqe->opcode = IORING_OP_POLL_REMOVE;
+      sqe->fd = -1;
+      sqe->addr = internal::PackIoUringUserData(index, entry.arm_generation, entry.sequence_num);
+      sqe->user_data = internal::PackIoUringUserData(internal::kIoUringIgnoredIndex, 0U, 0U);
+      entry.armed = false;
+    }
+    ++entry.arm_generation;
+  }
+
+  /*!
+   * \brief   Queues the read request on the unblock eventfd.
+   * \pre     submission_mutex_ is locked.
+   */
+  void ArmUnblockReadLocked() noexcept {
+    struct io_uring_sqe* const sqe{AcquireSqeLocked()};
+    sqe->opcode = IORING_OP_READ;
+    sqe->flags = IOSQE_FIXED_FILE;
+    sqe->fd = static_cast<std::int32_t>(UnblockFixedFileIndex());
+    // VECTOR NC AutosarC++17_10-M5.2.9: MD_OSA_M5.2.9_ReinterpretCastVoidPointerUintPtr
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_OSA_A5.2.4_ReinterpretCastVoidPointerUintPtr
+    sqe->addr = reinterpret_cast<std::uintptr_t>(&unblock_read_buffer_);
+    sqe->len = sizeof(unblock_read_buffer_);
+    sqe->user_data = internal::PackIoUringUserData(internal::kIoUringUnblockIndex, 0U, 0U);
+  }
+
+  /*!
+   * \brief   Acquires an SQE. Submits all queued requests first if the submission queue is full.
+   * \details The submission queue only holds requests for the pending re-arms and cancellations of all entries, but a
+   *          callback that changes its monitored events repeatedly while completions are dispatched queues a poll
+   *          remove request for every change. A full queue is therefore submitted also from the thread that handles
+   *          events; the kernel consumes all SQEs within io_uring_enter() so the queue is empty afterwards.
+   * \return  Pointer to a zero initialized SQE.
+   * \pre     submission_mutex_ is locked.
+   */
+  struct io_uring_sqe* AcquireSqeLocked() noexcept {
+    struct io_uring_sqe* sqe{queues_.AcquireSqe()};
+    if (sqe == nullptr) {
+      SubmitLocked();
+      sqe = queues_.AcquireSqe();
+      if (sqe == nullptr) {
+        ::amsr::core::Abort("IoUringReactor1: Submission queue exhausted.");
+      }
+    }
+    ++pending_submissions_;
+    return sqe;
+  }
+
+  /*!
+   * \brief   Submits queued requests immediately unless called from the thread that handles events.
+   * \details The thread that handles events submits its requests with the next wait in HandleEvents().
+   * \pre     submission_mutex_ is locked.
+   */
+  void FlushSubmissionsLocked() noexcept {
+    if (!handling_completions_ || (!IsThisThreadHandlingEvents())) {
+      SubmitLocked();
+    }
+  }
+
+  /*!
+   * \brief   Submits all queued requests with one io_uring_enter() call.
+   * \pre     submission_mutex_ is locked.
+   */
+  void SubmitLocked() noexcept {
+    if (pending_submissions_ != 0U) {
+      std::uint32_t const to_submit{pending_submissions_};
+      pending_submissions_ = 0;
+      int ret{0};
+      do {
+        ret = internal::IoUringEnter(queues_.GetRingFd(), to_submit, 0U, 0U, nullptr, 0U);
+      } while (::osabstraction::internal::HasSystemCallFailed(ret) &&
+               (::osabstraction::internal::GetErrorNumber().value == EINTR));
+      if (::osabstraction::internal::HasSystemCallFailed(ret)) {
+        ::amsr::core::Abort("IoUringReactor1: io_uring_enter() failed to submit requests.");
+      }
+    }
+  }
+
+  /*!
+   * \brief   Updates one slot of the fixed file table.
+   * \param[in] index  Fixed file index.
+   * \param[in] fd     File descriptor or -1 to clear the slot.
+   * \return  Empty result or kApiError / kResource.
+   * \pre     submission_mutex_ is locked.
+   */
+  ::amsr::core::Result<void> FileUpdateLocked(std::uint32_t index, NativeHandle fd) noexcept {
+    ::amsr::core::Result<void> result{};
+    std::int32_t fd_value{fd};
+    struct io_uring_files_update update {};
+    update.offset = index;
+    // VECTOR NC AutosarC++17_10-M5.2.9: MD_OSA_M5.2.9_ReinterpretCastVoidPointerUintPtr
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_OSA_A5.2.4_ReinterpretCastVoidPointerUintPtr
+    update.fds = reinterpret_cast<std::uintptr_t>(&fd_value);
+    if (::osabstraction::internal::HasSystemCallFailed(
+            internal::IoUringRegister(queues_.GetRingFd(), IORING_REGISTER_FILES_UPDATE, &update, 1U))) {
+      ::osabstraction::internal::OsErrorNumber const error{::osabstraction::internal::GetErrorNumber()};
+      if ((error.value == EBADF) || (error.value == EINVAL) || (error.value == EOPNOTSUPP)) {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kApiError, error.value, "Cannot monitor IO source."));
+      } else {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kResource, error.value, "Updating io_uring file table failed."));
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Releases the resources of an unregistered IO entry.
+   * \param[in]     index Entry index.
+   * \param[in,out] entry Callback entry, locked by the caller.
+   * \pre     submission_mutex_ is locked and the callback is not executing.
+   */
+  void ReleaseEntryLocked(std::uint16_t index, internal::IoUringCallbackEntry& entry) noexcept {
+    static_cast<void>(FileUpdateLocked(index, -1));
+    if (entry.close_on_release) {
+      FileDescriptor const closer{entry.io_source};
+    }
+    entry.io_source = kInvalidNativeHandle;
+    entry.close_on_release = false;
+    entry.callback = CallbackType{};
+  }
+
+  /*!
+   * \brief   Submits pending requests and waits for completions.
+   * \param[in] timeout Time to wait.
+   * \return  kTimeout if the timeout expired without completions, kSignal if interrupted, kEventsHandledOrUnblock
+   *          otherwise.
+   * \error   osabstraction::OsabErrc::kFatal io_uring_enter() failed unexpectedly.
+   */
+  ::amsr::core::Result<UnblockReason> WaitForCompletions(std::chrono::nanoseconds timeout) noexcept {
+    ::amsr::core::Result<UnblockReason> result{UnblockReason::kEventsHandledOrUnblock};
+    std::uint32_t to_submit{0};
+    {
+      std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+      to_submit = pending_submissions_;
+      pending_submissions_ = 0;
+    }
+
+    struct __kernel_timespec ts {};
+    struct io_uring_getevents_arg arg {};
+    arg.sigmask_sz = _NSIG / 8;
+    std::uint32_t min_complete{1};
+    if (timeout <= std::chrono::nanoseconds::zero()) {
+      min_complete = 0;
+    } else if (timeout != kInfinity) {
+      ts.tv_sec = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::seconds>(timeout).count());
+      ts.tv_nsec = static_cast<long long>((timeout % std::chrono::seconds{1}).count());
+      // VECTOR NC AutosarC++17_10-M5.2.9: MD_OSA_M5.2.9_ReinterpretCastVoidPointerUintPtr
+      // VECTOR NL AutosarC++17_10-A5.2.4: MD_OSA_A5.2.4_ReinterpretCastVoidPointerUintPtr
+      arg.ts = reinterpret_cast<std::uintptr_t>(&ts);
+    } else {
+      // Wait infinitely.
+    }
+
+    int const ret{internal::IoUringEnter(queues_.GetRingFd(), to_submit, min_complete,
+                                         IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg))};
+    if (::osabstraction::internal::HasSystemCallFailed(ret)) {
+      ::osabstraction::internal::OsErrorNumber const error{::osabstraction::internal::GetErrorNumber()};
+      if (error.value == ETIME) {
+        result.EmplaceValue(UnblockReason::kTimeout);
+      } else if (error.value == EINTR) {
+        result.EmplaceValue(UnblockReason::kSignal);
+      } else if (error.value == EBUSY) {
+        // CQ overflow backlog is flushed, completions are available.
+      } else {
+        result.EmplaceError(MakeErrorCode(OsabErrc::kFatal, error.value, "io_uring_enter() failed."));
+      }
+    } else {
+      // Requests submitted or completions available. HandleEvents() evaluates the completions.
+    }
+    return result;
+  }
+
+  /*!
+   * \brief   Dispatches all available completions.
+   * \return  Number of reaped completions.
+   */
+  std::uint32_t HandleCompletions() noexcept {
+    std::uint32_t const count{queues_.ReapCompletions(completions_.data())};
+    handling_completions_ = true;
+    for (std::uint32_t i{0}; i < count; ++i) {
+      internal::IoUringCompletion const& completion{completions_[i]};
+      std::uint16_t const index{static_cast<std::uint16_t>(completion.user_data & 0xFFFFU)};
+      if (index == internal::kIoUringUnblockIndex) {
+        std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+        ArmUnblockReadLocked();
+      } else if (index < callbacks_.size()) {
+        HandleIoCompletion(index, completion);
+      } else {
+        // Completion of a poll remove request.
+      }
+    }
+    handling_completions_ = false;
+    return count;
+  }
+
+  /*!
+   * \brief   Executes the callback for a completed poll request and re-arms it.
+   * \param[in] index       Entry index.
+   * \param[in] completion  Completion of the poll request.
+   */
+  void HandleIoCompletion(std::uint16_t index, internal::IoUringCompletion const& completion) noexcept {
+    internal::IoUringCallbackEntry& entry{callbacks_[index]};
+    EventTypes events{};
+    CallbackHandle handle{kInvalidCallbackHandle};
+    {
+      std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+      if (entry.valid && (completion.user_data == internal::PackIoUringUserData(index, entry.arm_generation,
+                                                                                 entry.sequence_num))) {
+        entry.armed = false;
+        if (completion.res >= 0) {
+          events = FromPollMask(static_cast<std::uint32_t>(completion.res), entry.registered_events);
+        } else {
+          events.SetErrorEvent(true);
+        }
+        if (events.HasAnyIoEvent()) {
+          entry.in_callback = true;
+          handle = internal::PackIoUringCallbackHandle(index, entry.sequence_num);
+        } else {
+          std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+          ArmPollLocked(index, entry);
+        }
+      }
+    }
+    if (handle != kInvalidCallbackHandle) {
+      entry.callback(handle, events);
+      std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+      std::lock_guard<std::mutex> const submission_lock{submission_mutex_};
+      entry.in_callback = false;
+      if (entry.valid) {
+        ArmPollLocked(index, entry);
+      } else if (!entry.software_event) {
+        ReleaseEntryLocked(index, entry);
+      } else {
+        entry.callback = CallbackType{};
+      }
+    }
+  }
+
+  /*!
+   * \brief   Executes the callbacks of all software events triggered before this call.
+   * \return  true if at least one callback was executed.
+   */
+  bool HandleSoftwareEvents() noexcept {
+    bool handled{false};
+    {
+      std::lock_guard<std::mutex> const triggered_lock{triggered_software_events_mutex_};
+      pending_software_events_.swap(triggered_software_events_);
+    }
+    for (CallbackHandle const handle : pending_software_events_) {
+      internal::IoUringCallbackEntry& entry{callbacks_[internal::IoUringCallbackHandleIndex(handle)]};
+      bool execute{false};
+      {
+        std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+        if (IsEntryMatching(entry, handle) && entry.triggered) {
+          entry.triggered = false;
+          entry.in_callback = true;
+          execute = true;
+        }
+      }
+      if (execute) {
+        entry.callback(handle, EventTypes{}.SetSoftwareEvent(true));
+        handled = true;
+        std::lock_guard<std::mutex> const entry_lock{entry.mutex};
+        entry.in_callback = false;
+        if (!entry.valid) {
+          entry.callback = CallbackType{};
+        }
+      }
+    }
+    pending_software_events_.clear();
+    return handled;
+  }
+
+  /*!
+   * \brief   Wakes up a blocking HandleEvents() call by writing to the unblock eventfd.
+   */
+  void UnblockInternal() const noexcept {
+    std::uint64_t const value{1};
+    static_cast<void>(::write(unblock_event_fd_.Get(), &value, sizeof(value)));
+  }
+
+  /*!
+   * \brief io_uring instance.
+   */
+  internal::IoUringQueues queues_;
+
+  /*!
+   * \brief Unblock eventfd.
+   */
+  FileDescriptor unblock_event_fd_;
+
+  /*!
+   * \brief Target buffer of the read request on the unblock eventfd.
+   */
+  std::uint64_t unblock_read_buffer_{0};
+
+  /*!
+   * \brief Callback entries, preallocated for the maximum number of callbacks.
+   */
+  ara::core::Vector<internal::IoUringCallbackEntry> callbacks_;
+
+  /*!
+   * \brief Buffer for completions reaped in one HandleEvents() iteration.
+   */
+  ara::core::Vector<internal::IoUringCompletion> completions_;
+
+  /*!
+   * \brief Software events triggered since the last HandleEvents() iteration.
+   */
+  ara::core::Vector<CallbackHandle> triggered_software_events_{};
+
+  /*!
+   * \brief Software events that are handled in the current HandleEvents() iteration.
+   */
+  ara::core::Vector<CallbackHandle> pending_software_events_{};
+
+  /*!
+   * \brief   Number of SQEs queued but not yet submitted.
+   * \details Protected by submission_mutex_.
+   */
+  std::uint32_t pending_submissions_{0};
+
+  /*!
+   * \brief Flag that is set while completions are dispatched in HandleEvents().
+   */
+  std::atomic<bool> handling_completions_{false};
+
+  /*!
+   * \brief Mutex that serializes callback registration.
+   */
+  std::mutex registration_mutex_{};
+
+  /*!
+   * \brief Mutex that protects the submission queue and the fixed file table.
+   */
+  std::mutex submission_mutex_{};
+
+  /*!
+   * \brief Mutex that protects triggered_software_events_.
+   */
+  std::mutex triggered_software_events_mutex_{};
+
+  /*!
+   * \brief Flag that is set if HandleEventsLoop() shall return.
+   */
+  std::atomic<bool> external_unblock_request_{false};
+
+  /*!
+   * \brief Id of the thread that executed HandleEvents() the last time.
+   */
+  std::atomic<std::thread::id> handle_events_tid_{};
+};
+
+}  // namespace reactor1
+}  // namespace io
+}  // namespace osabstraction
+
+/*!
+ * \exclusivearea ::osabstraction::io::reactor1::IoUringReactor1::submission_mutex_
+ * Serializes access to the io_uring submission queue and fixed file table.
+ *
+ * \protects ::osabstraction::io::reactor1::IoUringReactor1::queues_ (submission side),
+ *           ::osabstraction::io::reactor1::IoUringReactor1::pending_submissions_
+ * \usedin   Register, SetMonitoredEvents, AddMonitoredEvents, RemoveMonitoredEvents, Unregister, HandleEvents
+ * \exclude  All other methods of the same IoUringReactor1 object.
+ * \length   MEDIUM Filling SQEs, optionally one io_uring_enter() or io_uring_register() system call.
+ * \endexclusivearea
+ */
+
+#endif  // LIB_COMMON_LIBOSABSTRACTION_LINUX_INCLUDE_OSABSTRACTION_IO_REACTOR1_IO_URING_REACTOR1_H_
@@ -0,0 +1,340 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!
+ *      \file bulk_byteorder.h
+ *      \brief Byte order conversion of contiguous sequences of primitive values.
+ *      \details Used by the serializer and deserializer for arrays and vectors of multi-byte arithmetic types. If the
+ *               configured byte order matches the host byte order, the sequence is copied with memcpy. Otherwise all
+ *               elements are byte swapped while being copied. On x86 the swap is done with SSSE3 or AVX2 byte
+ *               shuffles; the instruction set is selected once at runtime, so binaries built for the x86 baseline
+ *               still use AVX2 where available. Other platforms use a scalar loop.
+ *      \unit SomeIpProtocol::BasicSerdes::ByteOrder
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_SOMEIP_PROTOCOL_BASIC_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_BULK_BYTEORDER_H_
+#define LIB_SOMEIP_PROTOCOL_BASIC_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_BULK_BYTEORDER_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "someip-protocol/internal/byteorder.h"
+
+// VECTOR NL AutosarC++17_10-A16.0.1: MD_SOMEIPPROTOCOL_AutosarC++17_10-A16.0.1_ConditionalCompilation
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define AMSR_SOMEIP_PROTOCOL_BULK_BYTEORDER_X86 1
+#endif
+
+namespace amsr {
+namespace someip_protocol {
+namespace internal {
+
+/*!
+ * \brief Implementations available for swapping the bytes of a sequence of values.
+ */
+enum class BulkByteSwapBackend : std::uint8_t {
+  kScalar, /*! \brief < One element per iteration. */
+  kSsse3,  /*! \brief < 16 bytes per iteration with SSSE3 pshufb. */
+  kAvx2    /*! \brief < 32 bytes per iteration with AVX2 vpshufb. */
+};
+
+namespace detail {
+
+/*!
+ * \brief Swap the bytes of count elements of size ElementSize while copying them from src to dst.
+ * \tparam ElementSize Size of one element in bytes.
+ * \param[out] dst Destination, may be unaligned.
+ * \param[in] src Source, may be unaligned. Must not overlap with dst.
+ * \param[in] count Number of elements.
+ * \pre -
+ * \context Any
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <std::size_t ElementSize>
+inline void BulkByteSwapScalar(std::uint8_t* dst, std::uint8_t const* src, std::size_t count) noexcept {
+  for (std::size_t element{0U}; element < count; ++element) {
+    for (std::size_t byte{0U}; byte < ElementSize; ++byte) {
+      dst[byte] = src[ElementSize - 1U - byte];
+    }
+    dst = &dst[ElementSize];
+    src = &src[ElementSize];
+  }
+}
+
+// VECTOR NL AutosarC++17_10-A16.0.1: MD_SOMEIPPROTOCOL_AutosarC++17_10-A16.0.1_ConditionalCompilation
+#ifdef AMSR_SOMEIP_PROTOCOL_BULK_BYTEORDER_X86
+
+/*!
+ * \brief Index of the source byte for one byte of the byte swap shuffle control.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \param[in] byte Position of the byte in the 16 byte block.
+ * \return The source byte of the same ElementSize wide lane, counted from the other end of the lane.
+ * \pre -
+ * \context Any
+ */
+template <std::size_t ElementSize>
+constexpr std::uint8_t ByteSwapShuffleIndex(std::size_t byte) noexcept {
+  return static_cast<std::uint8_t>(((byte / ElementSize) * ElementSize) + (ElementSize - 1U) - (byte % ElementSize));
+}
+
+/*!
+ * \brief Shuffle control bytes reversing the bytes of each ElementSize wide lane of a 16 byte block.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \tparam Bytes Positions of the bytes in the 16 byte block.
+ */
+template <std::size_t ElementSize, typename Bytes = std::make_index_sequence<16U>>
+struct ByteSwapShuffleTable;
+
+/*!
+ * \brief Shuffle control bytes reversing the bytes of each ElementSize wide lane of a 16 byte block.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \tparam Bytes Positions of the bytes in the 16 byte block.
+ */
+template <std::size_t ElementSize, std::size_t... Bytes>
+struct ByteSwapShuffleTable<ElementSize, std::index_sequence<Bytes...>> {
+  /*!
+   * \brief The shuffle control bytes, computed at compile time.
+   */
+  alignas(16) static constexpr std::uint8_t kControl[sizeof...(Bytes)]{ByteSwapShuffleIndex<ElementSize>(Bytes)...};
+};
+
+/*!
+ * \brief Definition of the shuffle control bytes.
+ */
+template <std::size_t ElementSize, std::size_t... Bytes>
+constexpr std::uint8_t ByteSwapShuffleTable<ElementSize, std::index_sequence<Bytes...>>::kControl[sizeof...(Bytes)];
+
+/*!
+ * \brief Shuffle control reversing the bytes of each ElementSize wide lane of a 16 byte block.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \return The shuffle control for pshufb, loaded from the compile time table.
+ * \pre -
+ * \context Any
+ */
+template <std::size_t ElementSize>
+__attribute__((target("ssse3"))) inline __m128i ByteSwapShuffleControl() noexcept {
+  return _mm_load_si128(reinterpret_cast<__m128i const*>(ByteSwapShuffleTable<ElementSize>::kControl));
+}
+
+/*!
+ * \brief SSSE3 implementation of BulkByteSwapScalar().
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \param[out] dst Destination, may be unaligned.
+ * \param[in] src Source, may be unaligned. Must not overlap with dst.
+ * \param[in] count Number of elements.
+ * \pre The CPU supports SSSE3.
+ * \context Any
+ */
+template <std::size_t ElementSize>
+__attribute__((target("ssse3"))) inline void BulkByteSwapSsse3(std::uint8_t* dst, std::uint8_t const* src,
+                                                               std::size_t count) noexcept {
+  constexpr std::size_t kElementsPerBlock{16U / ElementSize};
+  __m128i const control{ByteSwapShuffleControl<ElementSize>()};
+  std::size_t const block_count{count / kElementsPerBlock};
+  for (std::size_t block{0U}; block < block_count; ++block) {
+    __m128i const value{_mm_loadu_si128(reinterpret_cast<__m128i const*>(src))};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(value, control));
+    dst = &dst[16U];
+    src = &src[16U];
+  }
+  BulkByteSwapScalar<ElementSize>(dst, src, count - (block_count * kElementsPerBlock));
+}
+
+/*!
+ * \brief AVX2 implementation of BulkByteSwapScalar().
+ * \details vpshufb shuffles within each 128 bit lane, so the SSSE3 shuffle control is used for both lanes.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \param[out] dst Destination, may be unaligned.
+ * \param[in] src Source, may be unaligned. Must not overlap with dst.
+ * \param[in] count Number of elements.
+ * \pre The CPU supports AVX2.
+ * \context Any
+ */
+template <std::size_t ElementSize>
+__attribute__((target("avx2"))) inline void BulkByteSwapAvx2(std::uint8_t* dst, std::uint8_t const* src,
+                                                             std::size_t count) noexcept {
+  constexpr std::size_t kElementsPerBlock{32U / ElementSize};
+  __m256i const control{_mm256_broadcastsi128_si256(ByteSwapShuffleControl<ElementSize>())};
+  std::size_t const block_count{count / kElementsPerBlock};
+  for (std::size_t block{0U}; block < block_count; ++block) {
+    __m256i const value{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(src))};
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_shuffle_epi8(value, control));
+    dst = &dst[32U];
+    src = &src[32U];
+  }
+  BulkByteSwapSsse3<ElementSize>(dst, src, count - (block_count * kElementsPerBlock));
+}
+
+#endif  // AMSR_SOMEIP_PROTOCOL_BULK_BYTEORDER_X86
+
+/*!
+ * \brief Detect the best implementation supported by the CPU.
+ * \return The backend to use.
+ * \pre -
+ * \context Any
+ */
+inline BulkByteSwapBackend DetectBulkByteSwapBackend() noexcept {
+  BulkByteSwapBackend backend{BulkByteSwapBackend::kScalar};
+// VECTOR NL AutosarC++17_10-A16.0.1: MD_SOMEIPPROTOCOL_AutosarC++17_10-A16.0.1_ConditionalCompilation
+#ifdef AMSR_SOMEIP_PROTOCOL_BULK_BYTEORDER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    backend = BulkByteSwapBackend::kAvx2;
+  } else if (__builtin_cpu_supports("ssse3")) {
+    backend = BulkByteSwapBackend::kSsse3;
+  } else {
+    // Scalar fallback.
+  }
+#endif
+  return backend;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief   Get the implementation used for swapping the bytes of a sequence of values.
+ * \details The CPU features are queried on the first call only.
+ * \return  The backend in use.
+ * \pre     -
+ * \context Any
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+inline BulkByteSwapBackend GetBulkByteSwapBackend() noexcept {
+  static BulkByteSwapBackend const backend{detail::DetectBulkByteSwapBackend()};
+  return backend;
+}
+
+/*!
+ * \brief Swap the bytes of count elements of size ElementSize while copying them from src to dst.
+ * \tparam ElementSize Size of one element in bytes: 2, 4 or 8.
+ * \param[out] dst Destination, may be unaligned.
+ * \param[in] src Source, may be unaligned. Must not overlap with dst.
+ * \param[in] count Number of elements.
+ * \pre dst and src hold count * ElementSize bytes.
+ * \context Any
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <std::size_t ElementSize>
+inline void BulkByteSwap(std::uint8_t* dst, std::uint8_t const* src, std::size_t count) noexcept {
+  static_assert((ElementSize == 2U) || (ElementSize == 4U) || (ElementSize == 8U), "Unsupported element size.");
+// VECTOR NL AutosarC++17_10-A16.0.1: MD_SOMEIPPROTOCOL_AutosarC++17_10-A16.0.1_ConditionalCompilation
+#ifdef AMSR_SOMEIP_PROTOCOL_BULK_BYTEORDER_X86
+  switch (GetBulkByteSwapBackend()) {
+    case BulkByteSwapBackend::kAvx2:
+      detail::BulkByteSwapAvx2<ElementSize>(dst, src, count);
+      break;
+    case BulkByteSwapBackend::kSsse3:
+      detail::BulkByteSwapSsse3<ElementSize>(dst, src, count);
+      break;
+    default:
+      detail::BulkByteSwapScalar<ElementSize>(dst, src, count);
+      break;
+  }
+#else
+  detail::BulkByteSwapScalar<ElementSize>(dst, src, count);
+#endif
+}
+
+/*!
+ * \brief Check if values of type T have to be byte swapped to convert them between host and the given byte order.
+ * \tparam Endian Configured byte order.
+ * \tparam T Arithmetic type.
+ * \return true if a byte swap is required, false if the host representation can be copied.
+ * \pre -
+ * \context Any
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename Endian, typename T>
+constexpr bool IsBulkByteSwapRequired() noexcept {
+  return (sizeof(T) > 1U) && (Endian::value != ByteOrder::kMachineSpecific) && (Endian::value != GetHostByteOrder());
+}
+
+namespace detail {
+
+/*!
+ * \brief Copy count values of type T with byte swap.
+ * \tparam T Arithmetic type of size 2, 4 or 8.
+ * \param[out] dst Destination.
+ * \param[in] src Source.
+ * \param[in] count Number of values.
+ * \pre dst and src hold count * sizeof(T) bytes.
+ * \context Any
+ */
+template <typename T>
+inline void BulkCopy(std::uint8_t* dst, std::uint8_t const* src, std::size_t count, std::true_type) noexcept {
+  BulkByteSwap<sizeof(T)>(dst, src, count);
+}
+
+/*!
+ * \brief Copy count values of type T without byte swap.
+ * \tparam T Arithmetic type.
+ * \param[out] dst Destination.
+ * \param[in] src Source.
+ * \param[in] count Number of values.
+ * \pre dst and src hold count * sizeof(T) bytes.
+ * \context Any
+ */
+template <typename T>
+inline void BulkCopy(std::uint8_t* dst, std::uint8_t const* src, std::size_t count, std::false_type) noexcept {
+  if (count > 0U) {
+    std::memcpy(dst, src, count * sizeof(T));  // VCA_SOMEIPPROTOCOL_MEMCPY_USAGE
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief   Copy count values of type T between host and the given byte order.
+ * \details The conversion is symmetric, i.e. the same function serves for serialization (src holds host values) and
+ *          deserialization (src holds serialized values).
+ * \tparam  Endian Configured byte order.
+ * \tparam  T Arithmetic type other than bool.
+ * \param[out] dst Destination, may be unaligned.
+ * \param[in]  src Source, may be unaligned. Must not overlap with dst.
+ * \param[in]  count Number of values.
+ * \pre     dst and src hold count * sizeof(T) bytes.
+ * \context Any
+ * \spec
+ *   requires true;
+ * \endspec
+ *
+ * \internal
+ * - Copy the values with memcpy if the byte order matches the host.
+ * - Swap the bytes of all values otherwise.
+ * \endinternal
+ */
+template <typename Endian, typename T>
+inline void BulkCopyWithByteOrder(std::uint8_t* dst, std::uint8_t const* src, std::size_t count) noexcept {
+  static_assert(std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value), "Unsupported element type.");
+  detail::BulkCopy<T>(dst, src, count, std::integral_constant<bool, IsBulkByteSwapRequired<Endian, T>()>{});
+}
+
+}  // namespace internal
+}  // namespace someip_protocol
+}  // namespace amsr
+
+#endif  // LIB_SOMEIP_PROTOCOL_BASIC_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_BULK_BYTEORDER_H_
@@ -55,7 +55,9 @@ namespace deserialization {
  */
 template <typename TpPack, typename... ItemConf, typename T, std::size_t N>
 static auto DeserializeArray(ara::core::Array<T, N>& array, Reader& reader) noexcept
-    -> std::enable_if_t<!TypeTraitIsOptimizableContainer<T, ItemConf...>(), Result> {
+    -> std::enable_if_t<(!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()),
+                        Result> {
   Result result{true};
   for (T& item : array) {
     // clang-format off
@@ -94,6 +96,31 @@ static auto DeserializeArray(ara::core::Array<T, N>& array, Reader& reader) noex
   return true;
 }
 
+/*!
+ * \brief Specialized deserialization function to deserialize multi-byte arithmetic arrays with different endianness.
+ * \tparam TpPack Transformation property. Not required in this case.
+ * \tparam ItemConf Endianness.
+ * \tparam T Type of objects stored in the given array.
+ * \tparam N Size of the array.
+ * \param[out] array Array the deserialized value shall be stored into.
+ * \param[in,out] reader Reader holding the bufferView on the serialized data.
+ * \return Always return true.
+ * \pre It has been verified that least N * sizeof(T) bytes are present.
+ * \context Reactor|App
+ * \reentrant TRUE for different reader objects.
+ *
+ * \internal
+ * - Store serialized value into destination array, converting all elements to host byte order at once.
+ * \endinternal
+ */
+template <typename TpPack, typename... ItemConf, typename T, std::size_t N>
+static auto DeserializeArray(ara::core::Array<T, N>& array, Reader& reader) noexcept
+    -> std::enable_if_t<TypeTraitIsBulkConvertibleContainer<T, ItemConf...>(), Result> {
+  reader.ReadArrayWithByteOrder<GetFirstItemConf<ItemConf...>>(array);  // VCA_SOMEIPPROTOCOL_DESER_ARRAY_REFERENCE
+
+  return true;
+}
+
 }  // namespace deserialization
 }  // namespace internal
 }  // namespace someip_protocol
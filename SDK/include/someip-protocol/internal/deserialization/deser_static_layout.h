@@ -0,0 +1,441 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file deser_static_layout.h
+ *        \brief Fused deserialization of data types with a static layout.
+ *      \details Counterpart of ser_static_layout.h. SomeIpProtocolDeserializeStaticLayout() verifies the static size of
+ *               the complete data type once and then reads all members through a StaticLayoutReader. Arrays of
+ *               arithmetic types are converted in one block (see bulk_byteorder.h).
+ *
+ *               A length field of the top-level data type is read and verified like by the regular deserializer.
+ *               Nested length fields are not supported, as a receiver may get a longer length value from a newer
+ *               sender, so the size of the data type on the wire is not static.
+ *
+ *               Generated struct deserializers provide the fused routine of a struct as
+ *               DeserializeStaticLayout<TpPack>(StaticLayoutReader&, Struct&). There is no fallback to the regular
+ *               struct deserializer, as it would check every member again. StaticLayoutDeserializer wraps the fused
+ *               deserialization as payload deserializer for the binding deserializer wrappers.
+ *      \unit SomeIpProtocol::Serdes::Deserialization
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_DESERIALIZATION_DESER_STATIC_LAYOUT_H_
+#define LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_DESERIALIZATION_DESER_STATIC_LAYOUT_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include "ara/core/array.h"
+#include "deser_forward.h"
+#include "deser_lengthfield.h"
+#include "deser_sizing.h"
+#include "someip-protocol/internal/bulk_byteorder.h"
+#include "someip-protocol/internal/byteorder.h"
+#include "someip-protocol/internal/deserialization/reader.h"
+#include "someip-protocol/internal/deserialization/types.h"
+#include "someip-protocol/internal/types.h"
+
+namespace amsr {
+namespace someip_protocol {
+namespace internal {
+namespace deserialization {
+
+/*!
+ * \brief   Reader for a buffer region whose size has already been verified for the complete data type.
+ * \details Only used by the fused deserialization of static layout data types. The region must hold all bytes to be
+ *          read, which is guaranteed by SomeIpProtocolDeserializeStaticLayout().
+ * \vprivate Product private
+ */
+class StaticLayoutReader final {
+ public:
+  /*!
+   * \brief     Construct a reader for a verified region.
+   * \param[in] region Region holding exactly the static size of the data type to deserialize.
+   * \pre       -
+   * \context   Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  explicit StaticLayoutReader(BufferView const& region) noexcept : cursor_{region.data()} {}
+
+  /*!
+   * \brief      Read an integral value.
+   * \tparam     T Integral type.
+   * \tparam     Endian Endianness.
+   * \param[out] t Destination.
+   * \pre        The region holds sizeof(T) more bytes.
+   * \context    Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T, typename Endian>
+  auto ReadPrimitive(T& t) noexcept
+      -> std::enable_if_t<std::is_integral<T>::value && (!std::is_same<T, bool>::value), void> {
+    t = static_cast<T>(UintRead<sizeof(T), Endian>::Read(cursor_));
+    Advance(sizeof(T));
+  }
+
+  /*!
+   * \brief      Read a bool from a single byte.
+   * \tparam     T Must be bool.
+   * \tparam     Endian Endianness, ignored.
+   * \param[out] t Destination.
+   * \pre        The region holds one more byte.
+   * \context    Reactor|App
+   * \trace      SPEC-4981317
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T, typename Endian>
+  void ReadPrimitive(bool& t) noexcept {
+    std::uint8_t const tmp{UintRead<sizeof(std::uint8_t), Endian>::Read(cursor_)};
+    t = static_cast<bool>(tmp & 0x01U);
+    Advance(sizeof(std::uint8_t));
+  }
+
+  /*!
+   * \brief      Read a float.
+   * \tparam     T Must be float.
+   * \tparam     Endian Endianness.
+   * \param[out] t Destination.
+   * \pre        The region holds four more bytes.
+   * \context    Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T, typename Endian>
+  auto ReadPrimitive(T& t) noexcept -> std::enable_if_t<std::is_same<T, float>::value, void> {
+    t = static_cast<T>(FloatRead<Endian>::Read(cursor_));
+    Advance(sizeof(float));
+  }
+
+  /*!
+   * \brief      Read a double.
+   * \tparam     T Must be double.
+   * \tparam     Endian Endianness.
+   * \param[out] t Destination.
+   * \pre        The region holds eight more bytes.
+   * \context    Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  template <typename T, typename Endian>
+  auto ReadPrimitive(T& t) noexcept -> std::enable_if_t<std::is_same<T, double>::value, void> {
+    t = static_cast<T>(DoubleRead<Endian>::Read(cursor_));
+    Advance(sizeof(double));
+  }
+
+  /*!
+   * \brief      Read an array of an arithmetic type (except bool).
+   * \tparam     Endian Endianness of the elements.
+   * \tparam     T Element type.
+   * \tparam     N Number of elements.
+   * \param[out] arr Destination.
+   * \pre        The region holds N * sizeof(T) more bytes.
+   * \context    Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   *
+   * \internal
+   * - Copy the array in one block, converting all elements to host byte order if required.
+   * \endinternal
+   */
+  template <typename Endian, typename T, std::size_t N>
+  auto ReadArray(ara::core::Array<T, N>& arr) noexcept
+      -> std::enable_if_t<std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value), void> {
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(reinterpret_cast<std::uint8_t*>(arr.data()), cursor_, N);
+    Advance(N * sizeof(T));
+  }
+
+
+ private:
+  /*!
+   * \brief     Advance the read position.
+   * \param[in] count Number of bytes read.
+   * \pre       The region holds count more bytes.
+   * \context   Reactor|App
+   * \spec
+   *   requires true;
+   * \endspec
+   */
+  void Advance(SizeType count) noexcept { cursor_ = std::next(cursor_, static_cast<std::ptrdiff_t>(count)); }
+
+  /*!
+   * \brief Current read position.
+   */
+  std::uint8_t const* cursor_;
+};
+
+/*!
+ * \brief      Forward declaration of the top level fused deserialization template.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Head Either length size config or endianness.
+ * \tparam     Confs Configuration of the members.
+ * \tparam     T Type of the member.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] t Destination.
+ * \return     true if deserialization was successful, false otherwise.
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+Result DeserializeStaticLayout(StaticLayoutReader& r, T& t) noexcept;
+
+namespace detail {
+
+/*!
+ * \brief      Fused deserialization of a primitive.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Conf Endianness.
+ * \tparam     Primitive Type of primitive.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] t Primitive, the data shall be deserialized into.
+ * \return     Always true.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename Conf, typename Primitive>
+auto DeserializeStaticLayout(StaticLayoutReader& r, Primitive& t) noexcept
+    -> std::enable_if_t<IsPrimitiveType<Primitive>::value, Result> {
+  r.ReadPrimitive<std::decay_t<Primitive>, Conf>(t);
+  return true;
+}
+
+/*!
+ * \brief      Fused deserialization of an enum.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Conf Endianness.
+ * \tparam     EnumType Type of enum.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] t Enum, the data shall be deserialized into.
+ * \return     Always true.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename Conf, typename EnumType>
+auto DeserializeStaticLayout(StaticLayoutReader& r, EnumType& t) noexcept
+    -> std::enable_if_t<IsEnumType<EnumType>::value, Result> {
+  using UnderlyingType = typename std::underlying_type<EnumType>::type;
+  UnderlyingType enum_value{};
+  r.ReadPrimitive<UnderlyingType, Conf>(enum_value);
+  // VECTOR NL AutosarC++17_10-A7.2.1: MD_SOMEIPPROTOCOL_AutosarC++17_10-A7.2.1_MissingRangeCheck
+  t = static_cast<EnumType>(enum_value);
+  return true;
+}
+
+/*!
+ * \brief      Fused deserialization of a user struct.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     LengthConf Length field configuration, must not configure a length field.
+ * \tparam     UserStruct Type of struct.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] s Struct the data shall be deserialized into.
+ * \return     true if deserialization was successful, false otherwise.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename LengthConf, typename UserStruct>
+auto DeserializeStaticLayout(StaticLayoutReader& r, UserStruct& s) noexcept
+    -> std::enable_if_t<(!IsPrimitiveType<UserStruct>::value) && (!IsEnumType<UserStruct>::value) &&
+                            (!traits::IsBasicString<UserStruct>::value),
+                        Result> {
+  static_assert(!HasLengthField<LengthConf>::value, "Nested length fields have no static size on the wire.");
+  return DeserializeStaticLayout<TpPack>(r, s);  // NOTE calls the generated function.
+}
+
+/*!
+ * \brief      Fused deserialization of an array of a non-arithmetic type or of bool.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     LengthConf Length field configuration, must not configure a length field.
+ * \tparam     ItemConf Item configuration for the array elements.
+ * \tparam     T Element type.
+ * \tparam     N Number of elements.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] v Array, the data shall be deserialized into.
+ * \return     true if deserialization was successful, false otherwise.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename LengthConf, typename... ItemConf, typename T, std::size_t N>
+auto DeserializeStaticLayout(StaticLayoutReader& r, ara::core::Array<T, N>& v) noexcept
+    -> std::enable_if_t<(!std::is_arithmetic<T>::value) || std::is_same<T, bool>::value, Result> {
+  static_assert(!HasLengthField<LengthConf>::value, "Nested length fields have no static size on the wire.");
+  Result result{true};
+  for (T& item : v) {
+    result = deserialization::DeserializeStaticLayout<TpPack, ItemConf...>(r, item);
+    if (!result) {
+      break;
+    }
+  }
+  return result;
+}
+
+/*!
+ * \brief      Fused deserialization of an array of an arithmetic type (except bool).
+ * \tparam     TpPack Transformation properties.
+ * \tparam     LengthConf Length field configuration, must not configure a length field.
+ * \tparam     ItemConf Endianness of the elements.
+ * \tparam     T Element type.
+ * \tparam     N Number of elements.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] v Array, the data shall be deserialized into.
+ * \return     Always true.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename LengthConf, typename... ItemConf, typename T, std::size_t N>
+auto DeserializeStaticLayout(StaticLayoutReader& r, ara::core::Array<T, N>& v) noexcept
+    -> std::enable_if_t<std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value), Result> {
+  static_assert(!HasLengthField<LengthConf>::value, "Nested length fields have no static size on the wire.");
+  r.ReadArray<GetFirstItemConf<ItemConf...>>(v);
+  return true;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief      Implementation of forward declared top-level symbol.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Head Either length size config or endianness.
+ * \tparam     Confs Configuration of the members.
+ * \tparam     T Type of the member.
+ * \param[in]  r Reader for the verified region.
+ * \param[out] t Destination.
+ * \return     true if deserialization was successful, false otherwise.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+Result DeserializeStaticLayout(StaticLayoutReader& r, T& t) noexcept {
+  return detail::DeserializeStaticLayout<TpPack, Head, Confs...>(r, t);
+}
+
+/*!
+ * \brief      Deserialize a data type with static layout and without length field with a single buffer size check.
+ * \details    Replacement for VerifySize() followed by SomeIpProtocolDeserialize() for data types with static size.
+ *             Accepts the same byte stream.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Head Either length size config without length field or endianness.
+ * \tparam     Confs Configuration of the members.
+ * \tparam     T Type to deserialize.
+ * \param[in,out] r Reader holding the view on the serialized data.
+ * \param[out] t Destination.
+ * \return     true if deserialization was successful, false if the buffer is too small or a struct deserializer
+ *             failed.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ *
+ * \internal
+ * - Verify the static size of the data type.
+ * - If the buffer is large enough
+ *   - Consume the static size from the reader and read all members from the consumed region without further checks.
+ * \endinternal
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+auto SomeIpProtocolDeserializeStaticLayout(Reader& r, T& t) noexcept
+    -> std::enable_if_t<!HasLengthField<Head>::value, Result> {
+  constexpr std::size_t static_size{SomeIpProtocolGetStaticSize<TpPack, Head, Confs...>(SizeToken<T>{})};
+  Result result{r.VerifySize(static_size)};
+  if (result) {
+    Reader const region{r.ConsumeSubStream(static_size)};
+    StaticLayoutReader layout_reader{region.View()};
+    result = DeserializeStaticLayout<TpPack, Head, Confs...>(layout_reader, t);
+  }
+  return result;
+}
+
+/*!
+ * \brief      Deserialize a data type with static layout and with length field.
+ * \details    Replacement for VerifySize() followed by SomeIpProtocolDeserialize() for data types with static size
+ *             and a length field. Accepts the same byte stream, including a length value larger than the static size.
+ * \tparam     TpPack Transformation properties.
+ * \tparam     Head Length size config with length field.
+ * \tparam     Confs Configuration of the members.
+ * \tparam     T Type to deserialize.
+ * \param[in,out] r Reader holding the view on the serialized data.
+ * \param[out] t Destination.
+ * \return     true if deserialization was successful, false if the buffer or the length value is too small or a
+ *             struct deserializer failed.
+ * \pre        -
+ * \context    Reactor|App
+ * \reentrant  TRUE for different reader objects.
+ *
+ * \internal
+ * - Verify the size of the length field.
+ * - If the buffer is large enough
+ *   - Read the length field and consume the length value from the reader.
+ *   - Deserialize the data type without length field from the consumed region.
+ * \endinternal
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+auto SomeIpProtocolDeserializeStaticLayout(Reader& r, T& t) noexcept
+    -> std::enable_if_t<HasLengthField<Head>::value, Result> {
+  Result result{r.VerifySize(Head::value)};
+  if (result) {
+    result = DeserializeWithLengthField<Head>(r, [&t](Reader& sub_reader) {
+      return SomeIpProtocolDeserializeStaticLayout<TpPack, LengthSize<0U, typename Head::endian>, Confs...>(sub_reader,
+                                                                                                            t);
+    });
+  }
+  return result;
+}
+
+/*!
+ * \brief   Payload deserializer for a data type with static layout.
+ * \details Provides the interface of the generated payload deserializers (Deserialize()), so it can be used as
+ *          PayloadDeserializer of the binding deserializer wrappers for events, field notifiers and method responses
+ *          whose data type has a static layout.
+ * \tparam  DataType Data type to deserialize.
+ * \tparam  TpPack Transformation properties.
+ * \tparam  Head Either length size config or endianness.
+ * \tparam  Confs Configuration of the members.
+ * \vprivate Product private
+ */
+template <typename DataType, typename TpPack, typename Head, typename... Confs>
+class StaticLayoutDeserializer final {
+ public:
+  /*!
+   * \brief      Deserialize the data.
+   * \param[in,out] reader Reader holding the view on the serialized data.
+   * \param[out] data Destination.
+   * \return     true if deserialization was successful, false otherwise.
+   * \pre        -
+   * \context    Reactor|App
+   * \reentrant  TRUE for different reader objects.
+   */
+  static bool Deserialize(Reader& reader, DataType& data) noexcept {
+    return SomeIpProtocolDeserializeStaticLayout<TpPack, Head, Confs...>(reader, data);
+  }
+};
+
+}  // namespace deserialization
+}  // namespace internal
+}  // namespace someip_protocol
+}  // namespace amsr
+
+#endif  // LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_DESERIALIZATION_DESER_STATIC_LAYOUT_H_
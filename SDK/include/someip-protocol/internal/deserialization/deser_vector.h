@@ -75,6 +75,7 @@ static constexpr bool TypeTraitIsVectorArraySizeLimitActive() noexcept(true) {
 template <typename TpPack, typename T, typename ArraySizeConf, typename... ItemConf, typename Alloc>
 static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcept
     -> std::enable_if_t<(!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()) &&
                             (!detail::TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>()),
                         Result> {
   Result result{true};
@@ -120,6 +121,7 @@ static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcep
 template <typename TpPack, typename T, typename ArraySizeConf, typename... ItemConf, typename Alloc>
 static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcept
     -> std::enable_if_t<(!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()) &&
                             detail::TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>(),
                         Result> {
   Result result{true};
@@ -245,6 +247,94 @@ static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcep
   return result && (r.Size() == 0U);
 }
 
+/*!
+ * \brief         Calls the deserialization function for a multi-byte arithmetic vector requiring endianness conversion.
+ * \details       Template specialization for the following case:
+ *                - bulk byte order conversion for the vector datatype is applied
+ *                AND
+ *                - Maximum size limitation (arraySize) is not configured for the vector.
+ * \tparam        TpPack Transformation properties.
+ * \tparam        T Type of vector.
+ * \tparam        ArraySizeConf Array size item configuration: max. number of allowed vector elements.
+ * \tparam        ItemConf Item configuration for the vector elements holding the endianness.
+ * \tparam        Alloc Vector allocator.
+ * \param[in,out] r Reader holding the view on the serialized data.
+ * \param[out]    v Vector, the data shall be deserialized into.
+ * \return        true if deserialization was successful, false otherwise.
+ * \pre           -
+ * \context       Reactor|App
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename TpPack, typename T, typename ArraySizeConf, typename... ItemConf, typename Alloc>
+static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcept
+    -> std::enable_if_t<TypeTraitIsBulkConvertibleContainer<T, ItemConf...>() &&
+                            (!detail::TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>()),
+                        Result> {
+  std::size_t const item_size{sizeof(T)};
+  std::size_t const item_count{r.Size() / item_size};
+  std::size_t const static_size{item_size * item_count};
+  Result const result{r.VerifySize(static_size)};
+
+  if (result) {
+    r.ReadVectorWithByteOrder<GetFirstItemConf<ItemConf...>>(v);
+  }
+
+  // Check that all the elements are deserialized, if not then we must return false.
+  return result && (r.Size() == 0U);
+}
+
+/*!
+ * \brief         Calls the deserialization function for a multi-byte arithmetic vector requiring endianness conversion.
+ * \details       Template specialization for the following case:
+ *                - bulk byte order conversion for the vector datatype is applied
+ *                AND
+ *                - maximum size limitation (arraySize) is configured for the vector.
+ * \tparam        TpPack Transformation properties.
+ * \tparam        T Type of vector.
+ * \tparam        ArraySizeConf Array size item configuration: max. number of allowed vector elements.
+ * \tparam        ItemConf Item configuration for the vector elements holding the endianness.
+ * \tparam        Alloc Vector allocator.
+ * \param[in,out] r Reader holding the view on the serialized data.
+ * \param[out]    v Vector, the data shall be deserialized into.
+ * \return        true if deserialization was successful, false otherwise.
+ * \pre           -
+ * \context       Reactor|App
+ * \reentrant TRUE for different reader objects.
+ * \spec
+ *   requires true;
+ * \endspec
+ *
+ * \internal
+ * - Calculate the number of elements that could possibly fit into the byte stream
+ * - Consume the number of bytes corresponding to the number of elements
+ * - Deserialize the vector
+ * - Return false if any error occurs or there are still bytes present in the reader
+ * \endinternal
+ */
+// VECTOR NC AutosarC++17_10-A15.4.2: MD_SOMEIPPROTOCOL_A15.4.2_noexceptUnsupportedInAraCoreFunction
+// VECTOR NC AutosarC++17_10-A15.5.3: MD_SOMEIPPROTOCOL_A15.5.3_noexceptUnsupportedInAraCoreFunction
+template <typename TpPack, typename T, typename ArraySizeConf, typename... ItemConf, typename Alloc>
+static auto DeserializeVector(ara::core::Vector<T, Alloc>& v, Reader& r) noexcept
+    -> std::enable_if_t<(TypeTraitIsBulkConvertibleContainer<T, ItemConf...>() &&
+                         detail::TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>()),
+                        Result> {
+  std::size_t const item_size{sizeof(T)};
+  std::size_t const item_count{r.Size() / item_size};
+  std::size_t const static_size{item_size * item_count};
+  Result const result{r.VerifySize(static_size)};
+
+  // In normal use-case this check should never fail.
+  if (result) {
+    v.reserve(ArraySizeConf::value);  // VCA_SOMEIPPROTOCOL_VECTOR_RESERVE
+    r.ReadVectorWithByteOrder<GetFirstItemConf<ItemConf...>, ArraySizeConf>(v);
+  }
+
+  // Check that all the elements are deserialized, if not then we must return false.
+  return result && (r.Size() == 0U);
+}
+
 }  // namespace deserialization
 }  // namespace internal
 }  // namespace someip_protocol
@@ -30,6 +30,7 @@
 #include "ara/core/array.h"
 #include "ara/core/string.h"
 #include "ara/core/vector.h"
+#include "someip-protocol/internal/bulk_byteorder.h"
 #include "someip-protocol/internal/byteorder.h"
 #include "someip-protocol/internal/traits.h"
 #include "someip-protocol/internal/types.h"
@@ -519,6 +520,86 @@ class Reader {
     read_index_ += bytes_count;
   }
 
+  /*!
+   * \brief       Read arithmetic array<T,N> from bufferView, converting from the given byte order.
+   * \tparam      Endian Byte order of the serialized elements.
+   * \tparam      T Type of array. Template enabled only if T contains arithmetic elements.
+   * \tparam      N Size of the array.
+   * \param[out]  arr Array, the deserialized value shall be stored into.
+   * \pre         Caller has to verify the underlying buffer has enough bytes to read via VerifySize.
+   * \context     Reactor|App
+   * \reentrant   FALSE
+   *
+   * \internal
+   *  - Copy the serialized bytes into the destination array, converting all elements to host byte order.
+   *  - Increase the internal read counter.
+   * \endinternal
+   */
+  template <typename Endian, typename T, std::size_t N,
+            typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+  void ReadArrayWithByteOrder(ara::core::Array<T, N>& arr) noexcept {
+    static_assert(!std::is_same<T, bool>::value, "Invalid read operation for bool array.");
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(reinterpret_cast<std::uint8_t*>(arr.data()), Data(), N);
+
+    read_index_ += N * sizeof(T);
+  }
+
+  /*!
+   * \brief       Read vector<T> from bufferView, converting from the given byte order.
+   * \tparam      Endian Byte order of the serialized elements.
+   * \tparam      T Datatype stored in the vector. Template enabled only if T contains arithmetic elements.
+   * \tparam      Alloc Vector allocator.
+   * \param[out]  vec Vector, the deserialized value shall be stored into.
+   * \pre         Caller has to verify the underlying buffer has enough bytes to read via VerifySize.
+   * \context     Reactor|App
+   * \reentrant   FALSE
+   *
+   * \internal
+   * - Calculate the number of elements that could fit into the byte stream.
+   * - Append the elements to the destination vector, converting them to host byte order.
+   * - Increase the read index to the number of bytes that have been read.
+   * \endinternal
+   */
+  // VECTOR AV NC Architecture-ApiAnalysis Local_Var_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+  template <typename Endian, typename T, typename Alloc,
+            typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+  void ReadVectorWithByteOrder(ara::core::Vector<T, Alloc>& vec) noexcept {
+    std::size_t const element_count{Size() / sizeof(T)};
+    AppendWithByteOrder<Endian>(vec, element_count);
+
+    read_index_ += element_count * sizeof(T);
+  }
+
+  /*!
+   * \brief       Read vector<T> from bufferView, converting from the given byte order.
+   * \tparam      Endian Byte order of the serialized elements.
+   * \tparam      ArraySizeConf Array size item configuration: max. number of allowed vector elements.
+   * \tparam      T Datatype stored in the vector. Template enabled only if T contains arithmetic elements.
+   * \tparam      Alloc Vector allocator.
+   * \param[out]  vec Vector, the deserialized value shall be stored into.
+   * \pre         Caller has to verify the underlying buffer has enough bytes to read via VerifySize.
+   * \context     Reactor|App
+   * \reentrant   FALSE
+   *
+   * \internal
+   * - Calculate the number of stored elements.
+   * - Append at most the max. permitted number of elements to the destination vector, converting them to host byte
+   *   order.
+   * - Increase the read index regardless of the ignored elements to the number of bytes that represent the calculated
+   *   number of elements.
+   * \endinternal
+   */
+  template <typename Endian, typename ArraySizeConf, typename T, typename Alloc,
+            typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+  void ReadVectorWithByteOrder(ara::core::Vector<T, Alloc>& vec) noexcept {
+    std::size_t const element_count{Size() / sizeof(T)};
+    AppendWithByteOrder<Endian>(vec, std::min(element_count, static_cast<std::size_t>(ArraySizeConf::value)));
+
+    // Mark all bytes of the vector as read, including ignored elements due to ArraySize limit.
+    read_index_ += element_count * sizeof(T);
+  }
+
   /*!
    * \brief       Read vector<bool> from bufferView.
    * \tparam      Alloc Vector allocator.
@@ -820,6 +901,28 @@ class Reader {
   BufferView View() const { return ara::core::MakeSpan(Data(), Size()); }
 
  private:
+  /*!
+   * \brief       Append elements read from the current position to a vector, converting from the given byte order.
+   * \tparam      Endian Byte order of the serialized elements.
+   * \tparam      T Arithmetic datatype stored in the vector.
+   * \tparam      Alloc Vector allocator.
+   * \param[out]  vec Vector to append to.
+   * \param[in]   element_count Number of elements to append.
+   * \pre         The buffer holds element_count elements at the current position.
+   * \context     Reactor|App
+   * \reentrant   FALSE
+   */
+  // VECTOR NC AutosarC++17_10-A15.4.2: MD_SOMEIPPROTOCOL_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
+  // VECTOR NC AutosarC++17_10-A15.5.3: MD_SOMEIPPROTOCOL_AutosarC++17_10-A15.4.2_A15.5.3_STL_exceptions
+  template <typename Endian, typename T, typename Alloc>
+  void AppendWithByteOrder(ara::core::Vector<T, Alloc>& vec, std::size_t element_count) const noexcept {
+    static_assert(!std::is_same<T, bool>::value, "Invalid read operation for bool vector.");
+    std::size_t const offset{vec.size()};
+    vec.resize(offset + element_count);  // VCA_SOMEIPPROTOCOL_WITHIN_SPEC
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(reinterpret_cast<std::uint8_t*>(&vec.data()[offset]), Data(), element_count);
+  }
+
   /*!
    * \brief The managed Bufferview
    */
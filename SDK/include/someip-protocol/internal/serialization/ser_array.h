@@ -51,7 +51,9 @@ namespace serialization {
  */
 template <typename TpPack, typename... ItemConf, typename T, std::size_t N>
 static auto serializeArray(ara::core::Array<T, N> const& array, Writer& writer) noexcept
-    -> std::enable_if_t<!TypeTraitIsOptimizableContainer<T, ItemConf...>(), void> {
+    -> std::enable_if_t<(!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()),
+                        void> {
   for (T const& item : array) {
     // clang-format off
     SomeIpProtocolSerialize<TpPack, ItemConf...>(writer, item); // VCA_SOMEIPPROTOCOL_WRITER_REFERENCE
@@ -82,6 +84,30 @@ static auto serializeArray(ara::core::Array<T, N> const& array, Writer& writer)
   writer.writeArray(array);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
 }
 
+/*!
+ * \brief Specialization for an array consisting of a multi-byte arithmetic type with different endianness.
+ * \tparam TpPack Transformation property. Not required in this case.
+ * \tparam ItemConf Endianness of the elements.
+ * \tparam T Array element type.
+ * \tparam N Number of elements in the array.
+ * \param[in] array Array containing the data to be serialized.
+ * \param[out] writer Writer holding the bufferView to to which data is serialized.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ *
+ * \internal
+ * - Serialize array, converting all elements to the configured byte order at once.
+ * \endinternal
+ */
+template <typename TpPack, typename... ItemConf, typename T, std::size_t N>
+static auto serializeArray(ara::core::Array<T, N> const& array, Writer& writer) noexcept
+    -> std::enable_if_t<TypeTraitIsBulkConvertibleContainer<T, ItemConf...>(), void> {
+  writer.writeArrayWithByteOrder<GetFirstItemConf<ItemConf...>>(array);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
+}
+
 }  // namespace serialization
 }  // namespace internal
 }  // namespace someip_protocol
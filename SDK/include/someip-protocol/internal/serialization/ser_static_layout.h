@@ -0,0 +1,656 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file ser_static_layout.h
+ *        \brief Fused serialization of data types with a static layout.
+ *      \details Data types for which IsStaticLayout() holds (primitives, enums, arrays and structs composed of those,
+ *               with or without length field) always occupy the same number of bytes. The value of each length field
+ *               is a constant as well. SomeIpProtocolSerializeStaticLayout() checks the buffer size once for the
+ *               complete data type and then writes all members through a StaticLayoutWriter, which neither checks
+ *               bounds nor maintains a write index per member. Arrays of arithmetic types are converted in one block
+ *               (see bulk_byteorder.h).
+ *
+ *               Generated struct serializers provide the fused routine of a struct as
+ *               SerializeStaticLayout<TpPack>(StaticLayoutWriter&, Struct const&), in the same way as they provide
+ *               SomeIpProtocolSerialize<TpPack>(Writer&, Struct const&). There is no fallback to the regular struct
+ *               serializer, as it would check every member again. StaticLayoutSerializer wraps the fused serialization
+ *               as payload serializer for the binding serializer wrappers.
+ *      \unit SomeIpProtocol::Serdes::Serialization
+ *
+ *********************************************************************************************************************/
+#ifndef LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_SERIALIZATION_SER_STATIC_LAYOUT_H_
+#define LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_SERIALIZATION_SER_STATIC_LAYOUT_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include "amsr/core/optional.h"
+#include "ara/core/array.h"
+#include "ara/core/map.h"
+#include "ara/core/variant.h"
+#include "ara/core/vector.h"
+#include "ser_forward.h"
+#include "ser_sizing.h"
+#include "someip-protocol/internal/bulk_byteorder.h"
+#include "someip-protocol/internal/byteorder.h"
+#include "someip-protocol/internal/is_static_size.h"
+#include "someip-protocol/internal/serialization/types.h"
+#include "someip-protocol/internal/serialization/writer.h"
+#include "someip-protocol/internal/types.h"
+
+namespace amsr {
+namespace someip_protocol {
+namespace internal {
+namespace serialization {
+
+/*!
+ * \brief   Writer for a buffer region whose size has already been checked for the complete data type.
+ * \details Only used by the fused serialization of static layout data types. The region must be large enough for all
+ *          writes, which is guaranteed by SomeIpProtocolSerializeStaticLayout().
+ * \vprivate Product private
+ */
+class StaticLayoutWriter final {
+ public:
+  /*!
+   * \brief Construct a writer for a checked region.
+   * \param[in] region Region holding exactly the static size of the data type to serialize.
+   * \pre -
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  explicit StaticLayoutWriter(BufferView const& region) noexcept : cursor_{region.data()} {}
+
+  /*!
+   * \brief Write an integral value.
+   * \tparam T Integral type.
+   * \tparam Endian Endianness to use.
+   * \param[in] t Value to write.
+   * \pre The region holds sizeof(T) more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  template <typename T, typename Endian>
+  auto WritePrimitive(T const& t) noexcept
+      -> std::enable_if_t<std::is_integral<T>::value && (!std::is_same<T, bool>::value), void> {
+    UintWrite<sizeof(T), Endian>::write(cursor_, static_cast<std::make_unsigned_t<T>>(t));
+    Advance(sizeof(T));
+  }
+
+  /*!
+   * \brief Write a bool as a single byte.
+   * \tparam T Must be bool.
+   * \tparam Endian Endianness, ignored.
+   * \param[in] t Value to write.
+   * \pre The region holds one more byte.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  template <typename T, typename Endian>
+  auto WritePrimitive(bool t) noexcept -> std::enable_if_t<std::is_same<T, bool>::value, void> {
+    UintWrite<sizeof(std::uint8_t), Endian>::write(cursor_, static_cast<std::uint8_t>(t));
+    Advance(sizeof(std::uint8_t));
+  }
+
+  /*!
+   * \brief Write a float.
+   * \tparam T Must be float.
+   * \tparam Endian Endianness to use.
+   * \param[in] t Value to write.
+   * \pre The region holds four more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  template <typename T, typename Endian>
+  auto WritePrimitive(T const& t) noexcept -> std::enable_if_t<std::is_same<T, float>::value, void> {
+    FloatWrite<Endian>::write(FloatWriteData{cursor_, t});
+    Advance(sizeof(float));
+  }
+
+  /*!
+   * \brief Write a double.
+   * \tparam T Must be double.
+   * \tparam Endian Endianness to use.
+   * \param[in] t Value to write.
+   * \pre The region holds eight more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  template <typename T, typename Endian>
+  auto WritePrimitive(T const& t) noexcept -> std::enable_if_t<std::is_same<T, double>::value, void> {
+    DoubleWrite<Endian>::write(DoubleWriteData{cursor_, t});
+    Advance(sizeof(double));
+  }
+
+  /*!
+   * \brief Write an array of an arithmetic type (except bool).
+   * \tparam Endian Endianness to use for the elements.
+   * \tparam T Element type.
+   * \tparam N Number of elements.
+   * \param[in] arr Array to write.
+   * \pre The region holds N * sizeof(T) more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   *
+   * \internal
+   * - Copy the array in one block, converting all elements to the configured byte order if required.
+   * \endinternal
+   */
+  template <typename Endian, typename T, std::size_t N>
+  auto WriteArray(ara::core::Array<T, N> const& arr) noexcept
+      -> std::enable_if_t<std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value), void> {
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(cursor_, reinterpret_cast<std::uint8_t const*>(arr.data()), N);
+    Advance(N * sizeof(T));
+  }
+
+  /*!
+   * \brief Write a length field.
+   * \tparam LengthConf Length field configuration with a non-zero length field size.
+   * \param[in] length Length value, i.e. the static size of the data following the length field.
+   * \pre The region holds LengthConf::value more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   *
+   * \internal
+   * - If the length fits into the length field, write it.
+   * - Otherwise log fatal message and abort.
+   * \endinternal
+   */
+  template <typename LengthConf>
+  auto WriteLengthField(std::size_t const length) noexcept -> std::enable_if_t<HasLengthField<LengthConf>::value, void> {
+    using LengthFieldType = typename UintWrite<LengthConf::value, typename LengthConf::endian>::type;
+    if (length <= std::numeric_limits<LengthFieldType>::max()) {
+      UintWrite<LengthConf::value, typename LengthConf::endian>::write(cursor_, static_cast<LengthFieldType>(length));
+      Advance(LengthConf::value);
+    } else {
+      logging::SomeipProtocolLogBuilder::LogFatalAndAbort(  // VCA_SOMEIPPROTOCOL_VALID_POINTER_PARAMETERS
+          ara::core::StringView{"Violation: Length field overflow during serialization."},
+          ara::core::StringView{AMSR_FILE_LINE});
+    }
+  }
+
+  /*!
+   * \brief Write no length field.
+   * \tparam LengthConf Length field configuration with a zero length field size.
+   * \pre -
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  template <typename LengthConf>
+  auto WriteLengthField(std::size_t) noexcept -> std::enable_if_t<!HasLengthField<LengthConf>::value, void> {}
+
+
+ private:
+  /*!
+   * \brief Advance the write position.
+   * \param[in] count Number of bytes written.
+   * \pre The region holds count more bytes.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  void Advance(SizeType count) noexcept { cursor_ = std::next(cursor_, static_cast<std::ptrdiff_t>(count)); }
+
+  /*!
+   * \brief Current write position.
+   */
+  std::uint8_t* cursor_;
+};
+
+/*!
+ * \brief Forward declaration of the top level fused serialization template.
+ * \tparam TpPack Transformation properties.
+ * \tparam Head Either length size config or endianness.
+ * \tparam Confs Configuration of the members.
+ * \tparam T Type of the member.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] t Data to serialize.
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+void SerializeStaticLayout(StaticLayoutWriter& w, T const& t) noexcept;
+
+/*!
+ * \brief Forward declaration of the static layout check.
+ * \tparam TpPack Transformation properties.
+ * \tparam Confs Configuration of the members.
+ * \tparam T Type of the member.
+ * \return True when the member has a static layout, and false otherwise.
+ */
+template <typename TpPack, typename... Confs, typename T>
+constexpr bool IsStaticLayout(SizeToken<T>) noexcept;
+
+namespace detail {
+
+/*!
+ * \brief Checks if a primitive or an enum has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Endianness.
+ * \tparam T Type of the primitive or enum.
+ * \return Always true.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename T>
+constexpr auto IsStaticLayoutForConf(SizeToken<T>) noexcept
+    -> std::enable_if_t<IsPrimitiveType<T>::value || IsEnumType<T>::value, bool> {
+  return true;
+}
+
+/*!
+ * \brief   Checks if the user struct type has a static layout.
+ * \details This overload is less specialized than all competing overloads and is used for user structs. In contrast
+ *          to IsStaticSize(), the user struct and its members may have a length field. Calls into user generated code
+ *          to find out.
+ * \tparam TpPack Transformation properties.
+ * \tparam LengthConf Length field configuration for the length field itself.
+ * \tparam Conf Configuration of the members.
+ * \tparam T Type of the member.
+ * \return True when the user struct has a static layout, and false otherwise.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename LengthConf, typename... Conf, typename T>
+constexpr auto IsStaticLayoutForConf(SizeToken<T>) noexcept
+    -> std::enable_if_t<(!IsPrimitiveType<T>::value) && (!IsEnumType<T>::value) && (!traits::IsBasicString<T>::value),
+                        bool> {
+  return IsStaticLayout<TpPack>(SizeToken<T>{});
+}
+
+/*!
+ * \brief Checks if the array type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam LengthConf Length field configuration for the length field itself.
+ * \tparam Conf Configuration of the members.
+ * \tparam T Type of the member.
+ * \tparam N Size of the array.
+ * \return True when the array elements have a static layout, and false otherwise.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename LengthConf, typename... Conf, typename T, std::size_t N>
+constexpr bool IsStaticLayoutForConf(SizeToken<ara::core::Array<T, N>>) noexcept {
+  return IsStaticLayout<TpPack, Conf...>(SizeToken<T>{});
+}
+
+/*!
+ * \brief Checks if the optional type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Configuration of the contained item.
+ * \tparam T Contained type.
+ * \return Always return false for optional type.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename T>
+constexpr bool IsStaticLayoutForConf(SizeToken<ara::core::Optional<T>>) noexcept {
+  return false;
+}
+
+/*!
+ * \brief Checks if the vector type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Configuration of the members.
+ * \tparam T Type of the member.
+ * \tparam Alloc Allocator type.
+ * \return Always return false for vector type.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename T, typename Alloc>
+constexpr bool IsStaticLayoutForConf(SizeToken<ara::core::Vector<T, Alloc>>) noexcept {
+  return false;
+}
+
+/*!
+ * \brief Checks if the map type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Configuration of the members.
+ * \tparam K Key type.
+ * \tparam V Value type.
+ * \tparam C Comparator type.
+ * \tparam Alloc Allocator type.
+ * \return Always return false for map type.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename K, typename V, typename C, typename Alloc>
+constexpr bool IsStaticLayoutForConf(SizeToken<ara::core::Map<K, V, C, Alloc>>) noexcept {
+  return false;
+}
+
+/*!
+ * \brief Checks if the string type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Configuration of the members.
+ * \tparam String String type.
+ * \return Always return false for string type.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename String,
+          std::enable_if_t<traits::IsBasicString<String>::value>* = nullptr>
+constexpr bool IsStaticLayoutForConf(SizeToken<String>) noexcept {
+  return false;
+}
+
+/*!
+ * \brief Checks if the variant type has a static layout.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Configuration of the members.
+ * \tparam Ts Alternative types.
+ * \return Always return false for variant type.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Conf, typename... Ts>
+constexpr bool IsStaticLayoutForConf(SizeToken<ara::core::Variant<Ts...>>) noexcept {
+  return false;
+}
+
+/*!
+ * \brief Fused serialization of a primitive.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Endianness.
+ * \tparam Primitive Type of primitive.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] t Primitive to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename Conf, typename Primitive>
+auto SerializeStaticLayout(StaticLayoutWriter& w, Primitive const& t) noexcept
+    -> std::enable_if_t<IsPrimitiveType<Primitive>::value, void> {
+  w.WritePrimitive<std::decay_t<Primitive>, Conf>(t);
+}
+
+/*!
+ * \brief Fused serialization of an enum.
+ * \tparam TpPack Transformation properties.
+ * \tparam Conf Endianness.
+ * \tparam EnumType Type of enum.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] t Enum to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename Conf, typename EnumType>
+auto SerializeStaticLayout(StaticLayoutWriter& w, EnumType const& t) noexcept
+    -> std::enable_if_t<IsEnumType<EnumType>::value, void> {
+  using UnderlyingType = typename std::underlying_type<EnumType>::type;
+  w.WritePrimitive<UnderlyingType, Conf>(static_cast<UnderlyingType>(t));
+}
+
+/*!
+ * \brief Fused serialization of a user struct.
+ * \tparam TpPack Transformation properties.
+ * \tparam LengthConf Length field configuration for the length field itself.
+ * \tparam UserStruct Type of struct.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] s Struct to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ *
+ * \internal
+ * - Write the length field, if configured, with the static size of the struct.
+ * - Write the members with the generated fused routine of the struct.
+ * \endinternal
+ */
+template <typename TpPack, typename LengthConf, typename UserStruct>
+auto SerializeStaticLayout(StaticLayoutWriter& w, UserStruct const& s) noexcept
+    -> std::enable_if_t<(!IsPrimitiveType<UserStruct>::value) && (!IsEnumType<UserStruct>::value) &&
+                            (!traits::IsBasicString<UserStruct>::value),
+                        void> {
+  w.WriteLengthField<LengthConf>(serialization::GetMaximumBufferSize<TpPack, LengthConf>(s).Value() -
+                                 LengthConf::value);
+  SerializeStaticLayout<TpPack>(w, s);  // NOTE calls the generated function.
+}
+
+/*!
+ * \brief Fused serialization of an array of a non-arithmetic type or of bool.
+ * \tparam TpPack Transformation properties.
+ * \tparam LengthConf Length field configuration for the length field itself.
+ * \tparam ItemConf Item configuration for the array elements.
+ * \tparam T Element type.
+ * \tparam N Number of elements.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] v Array to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename LengthConf, typename... ItemConf, typename T, std::size_t N>
+auto SerializeStaticLayout(StaticLayoutWriter& w, ara::core::Array<T, N> const& v) noexcept
+    -> std::enable_if_t<(!std::is_arithmetic<T>::value) || std::is_same<T, bool>::value, void> {
+  w.WriteLengthField<LengthConf>(serialization::GetMaximumBufferSize<TpPack, LengthConf, ItemConf...>(v).Value() -
+                                 LengthConf::value);
+  for (T const& item : v) {
+    serialization::SerializeStaticLayout<TpPack, ItemConf...>(w, item);
+  }
+}
+
+/*!
+ * \brief Fused serialization of an array of an arithmetic type (except bool).
+ * \tparam TpPack Transformation properties.
+ * \tparam LengthConf Length field configuration for the length field itself.
+ * \tparam ItemConf Endianness of the elements.
+ * \tparam T Element type.
+ * \tparam N Number of elements.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] v Array to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename LengthConf, typename... ItemConf, typename T, std::size_t N>
+auto SerializeStaticLayout(StaticLayoutWriter& w, ara::core::Array<T, N> const& v) noexcept
+    -> std::enable_if_t<std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value), void> {
+  w.WriteLengthField<LengthConf>(N * sizeof(T));
+  w.WriteArray<GetFirstItemConf<ItemConf...>>(v);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief   Checks if a data type has a static layout and can be serialized with SomeIpProtocolSerializeStaticLayout().
+ * \details A data type has a static layout if it always occupies the same number of bytes and all its length field
+ *          values are constant. Generated code provides IsStaticLayout<TpPack>(SizeToken<Struct>) for user structs.
+ * \tparam TpPack Transformation properties.
+ * \tparam Confs Configuration of the members.
+ * \tparam T Type of the member.
+ * \return True when the member has a static layout, and false otherwise.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename... Confs, typename T>
+constexpr bool IsStaticLayout(SizeToken<T>) noexcept {
+  return detail::IsStaticLayoutForConf<TpPack, Confs...>(SizeToken<T>{});
+}
+
+/*!
+ * \brief Implementation of forward declared top-level symbol.
+ * \tparam TpPack Transformation properties.
+ * \tparam Head Either length size config or endianness.
+ * \tparam Confs Configuration of the members.
+ * \tparam T Type of the member.
+ * \param[in,out] w Writer for the checked region.
+ * \param[in] t Data to serialize.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+void SerializeStaticLayout(StaticLayoutWriter& w, T const& t) noexcept {
+  detail::SerializeStaticLayout<TpPack, Head, Confs...>(w, t);
+}
+
+/*!
+ * \brief   Serialize a data type with static layout with a single buffer size check.
+ * \details Replacement for SomeIpProtocolSerialize() for data types with IsStaticLayout(). Produces the same byte
+ *          stream.
+ * \tparam TpPack Transformation properties.
+ * \tparam Head Either length size config or endianness.
+ * \tparam Confs Configuration of the members.
+ * \tparam T Type to serialize.
+ * \param[in,out] w Writer holding the buffer to serialize to.
+ * \param[in] t Data to serialize.
+ * \pre The writer should hold sufficient buffer for the static size of the data type.
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ *
+ * \internal
+ * - Consume the static size of the data type from the writer. Aborts if the buffer is too small.
+ * - Write all members into the consumed region without further checks.
+ * \endinternal
+ */
+template <typename TpPack, typename Head, typename... Confs, typename T>
+void SomeIpProtocolSerializeStaticLayout(Writer& w, T const& t) noexcept {
+  static_assert(IsStaticLayout<TpPack, Head, Confs...>(SizeToken<T>{}),
+                "Fused serialization is only available for data types with static layout.");
+  std::size_t const static_size{GetMaximumBufferSize<TpPack, Head, Confs...>(t).Value()};
+  Writer const region{w.consumeSubStream(static_size)};
+  StaticLayoutWriter layout_writer{BufferView{region.data(), static_size}};
+  SerializeStaticLayout<TpPack, Head, Confs...>(layout_writer, t);
+}
+
+/*!
+ * \brief   Payload serializer for a data type with static layout.
+ * \details Provides the interface of the generated payload serializers (Serialize(), GetRequiredBufferSize() and
+ *          GetMaximumBufferSize()), so it can be used as PayloadSerializer of the binding serializer wrappers for
+ *          events, field notifiers and method responses whose data type has a static layout.
+ * \tparam DataType Data type to serialize.
+ * \tparam TpPack Transformation properties.
+ * \tparam Head Either length size config or endianness.
+ * \tparam Confs Configuration of the members.
+ * \vprivate Product private
+ */
+template <typename DataType, typename TpPack, typename Head, typename... Confs>
+class StaticLayoutSerializer final {
+  static_assert(IsStaticLayout<TpPack, Head, Confs...>(SizeToken<DataType>{}),
+                "StaticLayoutSerializer is only available for data types with static layout.");
+
+ public:
+  /*!
+   * \brief Serialize the data.
+   * \param[in,out] writer Writer holding the buffer to serialize to.
+   * \param[in] data Data to serialize.
+   * \pre The writer should hold sufficient buffer for the static size of the data type.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  static void Serialize(Writer& writer, DataType const& data) noexcept {
+    SomeIpProtocolSerializeStaticLayout<TpPack, Head, Confs...>(writer, data);
+  }
+
+  /*!
+   * \brief Get the required buffer size, which is the static size of the data type.
+   * \param[in] data Data to serialize.
+   * \return The required buffer size.
+   * \pre -
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  // VECTOR AV NC Architecture-ApiAnalysis Return_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+  static std::size_t GetRequiredBufferSize(DataType const& data) noexcept {
+    return serialization::GetMaximumBufferSize<TpPack, Head, Confs...>(data).Value();
+  }
+
+  /*!
+   * \brief Get the maximum buffer size, which is the static size of the data type.
+   * \return The maximum buffer size.
+   * \pre -
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   */
+  static constexpr InfSizeT GetMaximumBufferSize() noexcept {
+    return serialization::GetMaximumBufferSize<DataType, TpPack, Head, Confs...>();
+  }
+};
+
+}  // namespace serialization
+}  // namespace internal
+}  // namespace someip_protocol
+}  // namespace amsr
+
+#endif  // LIB_SOMEIP_PROTOCOL_SERDES_INCLUDE_SOMEIP_PROTOCOL_INTERNAL_SERIALIZATION_SER_STATIC_LAYOUT_H_
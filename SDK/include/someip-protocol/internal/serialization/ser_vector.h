@@ -34,6 +34,48 @@ namespace someip_protocol {
 namespace internal {
 namespace serialization {
 
+/*!
+ * \brief Writes the first elements of an arithmetic vector with same endianness.
+ * \tparam ItemConf Configuration parameters of an element. Not required in this case.
+ * \tparam T Item type.
+ * \tparam Alloc Vector allocator.
+ * \param[in] v Vector to serialize.
+ * \param[in] nr_elements Number of elements to serialize.
+ * \param[in,out] w Writer holding the buffer to which data is serialized.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+// VECTOR AV NC Architecture-ApiAnalysis Parameter_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+template <typename... ItemConf, typename T, typename Alloc>
+static auto writeArithmeticVector(ara::core::Vector<T, Alloc> const& v, std::size_t nr_elements, Writer& w) noexcept
+    -> std::enable_if_t<TypeTraitIsOptimizableContainer<T, ItemConf...>(), void> {
+  w.writeVector(v, nr_elements);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
+}
+
+/*!
+ * \brief Writes the first elements of a multi-byte arithmetic vector with different endianness.
+ * \tparam ItemConf Endianness of the elements.
+ * \tparam T Item type.
+ * \tparam Alloc Vector allocator.
+ * \param[in] v Vector to serialize.
+ * \param[in] nr_elements Number of elements to serialize.
+ * \param[in,out] w Writer holding the buffer to which data is serialized.
+ * \pre -
+ * \context Reactor|App
+ * \threadsafe FALSE
+ * \reentrant FALSE
+ * \synchronous TRUE
+ */
+// VECTOR AV NC Architecture-ApiAnalysis Parameter_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+template <typename... ItemConf, typename T, typename Alloc>
+static auto writeArithmeticVector(ara::core::Vector<T, Alloc> const& v, std::size_t nr_elements, Writer& w) noexcept
+    -> std::enable_if_t<TypeTraitIsBulkConvertibleContainer<T, ItemConf...>(), void> {
+  w.writeVectorWithByteOrder<GetFirstItemConf<ItemConf...>>(v, nr_elements);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
+}
+
 /*!
  * \brief Serializes a vector.
  * \details Specialization for when no max. size limitation (arraySize) configured for the vector.
@@ -59,7 +101,8 @@ template <typename TpPack, typename ArraySizeConf, typename... ItemConf, typenam
 // VECTOR NL AutosarC++17_10-A2.11.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A2.11.4_NameOfObjectOrFunctionReused
 static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noexcept
     -> std::enable_if_t<(!TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>()) &&
-                            (!TypeTraitIsOptimizableContainer<T, ItemConf...>()),
+                            (!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()),
                         void> {
   for (T const& value : v) {
     SomeIpProtocolSerialize<TpPack, ItemConf...>(w, value);  // VCA_SOMEIPPROTOCOL_WRITER_REFERENCE
@@ -69,7 +112,7 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
 /*!
  * \brief Serializes a vector.
  * \details Specialization for when no max. size limitation (arraySize) configured for the vector,
- *          and element types with the same endianness.
+ *          and arithmetic element types which are written as one block.
  * \tparam TpPack Transformation properties.
  * \tparam ArraySizeConf Array size item configuration: max. number of allowed vector elements.
  * \tparam ItemConf Configuration parameters required to serialize an element.
@@ -90,9 +133,10 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
 template <typename TpPack, typename ArraySizeConf, typename... ItemConf, typename T, typename Alloc>
 static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noexcept
     -> std::enable_if_t<(!TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>()) &&
-                            TypeTraitIsOptimizableContainer<T, ItemConf...>(),
+                            (TypeTraitIsOptimizableContainer<T, ItemConf...>() ||
+                             TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()),
                         void> {
-  w.writeVector(v, v.size());  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
+  writeArithmeticVector<ItemConf...>(v, v.size(), w);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
 }
 
 /*!
@@ -126,7 +170,8 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
 template <typename TpPack, typename ArraySizeConf, typename... ItemConf, typename T, typename Alloc>
 static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noexcept
     -> std::enable_if_t<TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>() &&
-                            (!TypeTraitIsOptimizableContainer<T, ItemConf...>()),
+                            (!TypeTraitIsOptimizableContainer<T, ItemConf...>()) &&
+                            (!TypeTraitIsBulkConvertibleContainer<T, ItemConf...>()),
                         void> {
   std::size_t nr_elements_to_serialize{v.size()};
   std::size_t const max_nr_elements{ArraySizeConf::value};
@@ -158,7 +203,7 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
 /*!
  * \brief Serializes a vector.
  * \details Specialization for when max. size limitation (arraySize) is configured for the vector,
- *          and element types with the same endianness.
+ *          and arithmetic element types which are written as one block.
  * \tparam TpPack Transformation properties.
  * \tparam ArraySizeConf Array size item configuration: max. number of allowed vector elements.
  * \tparam ItemConf Configuration parameters required to serialize an element.
@@ -186,7 +231,8 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
 template <typename TpPack, typename ArraySizeConf, typename... ItemConf, typename T, typename Alloc>
 static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noexcept
     -> std::enable_if_t<(TypeTraitIsVectorArraySizeLimitActive<ArraySizeConf>() &&
-                         TypeTraitIsOptimizableContainer<T, ItemConf...>()),
+                         (TypeTraitIsOptimizableContainer<T, ItemConf...>() ||
+                          TypeTraitIsBulkConvertibleContainer<T, ItemConf...>())),
                         void> {
   // VECTOR AV NC Architecture-ApiAnalysis Local_Var_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
   std::size_t nr_elements_to_serialize{v.size()};
@@ -207,7 +253,7 @@ static auto serializeVector(ara::core::Vector<T, Alloc> const& v, Writer& w) noe
         static_cast<char const*>(__func__), __LINE__);
     nr_elements_to_serialize = max_nr_elements;
   }
-  w.writeVector(v, nr_elements_to_serialize);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
+  writeArithmeticVector<ItemConf...>(v, nr_elements_to_serialize, w);  // VCA_SOMEIPPROTOCOL_WRITE_REFERENCE
 }
 
 }  // namespace serialization
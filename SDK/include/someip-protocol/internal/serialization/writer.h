@@ -33,6 +33,7 @@
 #include "ara/core/array.h"
 #include "ara/core/string.h"
 #include "ara/core/vector.h"
+#include "someip-protocol/internal/bulk_byteorder.h"
 #include "someip-protocol/internal/byteorder.h"
 #include "someip-protocol/internal/logging/someip_protocol_log_builder.h"
 #include "someip-protocol/internal/traits.h"
@@ -896,6 +897,83 @@ class Writer {
     // clang-format on
   }
 
+  /*!
+   * \brief Writes an array of an arithmetic type in the given byte order.
+   * \tparam Endian Byte order to serialize the elements in.
+   * \tparam T The element type of the array. Template is enabled only if T is an arithmetic type.
+   * \tparam N The size of the array.
+   * \param[in] arr The array to write.
+   * \pre The writer should hold sufficient buffer for the value to be written.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   *
+   * \internal
+   * - Calculate number of bytes to be serialized.
+   * - If there is not sufficient amount of memory in the buffer
+   *   - Log fatal message and abort.
+   * - Copy the array into the buffer, converting all elements to the given byte order.
+   * - Increment the write index with the number of bytes written.
+   * \endinternal
+   */
+  template <typename Endian, typename T, std::size_t N,
+            typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+  void writeArrayWithByteOrder(ara::core::Array<T, N> const& arr) noexcept {
+    static_assert(!std::is_same<T, bool>::value, "Invalid write operation for bool array.");
+    std::size_t const bytes_count{N * sizeof(T)};
+    if (!hasSize(bytes_count)) {
+      // clang-format off
+      logging::SomeipProtocolLogBuilder::LogFatalAndAbort(ara::core::StringView{"Violation: Insufficient buffer size to serialize array<T, N>."}, // VCA_SOMEIPPROTOCOL_VALID_POINTER_PARAMETERS
+                                                          ara::core::StringView{AMSR_FILE_LINE});
+    } // VCA_SOMEIPPROTOCOL_COMPILER_GENERATED_FUNCTION_IMPLICITLY_CALLED
+    // clang-format on
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(data(), reinterpret_cast<std::uint8_t const*>(arr.data()), N);
+
+    write_index_ += bytes_count;
+  }
+
+  /*!
+   * \brief Writes a vector of an arithmetic type in the given byte order.
+   * \tparam Endian Byte order to serialize the elements in.
+   * \tparam T The element type of the vector. Template is enabled only if T is an arithmetic type.
+   * \tparam Alloc Vector allocator.
+   * \param[in] vec The input vector.
+   * \param[in] no_of_elements The number of elements from the input vector that should be written.
+   * \pre The writer should hold sufficient buffer for the value to be written.
+   * \context Reactor|App
+   * \threadsafe FALSE
+   * \reentrant FALSE
+   * \synchronous TRUE
+   *
+   * \internal
+   * - Calculate number of bytes to be serialized.
+   * - If there is not sufficient amount of memory in the buffer
+   *   - Log fatal message and abort.
+   * - Copy the elements into the buffer, converting them to the given byte order.
+   * - Increment the write index with the number of bytes written.
+   * \endinternal
+   */
+  // VECTOR AV NC Architecture-ApiAnalysis Parameter_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+  template <typename Endian, typename T, typename Alloc,
+            typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+  void writeVectorWithByteOrder(ara::core::Vector<T, Alloc> const& vec, size_t const no_of_elements) noexcept {
+    static_assert(!std::is_same<T, bool>::value, "Invalid write operation for bool vector.");
+    // VECTOR AV NC Architecture-ApiAnalysis Local_Var_Of_Type: MD_SOMEIPPROTOCOL_ArchCheck_size_t_Divergence
+    std::size_t const bytes_count{no_of_elements * sizeof(T)};
+    if (!hasSize(bytes_count)) {
+      // clang-format off
+      logging::SomeipProtocolLogBuilder::LogFatalAndAbort(ara::core::StringView{"Violation: Insufficient buffer size to serialize vector<T>"}, // VCA_SOMEIPPROTOCOL_VALID_POINTER_PARAMETERS
+                                                          ara::core::StringView{AMSR_FILE_LINE});
+    } // VCA_SOMEIPPROTOCOL_COMPILER_GENERATED_FUNCTION_IMPLICITLY_CALLED
+    // clang-format on
+    // VECTOR NL AutosarC++17_10-A5.2.4: MD_SOMEIPPROTOCOL_AutosarC++17_10-A5.2.4_REINTERPRET_CAST
+    BulkCopyWithByteOrder<Endian, T>(data(), reinterpret_cast<std::uint8_t const*>(vec.data()), no_of_elements);
+
+    write_index_ += bytes_count;
+  }
+
   /*!
    * \brief Write a string.
    * \tparam String String type.
@@ -78,6 +78,21 @@ struct LengthSize : std::integral_constant<std::size_t, Size> {
   using endian = Endianness;
 };
 
+/*!
+ * \brief Check if the provided configuration is a length field configuration with a non-zero length field size.
+ * \tparam T Configuration to be checked, e.g. LengthSize or an endianness.
+ */
+template <typename T>
+struct HasLengthField : std::false_type {};
+
+/*!
+ * \brief Check if the provided length field configuration has a non-zero length field size.
+ * \tparam Size Size of the length field in bytes.
+ * \tparam Endianness Endianess of the length field.
+ */
+template <std::size_t Size, typename Endianness>
+struct HasLengthField<LengthSize<Size, Endianness>> : std::integral_constant<bool, (Size != 0U)> {};
+
 /*!
  * \brief Defines the size of an array length field.
  * \tparam N Size of array length field in bytes.
@@ -284,6 +299,30 @@ static constexpr bool TypeTraitIsOptimizableContainer() noexcept(true) {
          static_cast<std::underlying_type_t<ByteOrderType>>(GetHostByteOrder()))));
 }
 
+/*!
+ * \brief Type-trait condition for bulk byte order conversion of array and vector data types.
+ *
+ * \details Applies to arrays/vectors of multi-byte numeric values which are not covered by
+ *          TypeTraitIsOptimizableContainer, i.e. values encoded in a byte order other than the host-byte-order. Such
+ *          containers are converted as one block (see bulk_byteorder.h) instead of element by element.
+ *
+ * \tparam T Value type of vector.
+ * \tparam ItemConf Item configuration parameter pack.
+ * \return true if bulk conversion can be used for the array/vector data type, otherwise false is returned.
+ * \pre -
+ * \context Reactor|App
+ * \reentrant TRUE
+ * \spec
+ *   requires true;
+ * \endspec
+ */
+template <typename T, typename... ItemConf>
+static constexpr bool TypeTraitIsBulkConvertibleContainer() noexcept(true) {
+  return std::is_arithmetic<T>::value && ((sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U)) &&
+         std::is_base_of<::amsr::someip_protocol::internal::Endianness, GetFirstItemConf<ItemConf...>>::value &&
+         (!TypeTraitIsOptimizableContainer<T, ItemConf...>());
+}
+
 }  // namespace internal
 }  // namespace someip_protocol
 }  // namespace amsr